@@ -190,6 +190,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/2d/core/SpriteBatch.cc \
 					../../../source/2d/core/SpriteBatchItem.cc \
 					../../../source/2d/core/SpriteBatchQuery.cc \
+					../../../source/2d/core/SharedAnimationClock.cc \
 					../../../source/2d/core/Utility.cc \
 					../../../source/2d/core/Vector2.cc \
 					../../../source/2d/experimental/composites/WaveComposite.cc \
@@ -214,6 +215,8 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/2d/scene/SceneRenderFactories.cpp \
 					../../../source/2d/scene/SceneRenderQueue.cpp \
 					../../../source/2d/scene/WorldQuery.cc \
+					../../../source/2d/scene/SceneContactBuffer.cc \
+					../../../source/2d/scene/ControllerBodyGrid.cc \
 					../../../source/algorithm/crc.cc \
 					../../../source/algorithm/hashFunction.cc \
 					../../../source/assets/assetBase.cc \
@@ -295,6 +298,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/graphics/color.cc \
 					../../../source/graphics/dgl.cc \
 					../../../source/graphics/dglMatrix.cc \
+					../../../source/graphics/dglBatch.cc \
 					../../../source/graphics/DynamicTexture.cc \
 					../../../source/graphics/gBitmap.cc \
 					../../../source/graphics/gFont.cc \
@@ -344,6 +348,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/io/bufferStream.cc \
 					../../../source/io/fileObject.cc \
 					../../../source/io/fileStream.cc \
+					../../../source/io/asyncFileIO.cc \
 					../../../source/io/fileStreamObject.cc \
 					../../../source/io/fileSystem_ScriptBinding.cc \
 					../../../source/io/filterStream.cc \
@@ -363,9 +368,13 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/io/zip/zipCryptStream.cc \
 					../../../source/io/zip/zipObject.cc \
 					../../../source/io/zip/zipSubStream.cc \
+					../../../source/io/zip/zipMappedStream.cc \
+					../../../source/io/zip/zipParallelWriter.cc \
 					../../../source/io/zip/zipTempStream.cc \
 					../../../source/math/rectClipper.cpp \
 					../../../source/memory/dataChunker.cc \
+					../../../source/memory/poolAllocator.cc \
+					../../../source/memory/allocationTracker.cc \
 					../../../source/memory/frameAllocator_ScriptBinding.cc \
 					../../../source/messaging/dispatcher.cc \
 					../../../source/messaging/eventManager.cc \
@@ -408,10 +417,15 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/persistence/tinyXML/tinyxmlparser.cpp \
 					../../../source/audio/audio.cc \
 					../../../source/audio/audioBuffer.cc \
+					../../../source/audio/audioMixerKernels.cc \
+					../../../source/audio/audioMixerDevice.cc \
+					../../../source/audio/audioMixer.cc \
 					../../../source/audio/audioDataBlock.cc \
 					../../../source/audio/audio_ScriptBinding.cc \
 					../../../source/audio/audioStreamSourceFactory.cc \
 					../../../source/audio/wavStreamSource.cc \
+					../../../source/audio/adpcmStreamSource.cc \
+					../../../source/audio/imaAdpcm.cc \
 					../../../source/component/dynamicConsoleMethodComponent.cpp \
 					../../../source/component/simComponent.cpp \
 					../../../source/component/behaviors/behaviorComponent.cpp \
@@ -569,6 +583,24 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/gui/editor/guiSeparatorCtrl.cc 
 #					../../../source/testing/tests/platformFileIoTests.cc \
 #					../../../source/testing/tests/platformMemoryTests.cc \
+#					../../../source/testing/tests/simDictionaryTests.cc \
+#					../../../source/testing/tests/imaAdpcmTests.cc \
+#					../../../source/testing/tests/audioMixerTests.cc \
+#					../../../source/testing/tests/headlessAssetTests.cc \
+#					../../../source/testing/tests/dynamicTreeTests.cc \
+#					../../../source/testing/tests/vectorTests.cc \
+#					../../../source/testing/tests/sharedAnimationClockTests.cc \
+#					../../../source/testing/benchmarks/tamlBenchmarks.cc \
+#					../../../source/testing/benchmarks/zipLoadBenchmarks.cc \
+#					../../../source/testing/benchmarks/batchRenderBenchmarks.cc \
+#					../../../source/testing/benchmarks/imageFontBenchmarks.cc \
+#					../../../source/testing/benchmarks/shapeVectorBenchmarks.cc \
+#					../../../source/testing/benchmarks/worldQueryBenchmarks.cc \
+#					../../../source/testing/benchmarks/consoleBenchmarks.cc \
+#					../../../source/testing/benchmarks/simDictionaryBenchmarks.cc \
+#					../../../source/testing/benchmarks/audioMixerBenchmarks.cc \
+#					../../../source/testing/benchmarks/stringTableBenchmarks.cc \
+#					../../../source/testing/benchmarks/vectorBenchmarks.cc \
 #					../../../source/testing/tests/platformStringTests.cc \
 #					../../../source/testing/unitTesting.cc
  
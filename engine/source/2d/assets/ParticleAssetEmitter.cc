@@ -156,7 +156,8 @@ ParticleAssetEmitter::ParticleAssetEmitter() :
                             mBlendMode( true ),
                             mSrcBlendFactor( GL_SRC_ALPHA ),
                             mDstBlendFactor( GL_ONE_MINUS_SRC_ALPHA ),
-                            mAlphaTest( -1.0f )
+                            mAlphaTest( -1.0f ),
+                            mSharedAnimationClock( false )
 {
     // Set the pivot point.
     // NOTE:    This is called to set the local AABB.
@@ -252,6 +253,7 @@ void ParticleAssetEmitter::initPersistFields()
     addProtectedField("NamedFrame", TypeString, Offset(mNamedImageFrame, ParticleAssetEmitter), &setNamedImageFrame, &defaultProtectedGetFn, &writeNamedImageFrame, "");
     addProtectedField("RandomImageFrame", TypeBool, Offset(mRandomImageFrame, ParticleAssetEmitter), &setRandomImageFrame, &defaultProtectedGetFn, &writeRandomImageFrame, "");
     addProtectedField("Animation", TypeAnimationAssetPtr, Offset(mAnimationAsset, ParticleAssetEmitter), &setAnimation, &getAnimation, &writeAnimation, "");
+    addProtectedField("SharedAnimationClock", TypeBool, Offset(mSharedAnimationClock, ParticleAssetEmitter), &setSharedAnimationClock, &defaultProtectedGetFn, &writeSharedAnimationClock, "");
 }
 
 //------------------------------------------------------------------------------
@@ -295,6 +297,7 @@ void ParticleAssetEmitter::copyTo(SimObject* object)
    pParticleAssetEmitter->setAlphaTest( getAlphaTest() );
 
    pParticleAssetEmitter->setRandomImageFrame( getRandomImageFrame() );
+   pParticleAssetEmitter->setSharedAnimationClock( getSharedAnimationClock() );
 
    // Static provider?
    if ( pParticleAssetEmitter->isStaticFrameProvider() )
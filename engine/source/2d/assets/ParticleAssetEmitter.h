@@ -110,6 +110,7 @@ private:
     StringTableEntry                        mNamedImageFrame;
     bool                                    mRandomImageFrame;
     AssetPtr<AnimationAsset>                mAnimationAsset;
+    bool                                    mSharedAnimationClock;
     bool                                    mUsingNamedFrame;
 
     /// Particle fields.
@@ -196,6 +197,8 @@ public:
     inline bool getRandomImageFrame( void ) const { return mRandomImageFrame; }
     bool setAnimation( const char* animationName );
     inline StringTableEntry getAnimation( void ) const { return mAnimationAsset.getAssetId(); }
+    inline void setSharedAnimationClock( const bool sharedClock ) { mSharedAnimationClock = sharedClock; }
+    inline bool getSharedAnimationClock( void ) const { return mSharedAnimationClock; }
     inline AssetPtr<ImageAsset>& getImageAsset( void ) { return mImageAsset; }
     inline AssetPtr<AnimationAsset>& getAnimationAsset( void ) { return mAnimationAsset; }
 
@@ -317,6 +320,8 @@ protected:
     static bool     setAnimation(void* obj, const char* data)                           { static_cast<ParticleAssetEmitter*>(obj)->setAnimation(data); return false; };
     static const char* getAnimation(void* obj, const char* data)                        { return static_cast<ParticleAssetEmitter*>(obj)->getAnimation(); }
     static bool     writeAnimation( void* obj, StringTableEntry pFieldName )            { ParticleAssetEmitter* pCastObject = static_cast<ParticleAssetEmitter*>(obj); if ( pCastObject->isStaticFrameProvider() ) return false; return pCastObject->mAnimationAsset.notNull(); }
+    static bool     setSharedAnimationClock(void* obj, const char* data)                { static_cast<ParticleAssetEmitter*>(obj)->setSharedAnimationClock(dAtob(data)); return false; };
+    static bool     writeSharedAnimationClock( void* obj, StringTableEntry pFieldName ) { ParticleAssetEmitter* pCastObject = static_cast<ParticleAssetEmitter*>(obj); if ( pCastObject->isStaticFrameProvider() ) return false; return pCastObject->getSharedAnimationClock(); }
 
     static bool     setBlendMode(void* obj, const char* data)                           { static_cast<ParticleAssetEmitter*>(obj)->setBlendMode(dAtob(data)); return false; }
     static bool     writeBlendMode( void* obj, StringTableEntry pFieldName )            { return static_cast<ParticleAssetEmitter*>(obj)->getBlendMode() == false; }
@@ -711,6 +711,29 @@ ConsoleMethodWithDocs(ParticleAssetEmitter, getAnimation, ConsoleString, 2, 2, (
 
 //------------------------------------------------------------------------------
 
+/*! Sets whether particles share a single animation clock.
+    When on, every particle playing a cycling animation at the same time-scale shows the same frame
+    and the animation is advanced once per tick for all of them rather than once per particle.
+    @param sharedClock Whether to use a shared animation clock or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(ParticleAssetEmitter, setSharedAnimationClock, ConsoleVoid, 3, 3, (sharedClock))
+{
+    object->setSharedAnimationClock( dAtob(argv[2]) );
+}
+
+//------------------------------------------------------------------------------
+
+/*! Gets whether particles share a single animation clock.
+    @return Whether to use a shared animation clock or not.
+*/
+ConsoleMethodWithDocs(ParticleAssetEmitter, getSharedAnimationClock, ConsoleBool, 2, 2, ())
+{
+    return object->getSharedAnimationClock();
+}
+
+//------------------------------------------------------------------------------
+
 /*! Sets whether to use render blending or not.
     @param blendMode Whether to use render blending or not.
     @return No return value.
@@ -110,6 +110,7 @@ SkeletonAsset::SkeletonAsset() :    mSkeletonFile(StringTable->EmptyString),
 
 SkeletonAsset::~SkeletonAsset()
 {
+    clearPoseCache();
     spAnimationStateData_dispose(mStateData);
     spSkeletonData_dispose(mSkeletonData);
     spAtlas_dispose(mAtlas);
@@ -248,6 +249,62 @@ void SkeletonAsset::onAssetRefresh( void )
 
 //-----------------------------------------------------------------------------
 
+const SkeletonPose* SkeletonAsset::findPose( const SkeletonPoseKey& key ) const
+{
+    // Find the pose.
+    typePoseHash::const_iterator poseItr = mPoseCache.find( key.getHash() );
+
+    // Finish if not found or the slot holds a different pose.
+    if ( poseItr == mPoseCache.end() || !(poseItr->value->mKey == key) )
+        return NULL;
+
+    return poseItr->value;
+}
+
+//-----------------------------------------------------------------------------
+
+SkeletonPose* SkeletonAsset::createPose( const SkeletonPoseKey& key )
+{
+    // Fetch the hash.
+    const U32 hash = key.getHash();
+
+    // Is there already a pose in this slot?
+    typePoseHash::iterator poseItr = mPoseCache.find( hash );
+    if ( poseItr != mPoseCache.end() )
+    {
+        // Yes, so reuse it.
+        SkeletonPose* pPose = poseItr->value;
+        pPose->clear();
+        pPose->mKey = key;
+        return pPose;
+    }
+
+    // Clear the cache if it's full.
+    if ( mPoseCache.size() >= SKELETONASSET_MAXPOSES )
+        clearPoseCache();
+
+    // Create a new pose.
+    SkeletonPose* pPose = new SkeletonPose();
+    pPose->mKey = key;
+    mPoseCache.insert( hash, pPose );
+
+    return pPose;
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonAsset::clearPoseCache( void )
+{
+    for( typePoseHash::iterator poseItr = mPoseCache.begin(); poseItr != mPoseCache.end(); ++poseItr )
+    {
+        delete poseItr->value;
+    }
+
+    mPoseCache.clear();
+}
+
+//-----------------------------------------------------------------------------
+
 void SkeletonAsset::buildAtlasData( void )
 {
     // If the atlas data was previously created, need to release it
@@ -303,6 +360,9 @@ void SkeletonAsset::buildSkeletonData( void )
     // Atlas load failure
     AssertFatal(mAtlas != NULL, "SkeletonAsset::buildSkeletonData() - Atlas was not loaded.");
     
+    // Clear any cached poses as they reference the skeleton data.
+    clearPoseCache();
+
     // Clear state data
     if (mStateData)
         spAnimationStateData_dispose(mStateData);
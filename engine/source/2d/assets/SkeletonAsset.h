@@ -35,12 +35,81 @@
 #include "spine/spine.h"
 #endif
 
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 DefineConsoleType( TypeSkeletonAssetPtr )
 
 //-----------------------------------------------------------------------------
 
+// The maximum number of poses cached per skeleton asset.
+#define SKELETONASSET_MAXPOSES      2048
+
+//-----------------------------------------------------------------------------
+
+/// Identifies an evaluated skeleton pose that can be shared by instances.
+struct SkeletonPoseKey
+{
+    const spAnimation*  mpAnimation;
+    const spSkin*       mpSkin;
+    S32                 mFrame;
+    bool                mFlipX;
+    bool                mFlipY;
+    Vector2             mRootScale;
+    Vector2             mRootOffset;
+
+    U32 getHash( void ) const
+    {
+        U32 hash = (U32)(size_t)mpAnimation * 2654435761U;
+        hash ^= (U32)(size_t)mpSkin + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= (U32)mFrame + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= (U32)((mFlipX ? 1 : 0) | (mFlipY ? 2 : 0));
+        return hash;
+    }
+
+    bool operator==( const SkeletonPoseKey& key ) const
+    {
+        return  mpAnimation == key.mpAnimation &&
+                mpSkin == key.mpSkin &&
+                mFrame == key.mFrame &&
+                mFlipX == key.mFlipX &&
+                mFlipY == key.mFlipY &&
+                mRootScale == key.mRootScale &&
+                mRootOffset == key.mRootOffset;
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+/// An evaluated skeleton pose of region attachments in skeleton space.
+struct SkeletonPose
+{
+    SkeletonPoseKey         mKey;
+
+    /// The attachment name of each region attachment.
+    Vector<const char*>     mAttachments;
+
+    /// Four vertices for each region attachment.
+    Vector<Vector2>         mVertices;
+
+    /// The slot color of each region attachment.
+    Vector<ColorF>          mColors;
+
+    inline U32 getRegionCount( void ) const { return (U32)mAttachments.size(); }
+
+    void clear( void )
+    {
+        mAttachments.clear();
+        mVertices.clear();
+        mColors.clear();
+    }
+};
+
+//-----------------------------------------------------------------------------
+
 class SkeletonAsset : public AssetBase
 {
 private:
@@ -55,6 +124,10 @@ public:
     spSkeletonData*                 mSkeletonData;
     spAnimationStateData*           mStateData;
 
+private:
+    typedef HashMap<U32, SkeletonPose*> typePoseHash;
+    typePoseHash                    mPoseCache;
+
 public:
     SkeletonAsset();
     virtual ~SkeletonAsset();
@@ -73,6 +146,12 @@ public:
     
     virtual bool            isAssetValid( void ) const;
 
+    /// Pose cache.
+    const SkeletonPose*     findPose( const SkeletonPoseKey& key ) const;
+    SkeletonPose*           createPose( const SkeletonPoseKey& key );
+    void                    clearPoseCache( void );
+    inline U32              getPoseCacheCount( void ) const             { return (U32)mPoseCache.size(); }
+
     /// Declare Console Object.
     DECLARE_CONOBJECT(SkeletonAsset);
 
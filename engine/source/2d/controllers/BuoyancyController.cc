@@ -104,29 +104,19 @@ void BuoyancyController::copyTo(SimObject* object)
 
 void BuoyancyController::integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
 {
-    // Prepare query filter.
-    WorldQuery* pWorldQuery = prepareQueryFilter( pScene );
-
     // Query for candidate objects.
-    pWorldQuery->anyQueryAABB( mFluidArea ); 
-
-    // Fetch results.
-    typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+    const ControllerBodyGrid::typeResultVector& queryResults = queryControlledBodies( pScene, mFluidArea );
 
     // Iterate the results.
     for ( U32 n = 0; n < (U32)queryResults.size(); n++ )
     {
         // Fetch the scene object.
-        SceneObject* pSceneObject = queryResults[n].mpSceneObject;
+        SceneObject* pSceneObject = queryResults[n];
 
         // Skip if asleep.
         if ( !pSceneObject->getAwake() )
             continue;
 
-        // Ignore if it's a static body.
-        if ( pSceneObject->getBodyType() == b2_staticBody )
-            continue;
-
         // Fetch the shape count.
         const U32 shapeCount = pSceneObject->getCollisionShapeCount();
 
@@ -100,9 +100,6 @@ void PointForceController::integrate( Scene* pScene, const F32 totalTime, const
     if ( mIsZero( mForce ) || mIsZero( mRadius ) )
         return;
 
-    // Prepare query filter.
-    WorldQuery* pWorldQuery = prepareQueryFilter( pScene );
-
     // Fetch the current position.
     const Vector2 currentPosition = getCurrentPosition();
 
@@ -112,10 +109,7 @@ void PointForceController::integrate( Scene* pScene, const F32 totalTime, const
     aabb.upperBound.Set( currentPosition.x + mRadius, currentPosition.y + mRadius );
 
     // Query for candidate objects.
-    pWorldQuery->anyQueryAABB( aabb ); 
-
-    // Fetch results.
-    typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+    const ControllerBodyGrid::typeResultVector& queryResults = queryControlledBodies( pScene, aabb );
 
     // Fetch result count.
     const U32 resultCount = (U32)queryResults.size();
@@ -141,16 +135,12 @@ void PointForceController::integrate( Scene* pScene, const F32 totalTime, const
     for ( U32 n = 0; n < resultCount; n++ )
     {
         // Fetch the scene object.
-        SceneObject* pSceneObject = queryResults[n].mpSceneObject;
+        SceneObject* pSceneObject = queryResults[n];
 
         // Ignore if it's the tracked object.
         if ( pSceneObject == pTrackedObject )
             continue;
 
-        // Ignore if it's a static body.
-        if ( pSceneObject->getBodyType() == b2_staticBody )
-            continue;
-
         // Calculate the force distance to the controllers current position.
         Vector2 distanceForce = currentPosition - pSceneObject->getPosition();
 
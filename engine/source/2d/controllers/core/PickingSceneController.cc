@@ -77,3 +77,37 @@ WorldQuery* PickingSceneController::prepareQueryFilter( Scene* pScene, const boo
     return pWorldQuery;
 }
 
+//------------------------------------------------------------------------------
+
+const ControllerBodyGrid::typeResultVector& PickingSceneController::queryControlledBodies( Scene* pScene, const b2AABB& aabb )
+{
+    // Query the snapshot shared by all controllers this tick if there is one.
+    const ControllerBodyGrid* pBodyGrid = pScene->getControllerBodyGrid();
+    if ( pBodyGrid != NULL )
+    {
+        pBodyGrid->query( aabb, mControlLayerMask, mControlGroupMask, mControlledBodies );
+        return mControlledBodies;
+    }
+
+    // Prepare query filter.
+    WorldQuery* pWorldQuery = prepareQueryFilter( pScene );
+
+    // Query for candidate objects.
+    pWorldQuery->anyQueryAABB( aabb );
+
+    // Fetch results.
+    typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+
+    // Keep the non-static bodies.
+    mControlledBodies.clear();
+    for ( U32 n = 0; n < (U32)queryResults.size(); n++ )
+    {
+        SceneObject* pSceneObject = queryResults[n].mpSceneObject;
+
+        if ( pSceneObject->getBodyType() != b2_staticBody )
+            mControlledBodies.push_back( pSceneObject );
+    }
+
+    return mControlledBodies;
+}
+
@@ -48,6 +48,7 @@ class PickingSceneController : public SimObject, public SceneController
 private:
     U32 mControlGroupMask;
     U32 mControlLayerMask;
+    ControllerBodyGrid::typeResultVector mControlledBodies;
 
 public:
     PickingSceneController();
@@ -71,6 +72,9 @@ public:
 
 protected:
     WorldQuery* prepareQueryFilter( Scene* pScene, const bool clearQuery = true );
+
+    /// Fetch the non-static bodies overlapping the area, from the scene's per-tick body snapshot when it has one.
+    const ControllerBodyGrid::typeResultVector& queryControlledBodies( Scene* pScene, const b2AABB& aabb );
 };
 
 #endif // _PICKING_SCENE_CONTROLLER_H_
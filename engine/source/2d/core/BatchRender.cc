@@ -26,6 +26,10 @@
 #include "2d/sceneobject/SceneObject.h"
 #endif
 
+#ifndef _DGL_H_
+#include "graphics/dgl.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
@@ -362,6 +366,29 @@ void BatchRender::flush( void )
 
 //-----------------------------------------------------------------------------
 
+void BatchRender::discard( void )
+{
+    // Return index vectors to pool.
+    for( textureBatchType::iterator batchItr = mTextureBatchMap.begin(); batchItr != mTextureBatchMap.end(); ++batchItr )
+    {
+        indexVectorType* pIndexVector = batchItr->value;
+        pIndexVector->clear();
+        mIndexVectorPool.push_back( pIndexVector );
+    }
+
+    // Clear texture batch map.
+    mTextureBatchMap.clear();
+
+    // Reset batch state.
+    mTriangleCount = 0;
+    mVertexCount = 0;
+    mTextureCoordCount = 0;
+    mIndexCount = 0;
+    mColorCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+
 void BatchRender::flushInternal( void )
 {
     // Debug Profiling.
@@ -442,6 +469,7 @@ void BatchRender::flushInternal( void )
 
         // Draw the triangles
         glDrawElements( GL_TRIANGLES, mIndexCount, GL_UNSIGNED_SHORT, mIndexBuffer );
+        dglCountDrawCall();
 
         // Stats.
         mpDebugStats->batchDrawCallsStrict++;
@@ -523,6 +551,7 @@ void BatchRender::flushInternal( void )
 
             // Draw the triangles.
             glDrawElements( GL_TRIANGLES, mIndexCount, GL_UNSIGNED_SHORT, mIndexBuffer );
+            dglCountDrawCall();
 
             // Stats.
             mpDebugStats->batchDrawCallsSorted++;
@@ -564,6 +593,134 @@ void BatchRender::flushInternal( void )
 
 //-----------------------------------------------------------------------------
 
+void BatchRender::SubmitQuads(
+        const U32 quadCount,
+        const Vector2* pVertexArray,
+        const Vector2* pTextureArray,
+        TextureHandle& texture,
+        const ColorF& color )
+{
+    // Sanity!
+    AssertFatal( mpDebugStats != NULL, "Debug stats have not been configured." );
+    AssertFatal( pVertexArray != NULL && pTextureArray != NULL, "Cannot submit quads with NULL arrays." );
+
+    // Debug Profiling.
+    PROFILE_SCOPE(BatchRender_SubmitQuads);
+
+    // Finish if nothing to submit.
+    if ( quadCount == 0 )
+        return;
+
+    // Do we have anything batched?
+    if ( mTriangleCount > 0 )
+    {
+        // Yes, so flush if the color state changes.
+        if ( (mColorCount == 0) != (color == NoColor) )
+            flush( mpDebugStats->batchColorStateFlush );
+    }
+
+    // Strict order mode?
+    if ( mStrictOrderMode )
+    {
+        // Yes, so flush if there is a texture change.
+        if ( texture != mStrictOrderTextureHandle && mTriangleCount > 0 )
+            flush( mpDebugStats->batchTextureChangeFlush );
+
+        // Set strict order mode texture handle.
+        mStrictOrderTextureHandle = texture;
+    }
+
+    U32 quadsRemaining = quadCount;
+
+    while( quadsRemaining > 0 )
+    {
+        // Calculate how many quads fit into the remaining buffer space.
+        U32 quadSpace = (BATCHRENDER_MAXTRIANGLES - mTriangleCount) / 2;
+
+        // Flush if there's no space left.
+        if ( quadSpace == 0 )
+        {
+            flush( mpDebugStats->batchBufferFullFlush );
+            quadSpace = BATCHRENDER_MAXTRIANGLES / 2;
+
+            // Reassert the strict order texture after the flush.
+            if ( mStrictOrderMode )
+                mStrictOrderTextureHandle = texture;
+        }
+
+        // Fetch the quads to submit in this pass.
+        const U32 submitCount = getMin( quadsRemaining, quadSpace );
+
+        // Strict order mode?
+        if ( mStrictOrderMode )
+        {
+            // Yes, so add new indices.
+            for( U32 n = 0; n < submitCount; ++n )
+            {
+                const U16 vertexIndex = (U16)(mVertexCount + n*4);
+                mIndexBuffer[mIndexCount++] = vertexIndex;
+                mIndexBuffer[mIndexCount++] = vertexIndex+1;
+                mIndexBuffer[mIndexCount++] = vertexIndex+2;
+                mIndexBuffer[mIndexCount++] = vertexIndex+3;
+                mIndexBuffer[mIndexCount++] = vertexIndex+2;
+                mIndexBuffer[mIndexCount++] = vertexIndex+1;
+            }
+        }
+        else
+        {
+            // No, so add a single triangle run for all the quads.
+            findTextureBatch( texture )->push_back( TriangleRun( TriangleRun::QUAD, submitCount, mVertexCount ) );
+        }
+
+        // Is a color specified?
+        if ( color != NoColor )
+        {
+            // Yes, so add colors.
+            for( U32 n = 0; n < submitCount*4; ++n )
+                mColorBuffer[mColorCount++] = color;
+        }
+
+        // Add textured vertices.
+        // NOTE: We swap #2/#3 here.
+        for( U32 n = 0; n < submitCount; ++n )
+        {
+            mVertexBuffer[mVertexCount++] = pVertexArray[0];
+            mVertexBuffer[mVertexCount++] = pVertexArray[1];
+            mVertexBuffer[mVertexCount++] = pVertexArray[3];
+            mVertexBuffer[mVertexCount++] = pVertexArray[2];
+            mTextureBuffer[mTextureCoordCount++] = pTextureArray[0];
+            mTextureBuffer[mTextureCoordCount++] = pTextureArray[1];
+            mTextureBuffer[mTextureCoordCount++] = pTextureArray[3];
+            mTextureBuffer[mTextureCoordCount++] = pTextureArray[2];
+            pVertexArray += 4;
+            pTextureArray += 4;
+        }
+
+        // Stats.
+        mpDebugStats->batchTrianglesSubmitted += submitCount*2;
+
+        // Increase triangle count.
+        mTriangleCount += submitCount*2;
+
+        quadsRemaining -= submitCount;
+    }
+
+    // Have we reached the buffer limit?
+    if ( mTriangleCount >= BATCHRENDER_MAXTRIANGLES-1 )
+    {
+        // Yes, so flush.
+        flush( mpDebugStats->batchBufferFullFlush );
+    }
+    // Is batching enabled?
+    else if ( !mBatchEnabled )
+    {
+        // No, so flush immediately.
+        flushInternal();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 BatchRender::indexVectorType* BatchRender::findTextureBatch( TextureHandle& handle )
 {
     // Fetch texture binding.
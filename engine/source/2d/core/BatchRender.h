@@ -250,6 +250,15 @@ public:
             TextureHandle& texture,
             const ColorF& color = ColorF(-1.0f, -1.0f, -1.0f) );
 
+    /// Submit a run of quads sharing the same texture for batching.
+    /// Each quad uses four consecutive vertices and textures indexed as per "SubmitQuad()".
+    void SubmitQuads(
+            const U32 quadCount,
+            const Vector2* pVertexArray,
+            const Vector2* pTextureArray,
+            TextureHandle& texture,
+            const ColorF& color = ColorF(-1.0f, -1.0f, -1.0f) );
+
     /// Render a quad immediately without affecting current batch.
     /// All render state should be set beforehand directly.
     /// Vertex and textures are indexed as:
@@ -285,6 +294,9 @@ public:
     /// Flush (render) any pending batches.
     void flush( void );
 
+    /// Discard any pending batches without rendering them.
+    void discard( void );
+
 private:
     /// Flush (render) any pending batches.
     void flushInternal( void );
@@ -47,7 +47,7 @@
 
 //-----------------------------------------------------------------------------
 
-ImageFrameProviderCore::ImageFrameProviderCore() : mpImageAsset(NULL), mpAnimationAsset(NULL)
+ImageFrameProviderCore::ImageFrameProviderCore() : mpImageAsset(NULL), mpAnimationAsset(NULL), mUseSharedClock(false), mpSharedClock(NULL)
 {
 }
 
@@ -95,6 +95,7 @@ void ImageFrameProviderCore::resetState( void )
     mFrameIntegrationTime = 0.0f;
     mAnimationPaused = false;
     mAnimationFinished = true;
+    mUseSharedClock = false;
 
     clearAssets();
 }
@@ -109,6 +110,9 @@ void ImageFrameProviderCore::copyTo( ImageFrameProviderCore* pImageFrameProvider
     // Set self ticking.
     pImageFrameProviderCore->mSelfTick = mSelfTick;
 
+    // Set shared clock.
+    pImageFrameProviderCore->setSharedAnimationClock( mUseSharedClock );
+
     // Static provider?
     if ( isStaticFrameProvider() )
     {
@@ -417,10 +421,13 @@ const U32 ImageFrameProviderCore::getCurrentAnimationFrame( void ) const
     // Fetch validated frames.
     const Vector<S32>& validatedFrames = (*mpAnimationAsset)->getValidatedAnimationFrames();
 
+    // Fetch frame index.
+    const S32 frameIndex = getFrameIndex();
+
     // Sanity!
-    AssertFatal( mCurrentFrameIndex < validatedFrames.size(), "Animation controller requested the current frame but it is out of bounds of the validated frames." );
+    AssertFatal( frameIndex < validatedFrames.size(), "Animation controller requested the current frame but it is out of bounds of the validated frames." );
 
-    return validatedFrames[mCurrentFrameIndex];
+    return validatedFrames[frameIndex];
 };
 
 //-----------------------------------------------------------------------------
@@ -433,10 +440,13 @@ const char* ImageFrameProviderCore::getCurrentNamedAnimationFrame( void ) const
     // Fetch validated frames.
     const Vector<StringTableEntry>& validatedFrames = (*mpAnimationAsset)->getValidatedNamedAnimationFrames();
 
+    // Fetch frame index.
+    const S32 frameIndex = getFrameIndex();
+
     // Sanity!
-    AssertFatal( mCurrentFrameIndex < validatedFrames.size(), "Animation controller requested the current frame but it is out of bounds of the validated frames." );
+    AssertFatal( frameIndex < validatedFrames.size(), "Animation controller requested the current frame but it is out of bounds of the validated frames." );
 
-    return validatedFrames[mCurrentFrameIndex];
+    return validatedFrames[frameIndex];
 }
 
 //-----------------------------------------------------------------------------
@@ -455,7 +465,7 @@ bool ImageFrameProviderCore::isAnimationValid( void ) const
         validatedFrameSize = (*mpAnimationAsset)->getValidatedAnimationFrames().size();
 
     // Not valid if current frame index is out of bounds of the validated frames.
-    if ( mCurrentFrameIndex >= validatedFrameSize )
+    if ( getFrameIndex() >= validatedFrameSize )
         return false;
 
     // Fetch image asset.
@@ -528,6 +538,9 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
     // Stop animation.
     stopAnimation();
 
+    // Leave any shared clock.
+    releaseSharedClock();
+
     // Finish if no animation asset.
     if ( animationAsset.isNull() )
         return true;
@@ -562,8 +575,18 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
     // Calculate Frame Integration Time.
     mFrameIntegrationTime = mTotalIntegrationTime / validatedFrameSize;
 
+    // Join a shared clock if requested.  This fails for animations that don't cycle.
+    if ( mUseSharedClock )
+        mpSharedClock = SharedAnimationClock::acquire( *mpAnimationAsset, mAnimationTimeScale );
+
+    // Using a shared clock?
+    if ( mpSharedClock != NULL )
+    {
+        // Yes, so start in step with it.
+        mCurrentTime = mpSharedClock->getCurrentTime();
+    }
     // No, so random Start?
-    if ( (*mpAnimationAsset)->getRandomStart() )
+    else if ( (*mpAnimationAsset)->getRandomStart() )
     {
         // Yes, so calculate start time.
         mCurrentTime = CoreMath::mGetRandomF(0.0f, mTotalIntegrationTime*0.999f);
@@ -588,6 +611,22 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
 
 bool ImageFrameProviderCore::updateAnimation( const F32 elapsedTime )
 {
+    // Using a shared clock?
+    if ( mpSharedClock != NULL )
+    {
+        // Yes, so advance it.  Only the first provider to get here each tick does any work.
+        // A zero-time refresh just reads the current frame.
+        if ( elapsedTime > 0.0f )
+            mpSharedClock->advance( elapsedTime );
+
+        // Calculate if frame has changed.
+        const S32 frameIndex = mpSharedClock->getFrameIndex();
+        const bool frameChanged = (frameIndex != mLastFrameIndex);
+        mLastFrameIndex = frameIndex;
+
+        return frameChanged;
+    }
+
     // Debug Profiling.
     PROFILE_SCOPE(AnimationController_UpdateAnimation);
 
@@ -663,6 +702,14 @@ void ImageFrameProviderCore::setAnimationFrame( const U32 frameIndex )
         return;
     }
 
+    // Are we using a shared clock?
+    if ( mpSharedClock != NULL )
+    {
+        // Yes, so warn.
+        Con::warnf("ImageFrameProviderCore::setAnimationFrame() - Cannot set frame while using a shared animation clock (%s).", mpAnimationAsset->getAssetId() );
+        return;
+    }
+
     // Validate Frame Index?
     if ( (S32)frameIndex < 0 || frameIndex > mMaxFrameIndex )
     {
@@ -695,6 +742,75 @@ void ImageFrameProviderCore::clearAssets( void )
     mNamedImageFrame = StringTable->EmptyString;
     mStaticProvider = true;
     setProcessTicks( false );
+
+    // Leave any shared clock.
+    releaseSharedClock();
+}
+
+//------------------------------------------------------------------------------
+
+void ImageFrameProviderCore::setAnimationTimeScale( const F32 scale )
+{
+    mAnimationTimeScale = scale;
+
+    // Finish if not using a shared clock.
+    if ( mpSharedClock == NULL )
+        return;
+
+    // Move to the clock for the new time-scale.
+    releaseSharedClock();
+    mpSharedClock = SharedAnimationClock::acquire( *mpAnimationAsset, mAnimationTimeScale );
+}
+
+//------------------------------------------------------------------------------
+
+void ImageFrameProviderCore::pauseAnimation( const bool animationPaused )
+{
+    // Hold the shared frame while paused.
+    if ( animationPaused && !mAnimationPaused && mpSharedClock != NULL )
+    {
+        mCurrentTime = mpSharedClock->getCurrentTime();
+        mCurrentFrameIndex = mpSharedClock->getFrameIndex();
+    }
+
+    mAnimationPaused = animationPaused;
+}
+
+//------------------------------------------------------------------------------
+
+void ImageFrameProviderCore::setSharedAnimationClock( const bool sharedClock )
+{
+    mUseSharedClock = sharedClock;
+
+    if ( !sharedClock )
+    {
+        // Carry on from the shared time.
+        releaseSharedClock();
+        return;
+    }
+
+    // Join now if an animation is already playing.
+    if ( mpSharedClock == NULL && !isStaticFrameProvider() && !mAnimationFinished && mpAnimationAsset != NULL && mpAnimationAsset->notNull() )
+        mpSharedClock = SharedAnimationClock::acquire( *mpAnimationAsset, mAnimationTimeScale );
+}
+
+//------------------------------------------------------------------------------
+
+void ImageFrameProviderCore::releaseSharedClock( void )
+{
+    // Finish if not using a shared clock.
+    if ( mpSharedClock == NULL )
+        return;
+
+    // Keep the current frame.
+    if ( !mAnimationPaused )
+    {
+        mCurrentTime = mpSharedClock->getCurrentTime();
+        mCurrentFrameIndex = mpSharedClock->getFrameIndex();
+    }
+
+    SharedAnimationClock::release( mpSharedClock );
+    mpSharedClock = NULL;
 }
 
 //-----------------------------------------------------------------------------
@@ -31,6 +31,10 @@
 #include "2d/assets/AnimationAsset.h"
 #endif
 
+#ifndef _SHARED_ANIMATION_CLOCK_H_
+#include "2d/core/SharedAnimationClock.h"
+#endif
+
 #ifndef _TICKABLE_H_
 #include "platform/Tickable.h"
 #endif
@@ -82,12 +86,15 @@ protected:
     bool                                    mAnimationPaused;
     bool                                    mAnimationFinished;
 
+    bool                                    mUseSharedClock;
+    SharedAnimationClock*                   mpSharedClock;
+
 public:
     ImageFrameProviderCore();
     virtual ~ImageFrameProviderCore();
 
     void allocateAssets( AssetPtr<ImageAsset>* pImageAssetPtr, AssetPtr<AnimationAsset>* pAnimationAssetPtr );
-    inline void deallocateAssets( void ) { mpImageAsset = NULL; mpAnimationAsset = NULL; }
+    inline void deallocateAssets( void ) { releaseSharedClock(); mpImageAsset = NULL; mpAnimationAsset = NULL; }
 
     virtual void copyTo( ImageFrameProviderCore* pImageFrameProviderCore ) const;
 
@@ -126,17 +133,24 @@ public:
     virtual bool setAnimation( const char* pAnimationAssetId );
     inline StringTableEntry getAnimation( void ) const { return mpAnimationAsset->getAssetId(); }
     void setAnimationFrame( const U32 frameIndex );
-    inline S32 getAnimationFrame( void ) const { return mCurrentFrameIndex; }
-    void setAnimationTimeScale( const F32 scale ) { mAnimationTimeScale = scale; }
+    inline S32 getAnimationFrame( void ) const { return getFrameIndex(); }
+    void setAnimationTimeScale( const F32 scale );
     inline F32 getAnimationTimeScale( void ) const { return mAnimationTimeScale; }
     bool playAnimation( const AssetPtr<AnimationAsset>& animationAsset);
-    inline void pauseAnimation( const bool animationPaused ) { mAnimationPaused = animationPaused; }
+    void pauseAnimation( const bool animationPaused );
     inline void stopAnimation( void ) { mAnimationFinished = true; mAnimationPaused = false; }
     inline void resetAnimationTime( void ) { mCurrentTime = 0.0f; }
     inline bool isAnimationPaused( void ) const { return mAnimationPaused; }
     inline bool isAnimationFinished( void ) const { return mAnimationFinished; };
     bool isAnimationValid( void ) const;
 
+    /// Shared-clock animation.
+    /// When on, cycling animations are driven by a clock shared with every other provider playing
+    /// the same animation at the same time-scale, so all of them show the same frame.
+    void setSharedAnimationClock( const bool sharedClock );
+    inline bool getSharedAnimationClock( void ) const { return mUseSharedClock; }
+    inline bool isUsingSharedAnimationClock( void ) const { return mpSharedClock != NULL; }
+
     /// Frame provision.
     inline bool isStaticFrameProvider( void ) const { return mStaticProvider; }
     inline bool isUsingNamedImageFrame( void ) const { return mUsingNamedFrame; }
@@ -146,13 +160,16 @@ public:
     inline const StringTableEntry getCurrentAnimationAssetId( void ) const { return mpAnimationAsset->getAssetId(); };
     const U32 getCurrentAnimationFrame( void ) const;
     const char* getCurrentNamedAnimationFrame( void ) const;
-    inline const F32 getCurrentAnimationTime( void ) const { return mCurrentTime; };
+    inline const F32 getCurrentAnimationTime( void ) const { return mpSharedClock != NULL && !mAnimationPaused ? mpSharedClock->getCurrentTime() : mCurrentTime; };
 
     void clearAssets( void );
 
     virtual void resetState( void );
 
 protected:
+    inline S32 getFrameIndex( void ) const { return mpSharedClock != NULL && !mAnimationPaused ? mpSharedClock->getFrameIndex() : mCurrentFrameIndex; }
+    void releaseSharedClock( void );
+
     virtual void onAnimationEnd( void ) {}
     virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 };
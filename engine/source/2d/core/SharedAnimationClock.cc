@@ -0,0 +1,165 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "2d/core/SharedAnimationClock.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+Vector<SharedAnimationClock*> SharedAnimationClock::smClocks;
+
+//-----------------------------------------------------------------------------
+
+SharedAnimationClock::SharedAnimationClock( const AssetPtr<AnimationAsset>& animationAsset, const F32 timeScale ) :
+    mAnimationAssetId( animationAsset.getAssetId() ),
+    mTimeScale( timeScale ),
+    mCurrentTime( 0.0f ),
+    mCurrentFrameIndex( 0 ),
+    mTotalIntegrationTime( 0.0f ),
+    mFrameIntegrationTime( 0.0f ),
+    mLastTick( U32_MAX ),
+    mReferenceCount( 0 )
+{
+    mAnimationAsset = animationAsset;
+}
+
+//-----------------------------------------------------------------------------
+
+SharedAnimationClock::SharedAnimationClock( const F32 totalIntegrationTime, const U32 frameCount, const F32 timeScale ) :
+    mAnimationAssetId( StringTable->EmptyString ),
+    mTimeScale( timeScale ),
+    mCurrentTime( 0.0f ),
+    mCurrentFrameIndex( 0 ),
+    mTotalIntegrationTime( totalIntegrationTime ),
+    mFrameIntegrationTime( frameCount > 0 ? totalIntegrationTime / frameCount : 0.0f ),
+    mLastTick( U32_MAX ),
+    mReferenceCount( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+SharedAnimationClock* SharedAnimationClock::acquire( const AssetPtr<AnimationAsset>& animationAsset, const F32 timeScale )
+{
+    // Finish if there's no animation or it doesn't cycle.
+    if ( animationAsset.isNull() || !animationAsset->getAnimationCycle() )
+        return NULL;
+
+    const StringTableEntry assetId = animationAsset.getAssetId();
+
+    // Find an existing clock.
+    SharedAnimationClock* pClock = NULL;
+    for( Vector<SharedAnimationClock*>::iterator itr = smClocks.begin(); itr != smClocks.end(); ++itr )
+    {
+        if ( (*itr)->mAnimationAssetId == assetId && mIsEqual( (*itr)->mTimeScale, timeScale ) )
+        {
+            pClock = *itr;
+            break;
+        }
+    }
+
+    // Create a clock if not found.
+    const bool created = pClock == NULL;
+    if ( created )
+        pClock = new SharedAnimationClock( animationAsset, timeScale );
+
+    // Pick up any change to the animation.
+    pClock->refresh();
+
+    // Finish if the animation has no frames.
+    if ( mIsZero( pClock->mFrameIntegrationTime ) )
+    {
+        if ( created )
+            delete pClock;
+
+        return NULL;
+    }
+
+    if ( created )
+        smClocks.push_back( pClock );
+
+    pClock->mReferenceCount++;
+
+    return pClock;
+}
+
+//-----------------------------------------------------------------------------
+
+void SharedAnimationClock::release( SharedAnimationClock* pClock )
+{
+    // Sanity!
+    AssertFatal( pClock != NULL && pClock->mReferenceCount > 0, "SharedAnimationClock::release() - Invalid clock." );
+
+    if ( --pClock->mReferenceCount > 0 )
+        return;
+
+    for( S32 index = 0; index < smClocks.size(); ++index )
+    {
+        if ( smClocks[index] == pClock )
+        {
+            smClocks.erase_fast( index );
+            break;
+        }
+    }
+
+    delete pClock;
+}
+
+//-----------------------------------------------------------------------------
+
+void SharedAnimationClock::refresh( void )
+{
+    // Finish if there's no animation to track.
+    if ( mAnimationAsset.isNull() )
+        return;
+
+    // Fetch the validated frame count.
+    const U32 validatedFrameSize = mAnimationAsset->getNamedCellsMode() ?
+        mAnimationAsset->getValidatedNamedAnimationFrames().size() :
+        mAnimationAsset->getValidatedAnimationFrames().size();
+
+    mTotalIntegrationTime = mAnimationAsset->getAnimationTime();
+    mFrameIntegrationTime = validatedFrameSize > 0 ? mTotalIntegrationTime / validatedFrameSize : 0.0f;
+
+    // Keep the current frame in range.
+    advanceTime( 0.0f );
+}
+
+//-----------------------------------------------------------------------------
+
+void SharedAnimationClock::advanceTime( const F32 elapsedTime )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SharedAnimationClock_AdvanceTime);
+
+    // Finish if there are no frames.
+    if ( mIsZero( mFrameIntegrationTime ) )
+        return;
+
+    // Update current time, keeping it within the cycle.
+    mCurrentTime = mFmod( mCurrentTime + elapsedTime * mTimeScale, mTotalIntegrationTime );
+
+    // Calculate current frame.
+    mCurrentFrameIndex = (S32)(mCurrentTime / mFrameIntegrationTime);
+}
@@ -0,0 +1,101 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SHARED_ANIMATION_CLOCK_H_
+#define _SHARED_ANIMATION_CLOCK_H_
+
+#ifndef _ANIMATION_ASSET_H_
+#include "2d/assets/AnimationAsset.h"
+#endif
+
+#ifndef _ASSET_PTR_H_
+#include "assets/assetPtr.h"
+#endif
+
+#ifndef _TICKABLE_H_
+#include "platform/Tickable.h"
+#endif
+
+///-----------------------------------------------------------------------------
+
+/// An animation clock shared by every frame provider playing the same cycling
+/// animation at the same time-scale.
+///
+/// The first subscriber to update in a tick advances the clock; everyone else
+/// just reads the frame index, so thousands of identical animated sprites cost
+/// one animation update per tick. All subscribers show the same frame.
+class SharedAnimationClock
+{
+private:
+    StringTableEntry                        mAnimationAssetId;
+    AssetPtr<AnimationAsset>                mAnimationAsset;
+    F32                                     mTimeScale;
+
+    F32                                     mCurrentTime;
+    S32                                     mCurrentFrameIndex;
+    F32                                     mTotalIntegrationTime;
+    F32                                     mFrameIntegrationTime;
+
+    /// Tick that last advanced the clock.  U32_MAX is never a tick time so it means none yet.
+    U32                                     mLastTick;
+    U32                                     mReferenceCount;
+
+    static Vector<SharedAnimationClock*>    smClocks;
+
+    SharedAnimationClock( const AssetPtr<AnimationAsset>& animationAsset, const F32 timeScale );
+
+    void refresh( void );
+    void advanceTime( const F32 elapsedTime );
+
+public:
+    /// Create an unshared clock over a fixed cycle of frames, independent of any asset.
+    SharedAnimationClock( const F32 totalIntegrationTime, const U32 frameCount, const F32 timeScale );
+    ~SharedAnimationClock() {}
+
+    /// Fetch the clock for an animation and time-scale, creating it if needed.
+    /// Returns NULL if the animation cannot be shared (it doesn't cycle or has no frames).
+    static SharedAnimationClock* acquire( const AssetPtr<AnimationAsset>& animationAsset, const F32 timeScale );
+    static void release( SharedAnimationClock* pClock );
+
+    /// Advance the clock, at most once per tick.
+    inline void advance( const F32 elapsedTime ) { advance( elapsedTime, Tickable::getLastTick() ); }
+
+    /// Advance the clock for the specified tick, at most once per tick.
+    /// A zero-time refresh never claims the tick so it can't stop the real advance.
+    inline void advance( const F32 elapsedTime, const U32 tick )
+    {
+        if ( elapsedTime <= 0.0f || mLastTick == tick )
+            return;
+
+        mLastTick = tick;
+        advanceTime( elapsedTime );
+    }
+
+    inline S32 getFrameIndex( void ) const { return mCurrentFrameIndex; }
+    inline F32 getCurrentTime( void ) const { return mCurrentTime; }
+    inline F32 getTimeScale( void ) const { return mTimeScale; }
+    inline U32 getReferenceCount( void ) const { return mReferenceCount; }
+
+    static inline U32 getClockCount( void ) { return smClocks.size(); }
+};
+
+#endif // _SHARED_ANIMATION_CLOCK_H_
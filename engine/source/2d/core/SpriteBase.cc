@@ -58,6 +58,7 @@ void SpriteBase::initPersistFields()
     addProtectedField("Frame", TypeS32, Offset(mImageFrame, SpriteBase), &setImageFrame, &defaultProtectedGetFn, &writeImageFrame, "");
     addProtectedField("NamedFrame", TypeString, Offset(mNamedImageFrame, SpriteBase), &setNamedImageFrame, &defaultProtectedGetFn, &writeNamedImageFrame, "");
     addProtectedField("Animation", TypeAnimationAssetPtr, Offset(mAnimationAsset, SpriteBase), &setAnimation, &getAnimation, &writeAnimation, "");
+    addProtectedField("SharedAnimationClock", TypeBool, Offset(mUseSharedClock, SpriteBase), &setSharedAnimationClock, &defaultProtectedGetFn, &writeSharedAnimationClock, "Whether a cycling animation is driven by a clock shared with every other sprite playing it at the same time-scale.");
 }
 
 //-----------------------------------------------------------------------------
@@ -67,6 +67,8 @@ protected:
     static bool setAnimation(void* obj, const char* data)                       { DYNAMIC_VOID_CAST_TO(SpriteBase, ImageFrameProvider, obj)->setAnimation(data); return false; };
     static const char* getAnimation(void* obj, const char* data)                { return DYNAMIC_VOID_CAST_TO(SpriteBase, ImageFrameProvider, obj)->getAnimation(); }
     static bool writeAnimation( void* obj, StringTableEntry pFieldName )        { SpriteBase* pCastObject = static_cast<SpriteBase*>(obj); if ( pCastObject->isStaticFrameProvider() ) return false; return pCastObject->mAnimationAsset.notNull(); }
+    static bool setSharedAnimationClock(void* obj, const char* data)            { DYNAMIC_VOID_CAST_TO(SpriteBase, ImageFrameProvider, obj)->setSharedAnimationClock(dAtob(data)); return false; };
+    static bool writeSharedAnimationClock( void* obj, StringTableEntry pFieldName ) { return static_cast<SpriteBase*>(obj)->getSharedAnimationClock(); }
 };
 
 #endif // _SPRITE_BASE_H_
@@ -427,4 +427,28 @@ ConsoleMethodWithDocs(SpriteBase, getAnimationTimeScale, ConsoleFloat, 2, 2, ())
     return object->getAnimationTimeScale();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the animation is driven by a shared clock.
+    Every sprite playing the same cycling animation at the same time-scale with this on shows the same frame,
+    and the animation is only advanced once per tick for all of them. Use this for large numbers of identical
+    animated sprites. Animations that don't cycle always use their own clock.
+    @param sharedClock Whether to use a shared animation clock. False by default.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SpriteBase, setSharedAnimationClock, ConsoleVoid, 3, 3, (bool sharedClock))
+{
+    static_cast<ImageFrameProvider*>(object)->setSharedAnimationClock(dAtob(argv[2]));
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the animation is driven by a shared clock.
+    @return (bool) Whether a shared animation clock is requested.
+*/
+ConsoleMethodWithDocs(SpriteBase, getSharedAnimationClock, ConsoleBool, 2, 2, ())
+{
+    return object->getSharedAnimationClock();
+}
+
 ConsoleMethodGroupEndWithDocs(SpriteBase)
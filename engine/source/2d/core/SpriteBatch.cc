@@ -46,7 +46,10 @@ SpriteBatch::SpriteBatch() :
     mDefaultSpriteSize( 1.0f, 1.0f ),
     mDefaultSpriteAngle( 0.0f ),
     mpSpriteBatchQuery( NULL ),
-    mBatchCulling( true )
+    mBatchCulling( true ),
+    mBatchStatic( false ),
+    mBatchCullingGrid( false ),
+    mBatchCullingGridDirty( true )
 {
     // Reset batch transform.
     mBatchTransform.SetIdentity();
@@ -56,12 +59,18 @@ SpriteBatch::SpriteBatch() :
     // Reset local extents.
     mLocalExtents.SetZero();
     mLocalExtentsDirty = true;
+
+    // Reset static batch.
+    mStaticBatchDirty = true;
+    mStaticBatchTransformId = 0;
 }
 
 //------------------------------------------------------------------------------
 
 SpriteBatch::~SpriteBatch()
 {
+    // Destroy any static batch.
+    destroyStaticBatch();
 }
 
 //-----------------------------------------------------------------------------
@@ -84,6 +93,9 @@ void SpriteBatch::onRemove()
 
     // Delete the sprite batch query.
     destroySpriteBatchQuery();
+
+    // Destroy any static batch.
+    destroyStaticBatch();
 }
 
 //-----------------------------------------------------------------------------
@@ -99,6 +111,14 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
     // Calculate local AABB.
     const b2AABB localAABB = calculateLocalAABB( pSceneRenderState->mRenderAABB );
 
+    // Is the batch static and unsorted?
+    if ( mBatchStatic && getBatchSortMode() == SceneRenderQueue::RENDER_SORT_OFF )
+    {
+        // Yes, so render from the static batch cells.
+        prepareStaticRender( pSceneRenderObject, localAABB, pSceneRenderQueue );
+        return;
+    }
+
     // Do we have a sprite batch query?
     if ( mpSpriteBatchQuery != NULL )
     {
@@ -181,6 +201,14 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
 
 void SpriteBatch::render( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
 {
+    // Is this a static batch cell?
+    if ( pSceneRenderRequest->mpCustomData2 != NULL )
+    {
+        // Yes, so render the static batch cell.
+        renderStaticCell( (const StaticBatchCell*)pSceneRenderRequest->mpCustomData2, pBatchRenderer );
+        return;
+    }
+
     // Fetch sprite batch Item.
     SpriteBatchItem* pSpriteBatchItem = (SpriteBatchItem*)pSceneRenderRequest->mpCustomData1;
 
@@ -202,8 +230,15 @@ void SpriteBatch::createQueryProxy( SpriteBatchItem* pSpriteBatchItem )
     if ( mpSpriteBatchQuery == NULL )
         return;
 
-    // Create proxy.
-    pSpriteBatchItem->mProxyId = mpSpriteBatchQuery->add( pSpriteBatchItem );    
+    // Defer the proxy until the query is next used.
+    // NOTE: This lets a batch that is rebuilt with many sprites build its query tree in one pass.
+    pSpriteBatchItem->mProxyId = PENDING_SPRITE_PROXY;
+
+    // Flag the culling grid as dirty or queue the proxy.
+    if ( mBatchCullingGrid )
+        mBatchCullingGridDirty = true;
+    else
+        mPendingQueryProxies.push_back( pSpriteBatchItem );
 }
 
 //------------------------------------------------------------------------------
@@ -220,8 +255,25 @@ void SpriteBatch::destroyQueryProxy( SpriteBatchItem* pSpriteBatchItem )
     if ( mpSpriteBatchQuery == NULL )
         return;
 
-    // Destroy proxy.
-    mpSpriteBatchQuery->remove( pSpriteBatchItem );
+    // Is the batch using a culling grid?
+    if ( mBatchCullingGrid )
+    {
+        // Yes, so flag the culling grid as dirty.
+        mBatchCullingGridDirty = true;
+    }
+    // Is the proxy pending?
+    else if ( pSpriteBatchItem->getProxyId() == PENDING_SPRITE_PROXY )
+    {
+        // Yes, so remove it from the pending proxies.
+        const S32 pendingIndex = mPendingQueryProxies.find_next( pSpriteBatchItem );
+        if ( pendingIndex >= 0 )
+            mPendingQueryProxies.erase_fast( (U32)pendingIndex );
+    }
+    else
+    {
+        // No, so destroy proxy.
+        mpSpriteBatchQuery->remove( pSpriteBatchItem );
+    }
 
     // Remove proxy reference.
     pSpriteBatchItem->mProxyId = INVALID_SPRITE_PROXY;
@@ -241,6 +293,17 @@ void SpriteBatch::moveQueryProxy( SpriteBatchItem* pSpriteBatchItem, const b2AAB
     if ( mpSpriteBatchQuery == NULL || pSpriteBatchItem->getProxyId() == INVALID_SPRITE_PROXY )
         return;
 
+    // Flag the culling grid as dirty if the batch is using one.
+    if ( mBatchCullingGrid )
+    {
+        mBatchCullingGridDirty = true;
+        return;
+    }
+
+    // Finish if the proxy is pending as it is created with the current bounds.
+    if ( pSpriteBatchItem->getProxyId() == PENDING_SPRITE_PROXY )
+        return;
+
     // Move proxy.
     mpSpriteBatchQuery->update( pSpriteBatchItem, localAABB, b2Vec2(0.0f, 0.0f) );
 }
@@ -252,6 +315,9 @@ SpriteBatchQuery* SpriteBatch::getSpriteBatchQuery( const bool clearQuery )
     if ( mpSpriteBatchQuery == NULL )
         return NULL;
 
+    // Bring the query up-to-date.
+    updateSpriteBatchQuery();
+
     // Clear the query if specified.
     if ( clearQuery )
         mpSpriteBatchQuery->clearQuery();
@@ -274,6 +340,10 @@ void SpriteBatch::copyTo( SpriteBatch* pSpriteBatch ) const
 
     // Set batch culling.
     pSpriteBatch->setBatchCulling( getBatchCulling() );
+    pSpriteBatch->setBatchCullingGrid( getBatchCullingGrid() );
+
+    // Set batch static.
+    pSpriteBatch->setBatchStatic( getBatchStatic() );
 
     // Set sprite default size and angle.
     pSpriteBatch->setDefaultSpriteStride( getDefaultSpriteStride() );
@@ -370,6 +440,10 @@ void SpriteBatch::clearSprites( void )
     // Clear sprite names.
     mSpriteNames.clear();
 
+    // Discard the sprite batch query rather than removing each proxy from it.
+    const bool hasSpriteBatchQuery = mpSpriteBatchQuery != NULL;
+    destroySpriteBatchQuery();
+
     // Cache all sprites.
     for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {
@@ -378,8 +452,15 @@ void SpriteBatch::clearSprites( void )
     mSprites.clear();
     mMasterBatchId = 0;
 
+    // Recreate the sprite batch query if we had one.
+    if ( hasSpriteBatchQuery )
+        createSpriteBatchQuery();
+
     // Flag local extents as dirty.
     setLocalExtentsDirty();
+
+    // Destroy any static batch.
+    destroyStaticBatch();
 }
 
 //------------------------------------------------------------------------------
@@ -402,6 +483,42 @@ void SpriteBatch::setBatchCulling( const bool batchCulling )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::setBatchCullingGrid( const bool batchCullingGrid )
+{
+    // Finish if no change.
+    if ( mBatchCullingGrid == batchCullingGrid )
+        return;
+
+    // Set batch culling grid.
+    mBatchCullingGrid = batchCullingGrid;
+
+    // Finish if there is no sprite batch query.
+    if ( mpSpriteBatchQuery == NULL )
+        return;
+
+    // Recreate the sprite batch query with the new index.
+    destroySpriteBatchQuery();
+    createSpriteBatchQuery();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::setBatchStatic( const bool batchStatic )
+{
+    // Finish if no change.
+    if ( mBatchStatic == batchStatic )
+        return;
+
+    // Set batch static.
+    mBatchStatic = batchStatic;
+
+    // Destroy any static batch.
+    // NOTE: The static batch is built lazily when next rendered.
+    destroyStaticBatch();
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::selectSprite( const SpriteBatchItem::LogicalPosition& logicalPosition )
 {
     // Select sprite.
@@ -595,6 +712,30 @@ StringTableEntry SpriteBatch::getSpriteAnimation( void ) const
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::setSpriteSharedAnimationClock( const bool sharedClock )
+{
+    // Finish if a sprite is not selected.
+    if ( !checkSpriteSelected() )
+        return;
+
+    // Set shared animation clock.
+    mSelectedSprite->setSharedAnimationClock( sharedClock );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatch::getSpriteSharedAnimationClock( void ) const
+{
+    // Finish if a sprite is not selected.
+    if ( !checkSpriteSelected() )
+        return false;
+
+    // Get shared animation clock.
+    return mSelectedSprite->getSharedAnimationClock();
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatch::clearSpriteAsset( void )
 {
     // Finish if a sprite is not selected.
@@ -603,6 +744,9 @@ void SpriteBatch::clearSpriteAsset( void )
 
     // Clear the asset.
     mSelectedSprite->clearAssets();
+
+    // Flag static batch as dirty.
+    setStaticBatchDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -1215,6 +1359,231 @@ SpriteBatchItem* SpriteBatch::createSprite( const SpriteBatchItem::LogicalPositi
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::buildStaticBatch( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_BuildStaticBatch);
+
+    // Destroy any existing static batch.
+    destroyStaticBatch();
+
+    // Calculate the cell size.
+    const F32 cellSizeX = getMax( mFabs(mDefaultSpriteStride.x), b2_linearSlop ) * SPRITEBATCH_STATIC_CELL_SPRITES;
+    const F32 cellSizeY = getMax( mFabs(mDefaultSpriteStride.y), b2_linearSlop ) * SPRITEBATCH_STATIC_CELL_SPRITES;
+
+    // Map of cell keys to cells.
+    typedef HashMap< U32, StaticBatchCell* > typeStaticBatchCellHash;
+    typeStaticBatchCellHash cellMap;
+
+    // Iterate the sprites.
+    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    {
+        // Fetch sprite batch item.
+        SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+
+        // Skip if not visible or can't render.
+        if ( !pSpriteBatchItem->getVisible() || !pSpriteBatchItem->validRender() )
+            continue;
+
+        // Is the sprite animated?
+        if ( !pSpriteBatchItem->isStaticFrameProvider() )
+        {
+            // Yes, so it is rendered individually.
+            mStaticBatchDynamicItems.push_back( pSpriteBatchItem );
+            continue;
+        }
+
+        // Update the world transform.
+        pSpriteBatchItem->updateWorldTransform( mBatchTransformId );
+
+        // Fetch local AABB.
+        const b2AABB& localAABB = pSpriteBatchItem->getLocalAABB();
+        const b2Vec2 localCenter = localAABB.GetCenter();
+
+        // Calculate the cell key.
+        const S32 cellX = (S32)mFloor( localCenter.x / cellSizeX );
+        const S32 cellY = (S32)mFloor( localCenter.y / cellSizeY );
+        const U32 cellKey = ((U32)(cellX & 0xFFFF) << 16) | (U32)(cellY & 0xFFFF);
+
+        // Find the cell.
+        StaticBatchCell* pStaticBatchCell;
+        typeStaticBatchCellHash::iterator cellItr = cellMap.find( cellKey );
+        if ( cellItr == cellMap.end() )
+        {
+            // Not found so create it.
+            pStaticBatchCell = new StaticBatchCell();
+            pStaticBatchCell->mLocalAABB = localAABB;
+            pStaticBatchCell->mpFirstItem = pSpriteBatchItem;
+            cellMap.insert( cellKey, pStaticBatchCell );
+            mStaticBatchCells.push_back( pStaticBatchCell );
+        }
+        else
+        {
+            // Found so combine the cell bounds.
+            pStaticBatchCell = cellItr->value;
+            pStaticBatchCell->mLocalAABB.Combine( localAABB );
+        }
+
+        // Fetch the quad index.
+        const U32 quadIndex = (U32)pStaticBatchCell->mVertices.size() / 4;
+
+        // Can we extend the last run?
+        Vector<StaticQuadRun>& runs = pStaticBatchCell->mRuns;
+        const SpriteBatchItem* pStateItem = runs.size() == 0 ? NULL : runs.last().mpStateItem;
+        if (    pStateItem != NULL &&
+                pStateItem->getProviderTexture() == pSpriteBatchItem->getProviderTexture() &&
+                pStateItem->getBlendMode() == pSpriteBatchItem->getBlendMode() &&
+                pStateItem->getSrcBlendFactor() == pSpriteBatchItem->getSrcBlendFactor() &&
+                pStateItem->getDstBlendFactor() == pSpriteBatchItem->getDstBlendFactor() &&
+                pStateItem->getBlendColor() == pSpriteBatchItem->getBlendColor() &&
+                mIsEqual( pStateItem->getAlphaTest(), pSpriteBatchItem->getAlphaTest() ) )
+        {
+            // Yes, so extend it.
+            runs.last().mQuadCount++;
+        }
+        else
+        {
+            // No, so start a new run.
+            StaticQuadRun quadRun;
+            quadRun.mpStateItem = pSpriteBatchItem;
+            quadRun.mQuadStart = quadIndex;
+            quadRun.mQuadCount = 1;
+            runs.push_back( quadRun );
+        }
+
+        // Fetch texel area.
+        ImageAsset::FrameArea::TexelArea texelArea = pSpriteBatchItem->getProviderImageFrameArea().mTexelArea;
+
+        // Flip texture coordinates appropriately.
+        texelArea.setFlip( pSpriteBatchItem->getFlipX(), pSpriteBatchItem->getFlipY() );
+
+        // Fetch lower/upper texture coordinates.
+        const Vector2& texLower = texelArea.mTexelLower;
+        const Vector2& texUpper = texelArea.mTexelUpper;
+
+        // Cache the world-space quad.
+        const Vector2* pRenderOOBB = pSpriteBatchItem->getRenderOOBB();
+        for ( U32 n = 0; n < 4; ++n )
+            pStaticBatchCell->mVertices.push_back( pRenderOOBB[n] );
+        pStaticBatchCell->mTexCoords.push_back( Vector2( texLower.x, texUpper.y ) );
+        pStaticBatchCell->mTexCoords.push_back( Vector2( texUpper.x, texUpper.y ) );
+        pStaticBatchCell->mTexCoords.push_back( Vector2( texUpper.x, texLower.y ) );
+        pStaticBatchCell->mTexCoords.push_back( Vector2( texLower.x, texLower.y ) );
+    }
+
+    // Flag static batch as NOT dirty.
+    mStaticBatchDirty = false;
+    mStaticBatchTransformId = mBatchTransformId;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::destroyStaticBatch( void )
+{
+    // Delete the static batch cells.
+    for( typeStaticBatchCellVector::iterator cellItr = mStaticBatchCells.begin(); cellItr != mStaticBatchCells.end(); ++cellItr )
+    {
+        delete *cellItr;
+    }
+    mStaticBatchCells.clear();
+    mStaticBatchDynamicItems.clear();
+
+    // Flag static batch as dirty.
+    mStaticBatchDirty = true;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::prepareStaticRender( SceneRenderObject* pSceneRenderObject, const b2AABB& localAABB, SceneRenderQueue* pSceneRenderQueue )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_PrepareStaticRender);
+
+    // Rebuild the static batch if it's dirty or the batch has moved.
+    if ( mStaticBatchDirty || mStaticBatchTransformId != mBatchTransformId )
+        buildStaticBatch();
+
+    // Add visible cells.
+    for( typeStaticBatchCellVector::iterator cellItr = mStaticBatchCells.begin(); cellItr != mStaticBatchCells.end(); ++cellItr )
+    {
+        // Fetch static batch cell.
+        StaticBatchCell* pStaticBatchCell = *cellItr;
+
+        // Skip if not in view.
+        if ( !b2TestOverlap( localAABB, pStaticBatchCell->mLocalAABB ) )
+            continue;
+
+        // Create a render request.
+        SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest();
+
+        // Prepare using the first item in the cell.
+        pStaticBatchCell->mpFirstItem->prepareRender( pSceneRenderRequest, mBatchTransformId );
+
+        // Set identity.
+        pSceneRenderRequest->mpSceneRenderObject = pSceneRenderObject;
+
+        // Set custom data.
+        pSceneRenderRequest->mpCustomData1 = pStaticBatchCell->mpFirstItem;
+        pSceneRenderRequest->mpCustomData2 = pStaticBatchCell;
+    }
+
+    // Add visible animated sprites.
+    for( typeSpriteBatchItemVector::iterator itemItr = mStaticBatchDynamicItems.begin(); itemItr != mStaticBatchDynamicItems.end(); ++itemItr )
+    {
+        // Fetch sprite batch item.
+        SpriteBatchItem* pSpriteBatchItem = *itemItr;
+
+        // Skip if not in view.
+        if ( !b2TestOverlap( localAABB, pSpriteBatchItem->getLocalAABB() ) )
+            continue;
+
+        // Create a render request.
+        SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest();
+
+        // Prepare batch item.
+        pSpriteBatchItem->prepareRender( pSceneRenderRequest, mBatchTransformId );
+
+        // Set identity.
+        pSceneRenderRequest->mpSceneRenderObject = pSceneRenderObject;
+
+        // Set custom data.
+        pSceneRenderRequest->mpCustomData1 = pSpriteBatchItem;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::renderStaticCell( const StaticBatchCell* pStaticBatchCell, BatchRender* pBatchRenderer )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_RenderStaticCell);
+
+    // Fetch cached quads.
+    const Vector2* pVertices = pStaticBatchCell->mVertices.address();
+    const Vector2* pTexCoords = pStaticBatchCell->mTexCoords.address();
+
+    // Submit the runs.
+    for( Vector<StaticQuadRun>::const_iterator runItr = pStaticBatchCell->mRuns.begin(); runItr != pStaticBatchCell->mRuns.end(); ++runItr )
+    {
+        // Fetch the state item.
+        SpriteBatchItem* pStateItem = runItr->mpStateItem;
+
+        // Set the blend mode.
+        if ( pStateItem->getBlendMode() )
+            pBatchRenderer->setBlendMode( pStateItem->getSrcBlendFactor(), pStateItem->getDstBlendFactor(), pStateItem->getBlendColor() );
+        else
+            pBatchRenderer->setBlendOff();
+
+        // Set the alpha test mode.
+        pBatchRenderer->setAlphaTestMode( pStateItem->getAlphaTest() );
+
+        // Submit the quads.
+        pBatchRenderer->SubmitQuads( runItr->mQuadCount, pVertices + runItr->mQuadStart*4, pTexCoords + runItr->mQuadStart*4, pStateItem->getProviderTexture() );
+    }
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatch::setBatchTransform( const b2Transform& batchTransform )
 {
     // Update world transform.
@@ -1286,6 +1655,7 @@ void SpriteBatch::createSpriteBatchQuery( void )
 
     // Set the sprite batch query appropriately.
     mpSpriteBatchQuery = new SpriteBatchQuery( this );
+    mBatchCullingGridDirty = true;
 
     // Finish if there are no sprites.
     if ( mSprites.size() == 0 )
@@ -1313,16 +1683,13 @@ void SpriteBatch::destroySpriteBatchQuery( void )
     if ( mpSpriteBatchQuery == NULL )
         return;
 
-    // Are there any sprites?
-    if ( mSprites.size() > 0 )
+    // Detach all the sprites from their proxies.
+    // NOTE: The proxies are discarded with the query so there is no need to remove them individually.
+    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {
-        // Yes, so destroy proxies of all the sprites.
-        for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
-        {
-            // Destroy query proxy for sprite.
-            destroyQueryProxy( spriteItr->value );
-        }
+        spriteItr->value->mProxyId = INVALID_SPRITE_PROXY;
     }
+    mPendingQueryProxies.clear();
 
     // Finish if sprite clipping 
     delete mpSpriteBatchQuery;
@@ -1331,6 +1698,80 @@ void SpriteBatch::destroySpriteBatchQuery( void )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::updateSpriteBatchQuery( void )
+{
+    // Finish if there is no sprite batch query.
+    if ( mpSpriteBatchQuery == NULL )
+        return;
+
+    // Is the batch using a culling grid?
+    if ( mBatchCullingGrid )
+    {
+        // Yes, so use the default sprite stride as the cell size.
+        const Vector2 cellSize( mDefaultSpriteStride.x > 0.0f ? mDefaultSpriteStride.x : 1.0f, mDefaultSpriteStride.y > 0.0f ? mDefaultSpriteStride.y : 1.0f );
+
+        // Finish if the culling grid is up-to-date.
+        if ( !mBatchCullingGridDirty && mpSpriteBatchQuery->getGridCellSize().isEqual( cellSize ) )
+            return;
+
+        // Debug Profiling.
+        PROFILE_SCOPE(SpriteBatch_BuildCullingGrid);
+
+        // Fetch all the sprites.
+        typeSpriteBatchItemVector sprites;
+        sprites.reserve( mSprites.size() );
+        for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+        {
+            sprites.push_back( spriteItr->value );
+        }
+
+        // Build the culling grid.
+        mpSpriteBatchQuery->setGridCellSize( cellSize );
+        mpSpriteBatchQuery->buildGrid( sprites.address(), sprites.size() );
+
+        // Flag the culling grid as NOT dirty.
+        // NOTE: Fetching the sprite bounds may have flagged it dirty again.
+        mBatchCullingGridDirty = false;
+
+        return;
+    }
+
+    // Finish if there are no pending proxies.
+    const U32 pendingCount = mPendingQueryProxies.size();
+    if ( pendingCount == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_CreatePendingProxies);
+
+    // Are there enough pending proxies to rebuild the tree?
+    if ( pendingCount >= SPRITEBATCH_BULK_PROXY_THRESHOLD && pendingCount * 2 >= mpSpriteBatchQuery->getProxyCount() )
+    {
+        // Yes, so create the proxies and rebuild the tree in one pass.
+        Vector<S32> proxyIds;
+        proxyIds.setSize( pendingCount );
+        mpSpriteBatchQuery->addBulk( mPendingQueryProxies.address(), pendingCount, proxyIds.address() );
+
+        for ( U32 n = 0; n < pendingCount; ++n )
+        {
+            mPendingQueryProxies[n]->mProxyId = proxyIds[n];
+        }
+    }
+    else
+    {
+        // No, so insert the proxies individually.
+        for ( U32 n = 0; n < pendingCount; ++n )
+        {
+            SpriteBatchItem* pSpriteBatchItem = mPendingQueryProxies[n];
+            pSpriteBatchItem->mProxyId = mpSpriteBatchQuery->add( pSpriteBatchItem );
+        }
+    }
+
+    mPendingQueryProxies.clear();
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::destroySprite( const U32 batchId )
 {
     // Debug Profiling.
@@ -1355,6 +1796,9 @@ bool SpriteBatch::destroySprite( const U32 batchId )
     // Remove from sprites.
     mSprites.erase( batchId );
 
+    // Flag static batch as dirty.
+    setStaticBatchDirty();
+
     return true;
 }
 
@@ -37,28 +37,62 @@ class SpriteBatchQuery;
 
 //------------------------------------------------------------------------------  
 
+// The number of default sprite strides along each axis of a static batch cell.
+#define SPRITEBATCH_STATIC_CELL_SPRITES     16
+
+// The number of pending query proxies above which the query tree is rebuilt in one pass rather than inserted into.
+#define SPRITEBATCH_BULK_PROXY_THRESHOLD    64
+
+//------------------------------------------------------------------------------  
+
 class SpriteBatch
 {
 public:
     static const S32                INVALID_SPRITE_PROXY = -1;  
+    static const S32                PENDING_SPRITE_PROXY = -2;
 
 protected:
     typedef HashMap< U32, SpriteBatchItem* > typeSpriteBatchHash;
     typedef HashMap< SpriteBatchItem::LogicalPosition, SpriteBatchItem* > typeSpritePositionHash;
     typedef HashMap< StringTableEntry, SpriteBatchItem* > typeSpriteNameHash;
 
+    // A run of cached quads that share the same render state.
+    struct StaticQuadRun
+    {
+        SpriteBatchItem*    mpStateItem;
+        U32                 mQuadStart;
+        U32                 mQuadCount;
+    };
+
+    // A cell of cached world-space quads used when the batch is static.
+    struct StaticBatchCell
+    {
+        b2AABB                  mLocalAABB;
+        SpriteBatchItem*        mpFirstItem;
+        Vector<Vector2>         mVertices;
+        Vector<Vector2>         mTexCoords;
+        Vector<StaticQuadRun>   mRuns;
+    };
+
+    typedef Vector<StaticBatchCell*> typeStaticBatchCellVector;
+    typedef Vector<SpriteBatchItem*> typeSpriteBatchItemVector;
+
     typeSpriteBatchHash             mSprites;
     typeSpritePositionHash          mSpritePositions;
     typeSpriteNameHash              mSpriteNames;
     SpriteBatchItem*                mSelectedSprite;
     SceneRenderQueue::RenderSort    mBatchSortMode;
     bool                            mBatchCulling;
+    bool                            mBatchStatic;
+    bool                            mBatchCullingGrid;
     Vector2                         mDefaultSpriteStride;
     Vector2                         mDefaultSpriteSize;
     F32                             mDefaultSpriteAngle;
 
 private:
     SpriteBatchQuery*               mpSpriteBatchQuery;
+    typeSpriteBatchItemVector       mPendingQueryProxies;
+    bool                            mBatchCullingGridDirty;
     U32                             mMasterBatchId;
 
     b2Transform                     mBatchTransform;
@@ -68,6 +102,11 @@ private:
     Vector2                         mLocalExtents;
     bool                            mLocalExtentsDirty;
 
+    typeStaticBatchCellVector       mStaticBatchCells;
+    typeSpriteBatchItemVector       mStaticBatchDynamicItems;
+    bool                            mStaticBatchDirty;
+    U32                             mStaticBatchTransformId;
+
 public:
     SpriteBatch();
     virtual ~SpriteBatch();
@@ -83,6 +122,9 @@ public:
     inline U32 getBatchTransformId( void ) { return mBatchTransformId; }
     const b2Transform& getBatchTransform( void ) const { return mBatchTransform; }
 
+    inline void setStaticBatchDirty( void ) { mStaticBatchDirty = true; }
+    inline bool getStaticBatchDirty( void ) const { return mStaticBatchDirty; }
+
     inline void setLocalExtentsDirty( void ) { mLocalExtentsDirty = true; }
     inline bool getLocalExtentsDirty( void ) const { return mLocalExtentsDirty; }
     inline const Vector2& getLocalExtents( void ) { if ( getLocalExtentsDirty() ) updateLocalExtents(); return mLocalExtents; }
@@ -106,6 +148,13 @@ public:
     void setBatchCulling( const bool batchCulling );
     inline bool getBatchCulling( void ) const { return mBatchCulling; }
 
+    void setBatchCullingGrid( const bool batchCullingGrid );
+    inline bool getBatchCullingGrid( void ) const { return mBatchCullingGrid; }
+
+    void setBatchStatic( const bool batchStatic );
+    inline bool getBatchStatic( void ) const { return mBatchStatic; }
+    inline U32 getStaticBatchCellCount( void ) const { return (U32)mStaticBatchCells.size(); }
+
     inline void setDefaultSpriteStride( const Vector2& defaultStride ) { mDefaultSpriteStride = defaultStride; }
     inline const Vector2& getDefaultSpriteStride( void ) const { return mDefaultSpriteStride; }
 
@@ -131,6 +180,8 @@ public:
     StringTableEntry getSpriteNamedImageFrame( void ) const;
     void setSpriteAnimation( const char* pAssetId );
     StringTableEntry getSpriteAnimation( void ) const;
+    void setSpriteSharedAnimationClock( const bool sharedClock );
+    bool getSpriteSharedAnimationClock( void ) const;
     void clearSpriteAsset( void );
 
     void setSpriteVisible( const bool visible );
@@ -201,6 +252,12 @@ protected:
 
     void createSpriteBatchQuery( void );
     void destroySpriteBatchQuery( void );
+    void updateSpriteBatchQuery( void );
+
+    void buildStaticBatch( void );
+    void destroyStaticBatch( void );
+    void prepareStaticRender( SceneRenderObject* pSceneRenderObject, const b2AABB& localAABB, SceneRenderQueue* pSceneRenderQueue );
+    void renderStaticCell( const StaticBatchCell* pStaticBatchCell, BatchRender* pBatchRenderer );
 
     void onTamlCustomWrite( TamlCustomNodes& customNodes  );
     void onTamlCustomRead( const TamlCustomNodes& customNodes );
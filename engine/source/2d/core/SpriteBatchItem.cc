@@ -56,6 +56,7 @@ static StringTableEntry spriteImageName             = StringTable->insert("Image
 static StringTableEntry spriteImageFrameName        = StringTable->insert("Frame");
 static StringTableEntry spriteNamedImageFrameName   = StringTable->insert("NamedFrame");
 static StringTableEntry spriteAnimationName         = StringTable->insert("Animation");
+static StringTableEntry spriteSharedClockName       = StringTable->insert("SharedAnimationClock");
 static StringTableEntry spriteDataObjectName        = StringTable->insert("DataObject");
 static StringTableEntry spriteUserDataName          = StringTable->insert("UserData");
 
@@ -152,6 +153,9 @@ void SpriteBatchItem::setBatchParent( SpriteBatch* pSpriteBatch, const U32 batch
 
     // Create proxy.
     mSpriteBatch->createQueryProxy( this );
+
+    // Flag static batch as dirty.
+    mSpriteBatch->setStaticBatchDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -182,6 +186,61 @@ void SpriteBatchItem::copyTo( SpriteBatchItem* pSpriteBatchItem ) const
 
 //------------------------------------------------------------------------------
 
+bool SpriteBatchItem::setImage( const char* pImageAssetId, const U32 frame )
+{
+    // Flag static batch as dirty.
+    setStaticBatchDirty();
+
+    // Call parent.
+    return Parent::setImage( pImageAssetId, frame );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setImage( const char* pImageAssetId, const char* pNamedFrame )
+{
+    // Flag static batch as dirty.
+    setStaticBatchDirty();
+
+    // Call parent.
+    return Parent::setImage( pImageAssetId, pNamedFrame );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setImageFrame( const U32 frame )
+{
+    // Flag static batch as dirty.
+    setStaticBatchDirty();
+
+    // Call parent.
+    return Parent::setImageFrame( frame );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setNamedImageFrame( const char* frame )
+{
+    // Flag static batch as dirty.
+    setStaticBatchDirty();
+
+    // Call parent.
+    return Parent::setNamedImageFrame( frame );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setAnimation( const char* pAnimationAssetId )
+{
+    // Flag static batch as dirty.
+    setStaticBatchDirty();
+
+    // Call parent.
+    return Parent::setAnimation( pAnimationAssetId );
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatchItem::prepareRender( SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId )
 {
     // Debug Profiling.
@@ -240,6 +299,12 @@ void SpriteBatchItem::setExplicitVertices( const Vector2* explicitVertices )
     mExplicitVerts[1] = explicitVertices[1];
     mExplicitVerts[2] = explicitVertices[2];
     mExplicitVerts[3] = explicitVertices[3];
+
+    // Flag local transform as dirty.
+    mLocalTransformDirty = true;
+
+    // Flag static batch as dirty.
+    setStaticBatchDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -331,6 +396,26 @@ void SpriteBatchItem::updateWorldTransform( const U32 batchTransformId )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatchItem::setStaticBatchDirty( void )
+{
+    // Flag the static batch of the batch parent as dirty.
+    if ( mSpriteBatch != NULL )
+        mSpriteBatch->setStaticBatchDirty();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatchItem::onAssetRefreshed( AssetPtrBase* pAssetPtrBase )
+{
+    // Call parent.
+    Parent::onAssetRefreshed( pAssetPtrBase );
+
+    // Flag static batch as dirty.
+    setStaticBatchDirty();
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatchItem::onTamlCustomWrite( TamlCustomNode* pParentNode )
 {
     // Add sprite node.
@@ -370,6 +455,9 @@ void SpriteBatchItem::onTamlCustomWrite( TamlCustomNode* pParentNode )
             // Yes, so write animation asset Id.
             pSpriteNode->addField( spriteAnimationName, assetId );
 
+            // Write shared animation clock.
+            if ( getSharedAnimationClock() )
+                pSpriteNode->addField( spriteSharedClockName, true );
         }
     }
 
@@ -494,6 +582,12 @@ void SpriteBatchItem::onTamlCustomRead( const TamlCustomNode* pSpriteNode )
         {
             setAnimation( pSpriteField->getFieldValue() );
         }
+        else if ( fieldName == spriteSharedClockName )
+        {
+            bool sharedClock;
+            pSpriteField->getFieldValue( sharedClock );
+            setSharedAnimationClock( sharedClock );
+        }
         else if ( fieldName == spriteVisibleName )
         {
             bool visible;
@@ -647,6 +741,12 @@ void SpriteBatchItem::WriteCustomTamlSchema( const AbstractClassRep* pClassRep,
     pBatchItemAnimation->SetAttribute( "type", "AssetId_ConsoleType" );
     pBatchItemComplexTypeElement->LinkEndChild( pBatchItemAnimation );
 
+    // "Create "Shared Animation Clock" attribute.
+    TiXmlElement* pBatchItemSharedClock = new TiXmlElement( "xs:attribute" );
+    pBatchItemSharedClock->SetAttribute( "name", spriteSharedClockName );
+    pBatchItemSharedClock->SetAttribute( "type", "xs:boolean" );
+    pBatchItemComplexTypeElement->LinkEndChild( pBatchItemSharedClock );
+
     // Create "Visible" attribute.
     TiXmlElement* pBatchItemVisible = new TiXmlElement( "xs:attribute" );
     pBatchItemVisible->SetAttribute( "name", spriteVisibleName );
@@ -243,21 +243,21 @@ public:
     inline void setLogicalPosition( const LogicalPosition& logicalPosition ) { mLogicalPosition = logicalPosition; }
     inline const LogicalPosition& getLogicalPosition( void ) const { return mLogicalPosition; }
 
-    inline void setVisible( const bool visible ) { mVisible = visible; }
+    inline void setVisible( const bool visible ) { mVisible = visible; setStaticBatchDirty(); }
     inline bool getVisible( void ) const { return mVisible; }
 
-    inline void setExplicitMode( const bool explicitMode ) { mExplicitMode = explicitMode; }
+    inline void setExplicitMode( const bool explicitMode ) { mExplicitMode = explicitMode; mLocalTransformDirty = true; setStaticBatchDirty(); }
     inline bool getExplicitMode( void ) const { return mExplicitMode; }
 
-    inline void setLocalPosition( const Vector2& localPosition ) { mLocalPosition = localPosition; mLocalTransformDirty = true; }
+    inline void setLocalPosition( const Vector2& localPosition ) { mLocalPosition = localPosition; mLocalTransformDirty = true; setStaticBatchDirty(); }
     inline Vector2 getLocalPosition( void ) const { return mLocalPosition; }
 
     void setExplicitVertices( const Vector2* explicitVertices );
 
-    inline void setLocalAngle( const F32 localAngle ) { mLocalAngle = localAngle; mLocalTransformDirty = true; }
+    inline void setLocalAngle( const F32 localAngle ) { mLocalAngle = localAngle; mLocalTransformDirty = true; setStaticBatchDirty(); }
     inline F32 getLocalAngle( void ) const { return mLocalAngle; }
 
-    inline void setSize( const Vector2& size ) { mSize = size; mLocalTransformDirty = true; }
+    inline void setSize( const Vector2& size ) { mSize = size; mLocalTransformDirty = true; setStaticBatchDirty(); }
     inline Vector2 getSize( void ) const { return mSize; }
 
     inline const b2AABB& getLocalAABB( void ) { if ( mLocalTransformDirty ) updateLocalTransform(); return mLocalAABB; }
@@ -265,10 +265,10 @@ public:
     void setDepth( const F32 depth ) { mDepth = depth; }
     F32 getDepth( void ) const { return mDepth; }
 
-    inline void setFlipX( const bool flipX ) { mFlipX = flipX; }
+    inline void setFlipX( const bool flipX ) { mFlipX = flipX; setStaticBatchDirty(); }
     inline bool getFlipX( void ) const { return mFlipX; }
 
-    inline void setFlipY( const bool flipY ) { mFlipY = flipY; }
+    inline void setFlipY( const bool flipY ) { mFlipY = flipY; setStaticBatchDirty(); }
     inline bool getFlipY( void ) const { return mFlipY; }
 
     inline void setSortPoint( const Vector2& sortPoint ) { mSortPoint = sortPoint; }
@@ -276,18 +276,18 @@ public:
     inline void setRenderGroup( const char* pRenderGroup ) { mRenderGroup = StringTable->insert( pRenderGroup ); }
     inline StringTableEntry getRenderGroup( void ) const { return mRenderGroup; }
 
-    inline void setBlendMode( const bool blendMode ) { mBlendMode = blendMode; }
+    inline void setBlendMode( const bool blendMode ) { mBlendMode = blendMode; setStaticBatchDirty(); }
     inline bool getBlendMode( void ) const { return mBlendMode; }
-    inline void setSrcBlendFactor( GLenum srcBlendFactor ) { mSrcBlendFactor = srcBlendFactor; }
+    inline void setSrcBlendFactor( GLenum srcBlendFactor ) { mSrcBlendFactor = srcBlendFactor; setStaticBatchDirty(); }
     inline GLenum getSrcBlendFactor( void ) const { return mSrcBlendFactor; }
-    inline void setDstBlendFactor( GLenum dstBlendFactor ) { mDstBlendFactor = dstBlendFactor; }
+    inline void setDstBlendFactor( GLenum dstBlendFactor ) { mDstBlendFactor = dstBlendFactor; setStaticBatchDirty(); }
     inline GLenum getDstBlendFactor( void ) const { return mDstBlendFactor; }
-    inline void setBlendColor( const ColorF& blendColor ) { mBlendColor = blendColor; }
+    inline void setBlendColor( const ColorF& blendColor ) { mBlendColor = blendColor; setStaticBatchDirty(); }
     inline const ColorF& getBlendColor( void ) const { return mBlendColor; }
-    inline void setBlendAlpha( const F32 alpha ) { mBlendColor.alpha = alpha; }
+    inline void setBlendAlpha( const F32 alpha ) { mBlendColor.alpha = alpha; setStaticBatchDirty(); }
     inline F32 getBlendAlpha( void ) const { return mBlendColor.alpha; }
 
-    inline void setAlphaTest( const F32 alphaTest ) { mAlphaTest = alphaTest; }
+    inline void setAlphaTest( const F32 alphaTest ) { mAlphaTest = alphaTest; setStaticBatchDirty(); }
     inline F32 getAlphaTest( void ) const { return mAlphaTest; }
 
     inline void setDataObject( SimObject* pDataObject ) { mDataObject = pDataObject; }
@@ -305,6 +305,13 @@ public:
     inline const Vector2* getLocalOOBB( void ) const { return mLocalOOBB; }
     inline const Vector2* getRenderOOBB( void ) const { return mRenderOOBB; }
 
+    inline bool setImage( const char* pImageAssetId ) { return setImage( pImageAssetId, getImageFrame() ); }
+    virtual bool setImage( const char* pImageAssetId, const U32 frame );
+    virtual bool setImage( const char* pImageAssetId, const char* pNamedFrame );
+    virtual bool setImageFrame( const U32 frame );
+    virtual bool setNamedImageFrame( const char* frame );
+    virtual bool setAnimation( const char* pAnimationAssetId );
+
     void prepareRender( SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId );
     void render( BatchRender* pBatchRenderer, const SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId );
 
@@ -316,6 +323,9 @@ protected:
     inline void setName( const char* pName ) { mName = StringTable->insert( pName ); }
     void updateLocalTransform( void );
     void updateWorldTransform( const U32 batchTransformId );
+    void setStaticBatchDirty( void );
+
+    virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 
     void onTamlCustomWrite( TamlCustomNode* pParentNode );
     void onTamlCustomRead( const TamlCustomNode* pSpriteNode );
@@ -40,10 +40,18 @@ SpriteBatchQuery::SpriteBatchQuery( SpriteBatch* pSpriteBatch ) :
         mIsRaycastQueryResult(false),
         mMasterQueryKey(0),
         mCheckPoint(false),
-        mComparePoint(0.0f, 0.0f)
+        mComparePoint(0.0f, 0.0f),
+        mProxyCount(0),
+        mGridCellSize(0.0f, 0.0f),
+        mGridOrigin(0.0f, 0.0f),
+        mGridStride(0.0f, 0.0f),
+        mGridColumns(0),
+        mGridRows(0)
 {
     // Set debug associations.
     VECTOR_SET_ASSOCIATION( mQueryResults );
+    VECTOR_SET_ASSOCIATION( mGridCellStarts );
+    VECTOR_SET_ASSOCIATION( mGridItems );
 
     // Clear the query.
     clearQuery();
@@ -56,16 +64,48 @@ S32 SpriteBatchQuery::add( SpriteBatchItem* pSpriteBatchItem )
     // Debug Profiling.
     PROFILE_SCOPE(SpriteBatchQuery_Add);
 
+    mProxyCount++;
+
     return CreateProxy( pSpriteBatchItem->getLocalAABB(), pSpriteBatchItem );
 }
 
 //-----------------------------------------------------------------------------
 
+void SpriteBatchQuery::addBulk( SpriteBatchItem** pSpriteBatchItems, const U32 itemCount, S32* pProxyIds )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatchQuery_AddBulk);
+
+    // Finish if nothing to add.
+    if ( itemCount == 0 )
+        return;
+
+    // Fetch the proxy bounds and user data.
+    Vector<b2AABB> aabbs;
+    Vector<void*> userData;
+    aabbs.setSize( itemCount );
+    userData.setSize( itemCount );
+    for ( U32 n = 0; n < itemCount; ++n )
+    {
+        aabbs[n] = pSpriteBatchItems[n]->getLocalAABB();
+        userData[n] = pSpriteBatchItems[n];
+    }
+
+    // Create all the proxies and rebuild the tree once.
+    CreateProxies( aabbs.address(), userData.address(), (S32)itemCount, pProxyIds );
+
+    mProxyCount += itemCount;
+}
+
+//-----------------------------------------------------------------------------
+
 void SpriteBatchQuery::remove( SpriteBatchItem* pSpriteBatchItem )
 {
     // Debug Profiling.
     PROFILE_SCOPE(SpriteBatchQuery_Remove);
 
+    mProxyCount--;
+
     DestroyProxy( pSpriteBatchItem->getProxyId() );
 }
 
@@ -81,6 +121,81 @@ bool SpriteBatchQuery::update( SpriteBatchItem* pSpriteBatchItem, const b2AABB&
 
 //-----------------------------------------------------------------------------
 
+void SpriteBatchQuery::buildGrid( SpriteBatchItem** pSpriteBatchItems, const U32 itemCount )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatchQuery_BuildGrid);
+
+    // Reset the grid.
+    mGridColumns = 0;
+    mGridRows = 0;
+    mGridCellStarts.clear();
+    mGridItems.clear();
+
+    // Finish if nothing to index.
+    if ( itemCount == 0 || !getIsGridIndex() )
+        return;
+
+    // Calculate the bounds of all the items.
+    b2AABB bounds = pSpriteBatchItems[0]->getLocalAABB();
+    for ( U32 n = 1; n < itemCount; ++n )
+        bounds.Combine( pSpriteBatchItems[n]->getLocalAABB() );
+
+    // Start the grid at the lower bound so that items laid out on the cell stride fall into exactly one cell.
+    // Sparse layouts coarsen the cells so the grid stays proportional to the item count.
+    const F32 maxCells = (F32)getMax( itemCount * 4, (U32)1024 );
+    mGridOrigin = bounds.lowerBound;
+    mGridStride = mGridCellSize;
+    while( true )
+    {
+        mGridColumns = getMax( (S32)mCeil( (bounds.upperBound.x - mGridOrigin.x) / mGridStride.x ), 1 );
+        mGridRows = getMax( (S32)mCeil( (bounds.upperBound.y - mGridOrigin.y) / mGridStride.y ), 1 );
+
+        if ( (F32)mGridColumns * (F32)mGridRows <= maxCells )
+            break;
+
+        mGridStride *= 2.0f;
+    }
+
+    // Count the items in each cell.
+    const U32 cellCount = (U32)(mGridColumns * mGridRows);
+    mGridCellStarts.setSize( cellCount + 1 );
+    dMemset( mGridCellStarts.address(), 0, mGridCellStarts.memSize() );
+    for ( U32 n = 0; n < itemCount; ++n )
+    {
+        S32 column0, row0, column1, row1;
+        getGridCells( pSpriteBatchItems[n]->getLocalAABB(), column0, row0, column1, row1 );
+
+        for ( S32 row = row0; row <= row1; ++row )
+        {
+            for ( S32 column = column0; column <= column1; ++column )
+                mGridCellStarts[row * mGridColumns + column + 1]++;
+        }
+    }
+
+    // Convert the counts to cell starts.
+    for ( U32 cell = 0; cell < cellCount; ++cell )
+        mGridCellStarts[cell + 1] += mGridCellStarts[cell];
+
+    // Place the items in their cells.
+    Vector<U32> cellCursors( mGridCellStarts );
+    mGridItems.setSize( mGridCellStarts[cellCount] );
+    for ( U32 n = 0; n < itemCount; ++n )
+    {
+        SpriteBatchItem* pSpriteBatchItem = pSpriteBatchItems[n];
+        S32 column0, row0, column1, row1;
+        getGridCells( pSpriteBatchItem->getLocalAABB(), column0, row0, column1, row1 );
+
+        for ( S32 row = row0; row <= row1; ++row )
+        {
+            for ( S32 column = column0; column <= column1; ++column )
+                mGridItems[cellCursors[row * mGridColumns + column]++] = pSpriteBatchItem;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 U32 SpriteBatchQuery::queryOOBB( const b2AABB& aabb, b2PolygonShape& oobb, const bool targetOOBB )
 {
   // This function is used exclusively when picking rectangular areas using CompositeSprite's pickArea ConsoleMethod
@@ -99,7 +214,10 @@ U32 SpriteBatchQuery::queryOOBB( const b2AABB& aabb, b2PolygonShape& oobb, const
 
     mCompareTransform.SetIdentity();
     mCheckOOBB = targetOOBB;
-    Query( this, aabb );
+    if ( getIsGridIndex() )
+        queryGrid( aabb );
+    else
+        Query( this, aabb );
     mCheckOOBB = false;
 
     return getQueryResultsCount();
@@ -124,7 +242,10 @@ U32 SpriteBatchQuery::queryArea( const b2AABB& aabb, const bool targetOOBB )
     mComparePolygonShape.Set( verts, 4 );
     mCompareTransform.SetIdentity();
     mCheckOOBB = targetOOBB;
-    Query( this, aabb );
+    if ( getIsGridIndex() )
+        queryGrid( aabb );
+    else
+        Query( this, aabb );
     mCheckOOBB = false;
 
     return getQueryResultsCount();
@@ -148,7 +269,10 @@ U32 SpriteBatchQuery::queryRay( const Vector2& point1, const Vector2& point2, co
     mCompareRay.maxFraction = 1.0f;
     mCompareTransform.SetIdentity();
     mCheckOOBB = targetOOBB;
-    RayCast( this, mCompareRay );
+    if ( getIsGridIndex() )
+        queryGridRay();
+    else
+        RayCast( this, mCompareRay );
     mCheckOOBB = false;
 
     return getQueryResultsCount();
@@ -172,7 +296,10 @@ U32 SpriteBatchQuery::queryPoint( const Vector2& point, const bool targetOOBB )
     aabb.upperBound = point;
     mCompareTransform.SetIdentity();
     mCheckOOBB = targetOOBB;
-    Query( this, aabb );
+    if ( getIsGridIndex() )
+        queryGrid( aabb );
+    else
+        Query( this, aabb );
     mCheckOOBB = false;
 
     return getQueryResultsCount();
@@ -210,6 +337,13 @@ bool SpriteBatchQuery::QueryCallback( S32 proxyId )
     // Fetch sprite batch item.
     SpriteBatchItem* pSpriteBatchItem = static_cast<SpriteBatchItem*>(GetUserData( proxyId ));
 
+    return reportItem( pSpriteBatchItem );
+}
+
+//-----------------------------------------------------------------------------
+
+bool SpriteBatchQuery::reportItem( SpriteBatchItem* pSpriteBatchItem )
+{
     // Ignore if already tagged with the sprite batch query key.
     if ( pSpriteBatchItem->getSpriteBatchQueryKey() == mMasterQueryKey )
         return true;
@@ -252,9 +386,18 @@ F32 SpriteBatchQuery::RayCastCallback( const b2RayCastInput& input, S32 proxyId
     // Fetch sprite batch item.
     SpriteBatchItem* pSpriteBatchItem = static_cast<SpriteBatchItem*>(GetUserData( proxyId ));
 
+    reportRayItem( pSpriteBatchItem );
+
+    return 1.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchQuery::reportRayItem( SpriteBatchItem* pSpriteBatchItem )
+{
     // Ignore if already tagged with the sprite batch query key.
     if ( pSpriteBatchItem->getSpriteBatchQueryKey() == mMasterQueryKey )
-        return 1.0f;
+        return;
 
     // Check OOBB.
     if ( mCheckOOBB )
@@ -264,7 +407,7 @@ F32 SpriteBatchQuery::RayCastCallback( const b2RayCastInput& input, S32 proxyId
         oobb.Set( pSpriteBatchItem->getLocalOOBB(), 4);
         b2RayCastOutput rayOutput;
         if ( !oobb.RayCast( &rayOutput, mCompareRay, mCompareTransform, 0 ) )
-            return true;
+            return;
     }
 
     // Tag with world query key.
@@ -272,8 +415,166 @@ F32 SpriteBatchQuery::RayCastCallback( const b2RayCastInput& input, S32 proxyId
 
     SpriteBatchQueryResult queryResult( pSpriteBatchItem );
     mQueryResults.push_back( queryResult );
+}
 
-    return 1.0f;
+//-----------------------------------------------------------------------------
+
+void SpriteBatchQuery::queryGrid( const b2AABB& aabb )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatchQuery_QueryGrid);
+
+    // Finish if the grid is empty.
+    if ( mGridColumns == 0 )
+        return;
+
+    // Finish if the area is outside of the grid.
+    if ( aabb.upperBound.x < mGridOrigin.x || aabb.upperBound.y < mGridOrigin.y ||
+         aabb.lowerBound.x > mGridOrigin.x + mGridColumns * mGridStride.x ||
+         aabb.lowerBound.y > mGridOrigin.y + mGridRows * mGridStride.y )
+        return;
+
+    // Fetch the cells covered by the area.
+    S32 column0, row0, column1, row1;
+    getGridCells( aabb, column0, row0, column1, row1 );
+
+    for ( S32 row = row0; row <= row1; ++row )
+    {
+        for ( S32 column = column0; column <= column1; ++column )
+        {
+            const U32 cell = (U32)(row * mGridColumns + column);
+            const U32 cellEnd = mGridCellStarts[cell + 1];
+
+            for ( U32 index = mGridCellStarts[cell]; index < cellEnd; ++index )
+            {
+                // Fetch sprite batch item.
+                SpriteBatchItem* pSpriteBatchItem = mGridItems[index];
+
+                // Ignore if the item bounds do not overlap the area.
+                if ( !b2TestOverlap( aabb, pSpriteBatchItem->getLocalAABB() ) )
+                    continue;
+
+                reportItem( pSpriteBatchItem );
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+// Clips a ray to one axis of the grid, in cell units.
+static bool clipGridRay( const F32 start, const F32 delta, const F32 cells, F32& enter, F32& exit )
+{
+    // Parallel to the axis so either always or never inside.
+    if ( mFabs( delta ) < b2_epsilon )
+        return start >= 0.0f && start <= cells;
+
+    F32 lower = -start / delta;
+    F32 upper = (cells - start) / delta;
+    if ( lower > upper )
+    {
+        const F32 swap = lower;
+        lower = upper;
+        upper = swap;
+    }
+
+    enter = getMax( enter, lower );
+    exit = getMin( exit, upper );
+    return enter <= exit;
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchQuery::queryGridRay( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatchQuery_QueryGridRay);
+
+    // Finish if the grid is empty.
+    if ( mGridColumns == 0 )
+        return;
+
+    // Work in cell units relative to the grid origin.
+    const b2Vec2 start( (mCompareRay.p1.x - mGridOrigin.x) / mGridStride.x, (mCompareRay.p1.y - mGridOrigin.y) / mGridStride.y );
+    const b2Vec2 delta( (mCompareRay.p2.x - mCompareRay.p1.x) / mGridStride.x, (mCompareRay.p2.y - mCompareRay.p1.y) / mGridStride.y );
+
+    // Finish if the ray misses the grid, otherwise fetch where it is inside it.
+    F32 enter = 0.0f;
+    F32 exit = 1.0f;
+    if ( !clipGridRay( start.x, delta.x, (F32)mGridColumns, enter, exit ) ||
+         !clipGridRay( start.y, delta.y, (F32)mGridRows, enter, exit ) )
+        return;
+
+    // Fetch the cell the ray enters the grid in.
+    S32 column = (S32)mFloor( mClampF( start.x + delta.x * enter, 0.0f, (F32)(mGridColumns - 1) ) );
+    S32 row = (S32)mFloor( mClampF( start.y + delta.y * enter, 0.0f, (F32)(mGridRows - 1) ) );
+
+    // Fetch the step to the next cell and where along the ray each axis next crosses a cell edge.
+    const S32 stepColumn = delta.x > b2_epsilon ? 1 : delta.x < -b2_epsilon ? -1 : 0;
+    const S32 stepRow = delta.y > b2_epsilon ? 1 : delta.y < -b2_epsilon ? -1 : 0;
+    const F32 columnDelta = stepColumn != 0 ? mFabs( 1.0f / delta.x ) : b2_maxFloat;
+    const F32 rowDelta = stepRow != 0 ? mFabs( 1.0f / delta.y ) : b2_maxFloat;
+    F32 nextColumn = stepColumn != 0 ? ((F32)(column + (stepColumn > 0 ? 1 : 0)) - start.x) / delta.x : b2_maxFloat;
+    F32 nextRow = stepRow != 0 ? ((F32)(row + (stepRow > 0 ? 1 : 0)) - start.y) / delta.y : b2_maxFloat;
+
+    // Walk the cells along the ray.
+    while ( true )
+    {
+        queryGridRayCell( column, row );
+
+        if ( nextColumn < nextRow )
+        {
+            column += stepColumn;
+            if ( nextColumn > exit || column < 0 || column >= mGridColumns )
+                break;
+
+            nextColumn += columnDelta;
+        }
+        else
+        {
+            row += stepRow;
+            if ( nextRow > exit || row < 0 || row >= mGridRows )
+                break;
+
+            nextRow += rowDelta;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchQuery::queryGridRayCell( const S32 column, const S32 row )
+{
+    const U32 cell = (U32)(row * mGridColumns + column);
+    const U32 cellEnd = mGridCellStarts[cell + 1];
+
+    for ( U32 index = mGridCellStarts[cell]; index < cellEnd; ++index )
+    {
+        // Fetch sprite batch item.
+        SpriteBatchItem* pSpriteBatchItem = mGridItems[index];
+
+        // Ignore if the ray misses the item bounds.
+        b2RayCastOutput rayOutput;
+        if ( !pSpriteBatchItem->getLocalAABB().RayCast( &rayOutput, mCompareRay ) )
+            continue;
+
+        reportRayItem( pSpriteBatchItem );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SpriteBatchQuery::getGridCells( const b2AABB& aabb, S32& column0, S32& row0, S32& column1, S32& row1 ) const
+{
+    // Cells hold their lower edges but not their upper ones, so items laid out on the cell stride fall into exactly one cell.
+    // Both the items and the queries use this so they always agree on the cells.
+    // Clamp before converting so that distant points cannot overflow.
+    const F32 columns = (F32)mGridColumns;
+    const F32 rows = (F32)mGridRows;
+    column0 = (S32)mFloor( mClampF( (aabb.lowerBound.x - mGridOrigin.x) / mGridStride.x, 0.0f, columns - 1.0f ) );
+    row0 = (S32)mFloor( mClampF( (aabb.lowerBound.y - mGridOrigin.y) / mGridStride.y, 0.0f, rows - 1.0f ) );
+    column1 = getMax( (S32)mCeil( mClampF( (aabb.upperBound.x - mGridOrigin.x) / mGridStride.x, 0.0f, columns ) ) - 1, column0 );
+    row1 = getMax( (S32)mCeil( mClampF( (aabb.upperBound.y - mGridOrigin.y) / mGridStride.y, 0.0f, rows ) ) - 1, row0 );
 }
 
 //-----------------------------------------------------------------------------
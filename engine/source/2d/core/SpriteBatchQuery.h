@@ -45,8 +45,16 @@ public:
 
     /// Standard scope.
     S32             add( SpriteBatchItem* pSpriteBatchItem );
+    void            addBulk( SpriteBatchItem** pSpriteBatchItems, const U32 itemCount, S32* pProxyIds );
     void            remove( SpriteBatchItem* pSpriteBatchItem );
     bool            update( SpriteBatchItem* pSpriteBatchItem, const b2AABB& aabb, const b2Vec2& displacement );
+    inline U32      getProxyCount( void ) const { return mProxyCount; }
+
+    /// Grid index.
+    void            setGridCellSize( const Vector2& cellSize ) { mGridCellSize = cellSize; }
+    inline const Vector2& getGridCellSize( void ) const { return mGridCellSize; }
+    inline bool     getIsGridIndex( void ) const { return mGridCellSize.x > 0.0f && mGridCellSize.y > 0.0f; }
+    void            buildGrid( SpriteBatchItem** pSpriteBatchItems, const U32 itemCount );
 
     //// Spatial queries.
     U32             queryArea( const b2AABB& aabb, const bool targetOOBB );
@@ -73,6 +81,13 @@ public:
 private:
     static S32      QSORT_CALLBACK rayCastFractionSort(const void* a, const void* b);
 
+    bool            reportItem( SpriteBatchItem* pSpriteBatchItem );
+    void            reportRayItem( SpriteBatchItem* pSpriteBatchItem );
+    void            queryGrid( const b2AABB& aabb );
+    void            queryGridRay( void );
+    void            queryGridRayCell( const S32 column, const S32 row );
+    void            getGridCells( const b2AABB& aabb, S32& column0, S32& row0, S32& column1, S32& row1 ) const;
+
 private:
     SpriteBatch*                mpSpriteBatch;
     b2PolygonShape              mComparePolygonShape;
@@ -85,6 +100,15 @@ private:
     bool                        mIsRaycastQueryResult;
     typeSceneObjectVector       mAlwaysInScopeSet;
     U32                         mMasterQueryKey;
+    U32                         mProxyCount;
+
+    Vector2                     mGridCellSize;
+    b2Vec2                      mGridOrigin;
+    b2Vec2                      mGridStride;
+    S32                         mGridColumns;
+    S32                         mGridRows;
+    Vector<U32>                 mGridCellStarts;
+    Vector<SpriteBatchItem*>    mGridItems;
 };
 
 #endif // _SPRITE_BATCH_QUERY_H_
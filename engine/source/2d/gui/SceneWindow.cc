@@ -1638,6 +1638,9 @@ void SceneWindow::onRender( Point2I offset, const RectI& updateRect )
         sceneMax += mCameraShakeOffset;
     }
 
+    // Flush any pending GUI primitives before changing the coordinate system.
+    dglFlushBatch();
+
     // Setup new logical coordinate system.
     glMatrixMode(GL_PROJECTION);
     glPushMatrix();
@@ -1733,6 +1736,9 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     // Fetch the font.
     Resource<GFont>& font = mProfile->mFont;    
 
+    // Flush any pending GUI primitives.
+    dglFlushBatch();
+
     // Blending for banner background.
     glEnable        ( GL_BLEND );
     glBlendFunc     ( GL_SRC_ALPHA , GL_ONE_MINUS_SRC_ALPHA );
@@ -1752,7 +1758,7 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     const S32 metricsOffset = (S32)font->getStrWidth( "WWWWWWWWWWWW" );
 
     // Set Banner Height.
-    F32 bannerLineHeight = fullMetrics ? 17.0f : 1.0f;
+    F32 bannerLineHeight = fullMetrics ? 18.0f : 1.0f;
 
     // Add an extra line if we're monitoring a scene object.
     if ( pDebugSceneObject != NULL )
@@ -1952,6 +1958,32 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
             AssetDatabase.getLoadedPrivateAssetCount(), AssetDatabase.getMaxLoadedPrivateAssetCount() );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
+
+        // Debug Draw.
+        dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "DebugDraw", NULL );
+        const DebugDraw& debugDraw = pScene->mDebugDraw;
+        S32 debugTextLength = dSprintf( mDebugText, sizeof( mDebugText ), "- Flush=%d, DrawCalls=%d",
+            debugDraw.getFlushCount(),
+            debugDraw.getDrawCallCount() );
+
+        // Show primitives/culled/vertices for each active category.
+        for ( S32 category = 0; category < DebugDraw::DEBUG_CATEGORY_COUNT; ++category )
+        {
+            const DebugDraw::CategoryStats& categoryStats = debugDraw.getCategoryStats( (DebugDraw::DebugCategory)category );
+            if ( categoryStats.primitives == 0 && categoryStats.culled == 0 )
+                continue;
+
+            debugTextLength += dSprintf( mDebugText + debugTextLength, sizeof( mDebugText ) - debugTextLength, ", %s=%d/%d/%d",
+                DebugDraw::getCategoryDescription( (DebugDraw::DebugCategory)category ),
+                categoryStats.primitives,
+                categoryStats.culled,
+                categoryStats.vertices );
+
+            if ( debugTextLength >= (S32)sizeof( mDebugText ) - 1 )
+                break;
+        }
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
     }
     else if ( fpsMetrics )
     {
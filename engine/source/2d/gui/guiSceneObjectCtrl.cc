@@ -384,6 +384,7 @@ void GuiSceneObjectCtrl::onRender(Point2I offset, const RectI& updateRect)
       y2 *= -1;
 
       // Setup new logical coordinate system.
+      dglFlushBatch();
       glMatrixMode(GL_PROJECTION);
       glPushMatrix();
       glLoadIdentity();
@@ -0,0 +1,205 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _CONTROLLER_BODY_GRID_H_
+#include "2d/scene/ControllerBodyGrid.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+ControllerBodyGrid::ControllerBodyGrid() :
+    mValid( false ),
+    mActive( false ),
+    mOrigin( 0.0f, 0.0f ),
+    mMaxHalfExtent( 0.0f, 0.0f ),
+    mInverseCellSize( 1.0f ),
+    mCellsX( 0 ),
+    mCellsY( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void ControllerBodyGrid::build( const Vector<SceneObject*>& sceneObjects )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ControllerBodyGrid_Build);
+
+    // Reset the snapshot.
+    mValid = true;
+    mBuildEntries.clear();
+    mEntries.clear();
+    mCellStart.clear();
+    mMaxHalfExtent.SetZero();
+    mCellsX = mCellsY = 0;
+
+    b2AABB bounds;
+    F32 totalWidth = 0.0f;
+    F32 totalHeight = 0.0f;
+
+    // Collect the candidate bodies.
+    for ( S32 index = 0; index < sceneObjects.size(); ++index )
+    {
+        // Fetch the scene object.
+        SceneObject* pSceneObject = sceneObjects[index];
+
+        // Fetch the body.
+        b2Body* pBody = pSceneObject->getBody();
+
+        // Ignore if there's no body or it's a static body.
+        if ( pBody == NULL || pBody->GetType() == b2_staticBody )
+            continue;
+
+        // Ignore if the object cannot be picked by a controller.
+        if ( !pSceneObject->isEnabled() || !pSceneObject->getPickingAllowed() )
+            continue;
+
+        // Combine the render AABB with the collision shapes AABBs.
+        b2AABB aabb = pSceneObject->getAABB();
+        for ( b2Fixture* pFixture = pBody->GetFixtureList(); pFixture != NULL; pFixture = pFixture->GetNext() )
+        {
+            const S32 childCount = pFixture->GetShape()->GetChildCount();
+            for ( S32 childIndex = 0; childIndex < childCount; ++childIndex )
+                aabb.Combine( pFixture->GetAABB( childIndex ) );
+        }
+
+        Entry entry;
+        entry.mpSceneObject = pSceneObject;
+        entry.mAABB = aabb;
+        entry.mSceneLayerMask = pSceneObject->getSceneLayerMask();
+        entry.mSceneGroupMask = pSceneObject->getSceneGroupMask();
+        mBuildEntries.push_back( entry );
+
+        // Accumulate the bounds and extents.
+        const b2Vec2 halfExtent = aabb.GetExtents();
+        mMaxHalfExtent.x = getMax( mMaxHalfExtent.x, halfExtent.x );
+        mMaxHalfExtent.y = getMax( mMaxHalfExtent.y, halfExtent.y );
+        totalWidth += halfExtent.x * 2.0f;
+        totalHeight += halfExtent.y * 2.0f;
+
+        if ( mBuildEntries.size() == 1 )
+            bounds = aabb;
+        else
+            bounds.Combine( aabb );
+    }
+
+    // Finish if nothing to bucket.
+    const U32 entryCount = (U32)mBuildEntries.size();
+    if ( entryCount == 0 )
+        return;
+
+    // Size the cells so there's roughly one body per cell, no smaller than the average body
+    // and no more than the maximum cells per axis.
+    const b2Vec2 boundsSize = bounds.upperBound - bounds.lowerBound;
+    F32 cellSize = mSqrt( (boundsSize.x * boundsSize.y) / (F32)entryCount );
+    cellSize = getMax( cellSize, getMax( totalWidth, totalHeight ) / (F32)entryCount );
+    cellSize = getMax( cellSize, getMax( boundsSize.x, boundsSize.y ) / (F32)MaxCellsPerAxis );
+    if ( cellSize < b2_epsilon )
+        cellSize = 1.0f;
+
+    mOrigin = bounds.lowerBound;
+    mInverseCellSize = 1.0f / cellSize;
+    mCellsX = getMin( (U32)mFloor( boundsSize.x * mInverseCellSize ) + 1, (U32)MaxCellsPerAxis );
+    mCellsY = getMin( (U32)mFloor( boundsSize.y * mInverseCellSize ) + 1, (U32)MaxCellsPerAxis );
+
+    // Count the bodies per cell, bucketing each body by its center.
+    const U32 cellCount = mCellsX * mCellsY;
+    mCellStart.setSize( cellCount + 1 );
+    dMemset( mCellStart.address(), 0, sizeof(U32) * (cellCount + 1) );
+    mEntryCell.setSize( entryCount );
+    for ( U32 index = 0; index < entryCount; ++index )
+    {
+        const b2Vec2 center = mBuildEntries[index].mAABB.GetCenter();
+        const U32 cell = getCellX( center.x ) + getCellY( center.y ) * mCellsX;
+        mEntryCell[index] = cell;
+        mCellStart[cell+1]++;
+    }
+
+    // Convert the counts to offsets.
+    for ( U32 cell = 0; cell < cellCount; ++cell )
+        mCellStart[cell+1] += mCellStart[cell];
+
+    // Scatter the bodies into cell order.
+    mEntries.setSize( entryCount );
+    for ( U32 index = 0; index < entryCount; ++index )
+    {
+        const U32 slot = mCellStart[mEntryCell[index]]++;
+        mEntries[slot] = mBuildEntries[index];
+    }
+
+    // The scatter advanced each offset to the start of the next cell so shift them back.
+    for ( U32 cell = cellCount; cell > 0; --cell )
+        mCellStart[cell] = mCellStart[cell-1];
+    mCellStart[0] = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ControllerBodyGrid::query( const b2AABB& aabb, const U32 sceneLayerMask, const U32 sceneGroupMask, typeResultVector& results ) const
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ControllerBodyGrid_Query);
+
+    // Clear the results.
+    results.clear();
+
+    // Finish if nothing bucketed.
+    if ( mEntries.size() == 0 )
+        return 0;
+
+    // Bodies are bucketed by their center so widen the search by the largest body.
+    const U32 minX = getCellX( aabb.lowerBound.x - mMaxHalfExtent.x );
+    const U32 maxX = getCellX( aabb.upperBound.x + mMaxHalfExtent.x );
+    const U32 minY = getCellY( aabb.lowerBound.y - mMaxHalfExtent.y );
+    const U32 maxY = getCellY( aabb.upperBound.y + mMaxHalfExtent.y );
+
+    for ( U32 cellY = minY; cellY <= maxY; ++cellY )
+    {
+        // Cells in a row are contiguous so scan the row span in one go.
+        const U32 rowStart = mCellStart[minX + cellY * mCellsX];
+        const U32 rowEnd = mCellStart[maxX + cellY * mCellsX + 1];
+
+        for ( U32 index = rowStart; index < rowEnd; ++index )
+        {
+            const Entry& entry = mEntries[index];
+
+            // Compare masks.
+            if ( (entry.mSceneLayerMask & sceneLayerMask) == 0 || (entry.mSceneGroupMask & sceneGroupMask) == 0 )
+                continue;
+
+            // Check overlap.
+            if ( !b2TestOverlap( aabb, entry.mAABB ) )
+                continue;
+
+            results.push_back( entry.mpSceneObject );
+        }
+    }
+
+    return (U32)results.size();
+}
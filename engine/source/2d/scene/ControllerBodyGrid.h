@@ -0,0 +1,111 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _CONTROLLER_BODY_GRID_H_
+#define _CONTROLLER_BODY_GRID_H_
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _TVECTOR_H_
+#include "collection/vector.h"
+#endif
+
+///-----------------------------------------------------------------------------
+
+class SceneObject;
+
+///-----------------------------------------------------------------------------
+
+/// A per-tick snapshot of the non-static bodies in a scene, bucketed into a uniform grid.
+/// The snapshot is built lazily the first time a scene controller queries it during a tick
+/// and is then shared by every controller integrated in that tick, replacing a broad-phase
+/// query per controller with a handful of cell lookups.
+///
+/// Building it touches every object in the scene so it's only used when there are enough
+/// controllers to pay for that. Otherwise controllers query the world directly.
+class ControllerBodyGrid
+{
+public:
+    struct Entry
+    {
+        SceneObject*    mpSceneObject;
+        b2AABB          mAABB;
+        U32             mSceneLayerMask;
+        U32             mSceneGroupMask;
+    };
+
+    typedef Vector<Entry> typeEntryVector;
+    typedef Vector<SceneObject*> typeResultVector;
+
+    /// Maximum grid cells per axis.
+    static const U32 MaxCellsPerAxis = 128;
+
+    /// Fewest controllers in a tick that use the snapshot.
+    static const U32 MinControllerCount = 4;
+
+    /// Scene objects each controller must pay for, taking a world query per controller as
+    /// costing about as much as bucketing this many objects.
+    static const U32 ObjectsPerController = 64;
+
+public:
+    ControllerBodyGrid();
+    ~ControllerBodyGrid() {}
+
+    /// Snapshot state.
+    inline bool     isValid( void ) const                               { return mValid; }
+    inline void     invalidate( void )                                  { mValid = false; }
+    void            build( const Vector<SceneObject*>& sceneObjects );
+
+    /// Whether controllers should use the snapshot this tick.
+    inline bool     isActive( void ) const                              { return mActive; }
+    inline void     setActive( const bool active )                      { mActive = active; }
+    static inline bool isWorthBuilding( const U32 controllerCount, const U32 objectCount ) { return controllerCount >= MinControllerCount && controllerCount * ObjectsPerController >= objectCount; }
+
+    /// Queries.
+    U32             query( const b2AABB& aabb, const U32 sceneLayerMask, const U32 sceneGroupMask, typeResultVector& results ) const;
+
+    /// Statistics.
+    inline U32      getEntryCount( void ) const                         { return (U32)mEntries.size(); }
+    inline U32      getCellCount( void ) const                          { return mCellsX * mCellsY; }
+
+private:
+    /// Cells are clamped before conversion as far-away query bounds don't fit in an integer.
+    inline U32      getCellX( const F32 x ) const                       { return (U32)mClampF( mFloor( (x - mOrigin.x) * mInverseCellSize ), 0.0f, (F32)(mCellsX-1) ); }
+    inline U32      getCellY( const F32 y ) const                       { return (U32)mClampF( mFloor( (y - mOrigin.y) * mInverseCellSize ), 0.0f, (F32)(mCellsY-1) ); }
+
+private:
+    bool            mValid;
+    bool            mActive;
+    typeEntryVector mEntries;
+    typeEntryVector mBuildEntries;
+    Vector<U32>     mCellStart;
+    Vector<U32>     mEntryCell;
+    b2Vec2          mOrigin;
+    b2Vec2          mMaxHalfExtent;
+    F32             mInverseCellSize;
+    U32             mCellsX;
+    U32             mCellsY;
+};
+
+#endif // _CONTROLLER_BODY_GRID_H_
@@ -259,18 +259,199 @@ void DebugDraw::DrawJoints( b2World* pWorld )
 
 //-----------------------------------------------------------------------------
 
+DebugDraw::DebugDraw() :
+    mCullEnabled( false ),
+    mCategory( DEBUG_CATEGORY_OTHER ),
+    mFlushCount( 0 ),
+    mDrawCallCount( 0 )
+{
+    mCullAABB.lowerBound.SetZero();
+    mCullAABB.upperBound.SetZero();
+    dMemset( mCategoryStats, 0, sizeof(mCategoryStats) );
+}
+
+//-----------------------------------------------------------------------------
+
+void DebugDraw::beginFrame( const b2AABB& cullAABB )
+{
+    // Anything not flushed last frame is stale.
+    mLineVertices.clear();
+    mTriangleVertices.clear();
+    mPointVertices.clear();
+    mPointSizes.clear();
+
+    mCullAABB = cullAABB;
+    mCullEnabled = true;
+
+    mCategory = DEBUG_CATEGORY_OTHER;
+    dMemset( mCategoryStats, 0, sizeof(mCategoryStats) );
+    mFlushCount = 0;
+    mDrawCallCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* DebugDraw::getCategoryDescription( const DebugCategory category )
+{
+    // These match the scene debug option names.
+    switch( category )
+    {
+        case DEBUG_CATEGORY_AABB:               return "aabb";
+        case DEBUG_CATEGORY_OOBB:               return "oobb";
+        case DEBUG_CATEGORY_SLEEP:              return "sleep";
+        case DEBUG_CATEGORY_COLLISION_SHAPES:   return "collision";
+        case DEBUG_CATEGORY_POSITION_AND_COM:   return "position";
+        case DEBUG_CATEGORY_SORT_POINTS:        return "sort";
+        case DEBUG_CATEGORY_JOINTS:             return "joints";
+        case DEBUG_CATEGORY_CONTROLLERS:        return "controllers";
+        default:                                return "other";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool DebugDraw::cullBounds( const b2Vec2& lowerBound, const b2Vec2& upperBound )
+{
+    CategoryStats& stats = mCategoryStats[mCategory];
+
+    if ( mCullEnabled &&
+        ( upperBound.x < mCullAABB.lowerBound.x || lowerBound.x > mCullAABB.upperBound.x ||
+          upperBound.y < mCullAABB.lowerBound.y || lowerBound.y > mCullAABB.upperBound.y ) )
+    {
+        stats.culled++;
+        return true;
+    }
+
+    stats.primitives++;
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool DebugDraw::cullVertices( const b2Vec2* vertices, const int32 vertexCount )
+{
+    b2Vec2 lowerBound = vertices[0];
+    b2Vec2 upperBound = vertices[0];
+    for ( int32 i = 1; i < vertexCount; ++i )
+    {
+        lowerBound = b2Min( lowerBound, vertices[i] );
+        upperBound = b2Max( upperBound, vertices[i] );
+    }
+
+    return cullBounds( lowerBound, upperBound );
+}
+
+//-----------------------------------------------------------------------------
+
+inline void DebugDraw::addVertex( Vector<DebugVertex>& buffer, const b2Vec2& position, const ColorI& color )
+{
+    DebugVertex vertex;
+    vertex.mPosition.set( position.x, position.y );
+    vertex.mColor = color;
+    buffer.push_back( vertex );
+
+    mCategoryStats[mCategory].vertices++;
+}
+
+//-----------------------------------------------------------------------------
+
+void DebugDraw::drawBuffer( const Vector<DebugVertex>& buffer, const U32 primitive )
+{
+    if ( buffer.size() == 0 )
+        return;
+
+    const DebugVertex* pVertices = buffer.address();
+    glVertexPointer( 2, GL_FLOAT, sizeof(DebugVertex), &pVertices->mPosition );
+    glColorPointer( 4, GL_UNSIGNED_BYTE, sizeof(DebugVertex), &pVertices->mColor );
+    glDrawArrays( (GLenum)primitive, 0, buffer.size() );
+
+    mDrawCallCount++;
+    dglCountDrawCall();
+}
+
+//-----------------------------------------------------------------------------
+
+void DebugDraw::flush( void )
+{
+    // Finish if nothing to flush.
+    if ( mLineVertices.size() == 0 && mTriangleVertices.size() == 0 && mPointVertices.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(DebugDraw_Flush);
+
+    glDisable( GL_TEXTURE_2D );
+    glEnableClientState( GL_VERTEX_ARRAY );
+    glEnableClientState( GL_COLOR_ARRAY );
+
+    // Translucent fills go under the outlines.
+    if ( mTriangleVertices.size() > 0 )
+    {
+        glEnable( GL_BLEND );
+        glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+        drawBuffer( mTriangleVertices, GL_TRIANGLES );
+        glDisable( GL_BLEND );
+    }
+
+    drawBuffer( mLineVertices, GL_LINES );
+
+    // Points are drawn one size at a time.
+    if ( mPointVertices.size() > 0 )
+    {
+        while ( mPointVertices.size() > 0 )
+        {
+            const F32 pointSize = mPointSizes[0];
+
+            mPointBatch.clear();
+            S32 remaining = 0;
+            for ( S32 i = 0; i < mPointVertices.size(); ++i )
+            {
+                if ( mPointSizes[i] == pointSize )
+                {
+                    mPointBatch.push_back( mPointVertices[i] );
+                }
+                else
+                {
+                    mPointVertices[remaining] = mPointVertices[i];
+                    mPointSizes[remaining] = mPointSizes[i];
+                    remaining++;
+                }
+            }
+            mPointVertices.setSize( remaining );
+            mPointSizes.setSize( remaining );
+
+            glPointSize( pointSize );
+            drawBuffer( mPointBatch, GL_POINTS );
+        }
+
+        glPointSize( 1.0f );
+    }
+
+    glDisableClientState( GL_VERTEX_ARRAY );
+    glDisableClientState( GL_COLOR_ARRAY );
+
+    mLineVertices.clear();
+    mTriangleVertices.clear();
+
+    mFlushCount++;
+}
+
+//-----------------------------------------------------------------------------
+
 void DebugDraw::DrawPolygon( const b2Vec2* vertices, int32 vertexCount, const ColorF& color )
 {
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawPolygon);
 
-    glColor3f(color.red, color.green, color.blue);
-    glBegin(GL_LINE_LOOP);
-    for (int32 i = 0; i < vertexCount; ++i)
+    if ( vertexCount < 2 || cullVertices( vertices, vertexCount ) )
+        return;
+
+    const ColorI lineColor( color.red * 255.0f, color.green * 255.0f, color.blue * 255.0f );
+    for ( int32 i = 0; i < vertexCount; ++i )
     {
-        glVertex2f(vertices[i].x, vertices[i].y);
+        addVertex( mLineVertices, vertices[i], lineColor );
+        addVertex( mLineVertices, vertices[(i + 1) % vertexCount], lineColor );
     }
-    glEnd();
 }
 
 //-----------------------------------------------------------------------------
@@ -280,24 +461,24 @@ void DebugDraw::DrawSolidPolygon( const b2Vec2* vertices, int32 vertexCount, con
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawSolidPolygon);
 
-    glEnable(GL_BLEND);
-    glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glColor4f(0.5f * color.red, 0.5f * color.green, 0.5f * color.blue, 0.15f);
-    glBegin(GL_TRIANGLE_FAN);
-    for (int32 i = 0; i < vertexCount; ++i)
+    if ( vertexCount < 2 || cullVertices( vertices, vertexCount ) )
+        return;
+
+    // Fill as a fan.
+    const ColorI fillColor( color.red * 127.5f, color.green * 127.5f, color.blue * 127.5f, 0.15f * 255.0f );
+    for ( int32 i = 1; i < vertexCount - 1; ++i )
     {
-        glVertex2f(vertices[i].x, vertices[i].y);
+        addVertex( mTriangleVertices, vertices[0], fillColor );
+        addVertex( mTriangleVertices, vertices[i], fillColor );
+        addVertex( mTriangleVertices, vertices[i + 1], fillColor );
     }
-    glEnd();
-    glDisable(GL_BLEND);
 
-    glColor4f(color.red, color.green, color.blue, 1.0f);
-    glBegin(GL_LINE_LOOP);
-    for (int32 i = 0; i < vertexCount; ++i)
+    const ColorI lineColor( color.red * 255.0f, color.green * 255.0f, color.blue * 255.0f );
+    for ( int32 i = 0; i < vertexCount; ++i )
     {
-        glVertex2f(vertices[i].x, vertices[i].y);
+        addVertex( mLineVertices, vertices[i], lineColor );
+        addVertex( mLineVertices, vertices[(i + 1) % vertexCount], lineColor );
     }
-    glEnd();
 }
 
 //-----------------------------------------------------------------------------
@@ -307,18 +488,23 @@ void DebugDraw::DrawCircle( const b2Vec2& center, float32 radius, const ColorF&
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawCircle);
 
-    const float32 k_segments = 16.0f;
+    const b2Vec2 extent( radius, radius );
+    if ( cullBounds( center - extent, center + extent ) )
+        return;
+
+    const int32 k_segments = 16;
     const float32 k_increment = 2.0f * b2_pi / k_segments;
-    float32 theta = 0.0f;
-    glColor3f(color.red, color.green, color.blue);
-    glBegin(GL_LINE_LOOP);
-    for (int32 i = 0; i < k_segments; ++i)
+    const ColorI lineColor( color.red * 255.0f, color.green * 255.0f, color.blue * 255.0f );
+
+    b2Vec2 v1 = center + radius * b2Vec2( 1.0f, 0.0f );
+    for ( int32 i = 1; i <= k_segments; ++i )
     {
-        b2Vec2 v = center + radius * b2Vec2(cosf(theta), sinf(theta));
-        glVertex2f(v.x, v.y);
-        theta += k_increment;
+        const float32 theta = k_increment * i;
+        const b2Vec2 v2 = center + radius * b2Vec2( cosf(theta), sinf(theta) );
+        addVertex( mLineVertices, v1, lineColor );
+        addVertex( mLineVertices, v2, lineColor );
+        v1 = v2;
     }
-    glEnd();
 }
     
 //-----------------------------------------------------------------------------
@@ -328,81 +514,72 @@ void DebugDraw::DrawSolidCircle( const b2Vec2& center, float32 radius, const b2V
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawSolidCircle);
 
-    const float32 k_segments = 12.0f;
+    const b2Vec2 extent( radius, radius );
+    if ( cullBounds( center - extent, center + extent ) )
+        return;
+
+    const int32 k_segments = 12;
     const float32 k_increment = 2.0f * b2_pi / k_segments;
-    float32 theta = 0.0f;
-    glEnable(GL_BLEND);
-    glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glColor4f(0.5f * color.red, 0.5f * color.green, 0.5f * color.blue, 0.15f);
-    glBegin(GL_TRIANGLE_FAN);
-    for (int32 i = 0; i < k_segments; ++i)
-    {
-        b2Vec2 v = center + radius * b2Vec2(cosf(theta), sinf(theta));
-        glVertex2f(v.x, v.y);
-        theta += k_increment;
-    }
-    glEnd();
-    glDisable(GL_BLEND);
+    const ColorI fillColor( color.red * 127.5f, color.green * 127.5f, color.blue * 127.5f, 0.15f * 255.0f );
+    const ColorI lineColor( color.red * 255.0f, color.green * 255.0f, color.blue * 255.0f );
 
-    theta = 0.0f;
-    glColor4f(color.red, color.green, color.blue, 1.0f);
-    glBegin(GL_LINE_LOOP);
-    for (int32 i = 0; i < k_segments; ++i)
+    b2Vec2 v1 = center + radius * b2Vec2( 1.0f, 0.0f );
+    for ( int32 i = 1; i <= k_segments; ++i )
     {
-        b2Vec2 v = center + radius * b2Vec2(cosf(theta), sinf(theta));
-        glVertex2f(v.x, v.y);
-        theta += k_increment;
+        const float32 theta = k_increment * i;
+        const b2Vec2 v2 = center + radius * b2Vec2( cosf(theta), sinf(theta) );
+
+        addVertex( mTriangleVertices, center, fillColor );
+        addVertex( mTriangleVertices, v1, fillColor );
+        addVertex( mTriangleVertices, v2, fillColor );
+
+        addVertex( mLineVertices, v1, lineColor );
+        addVertex( mLineVertices, v2, lineColor );
+        v1 = v2;
     }
-    glEnd();
 
-    b2Vec2 p = center + radius * axis;
-    glBegin(GL_LINES);
-    glVertex2f(center.x, center.y);
-    glVertex2f(p.x, p.y);
-    glEnd();
+    // Axis.
+    addVertex( mLineVertices, center, lineColor );
+    addVertex( mLineVertices, center + radius * axis, lineColor );
 }
     
 //-----------------------------------------------------------------------------
 
 void DebugDraw::DrawSegment( const b2Vec2& p1, const b2Vec2& p2, const ColorF& color )
 {
-    glColor3f(color.red, color.green, color.blue);
-    glBegin(GL_LINES);
-    glVertex2f(p1.x, p1.y);
-    glVertex2f(p2.x, p2.y);
-    glEnd();
+    if ( cullBounds( b2Min( p1, p2 ), b2Max( p1, p2 ) ) )
+        return;
+
+    const ColorI lineColor( color.red * 255.0f, color.green * 255.0f, color.blue * 255.0f );
+    addVertex( mLineVertices, p1, lineColor );
+    addVertex( mLineVertices, p2, lineColor );
 }
 
 //-----------------------------------------------------------------------------
 
 void DebugDraw::DrawTransform( const b2Transform& xf )
 {
-    b2Vec2 p1 = xf.p, p2;
     const float32 k_axisScale = 0.4f;
-    glBegin(GL_LINES);
-    
-    glColor3f(1.0f, 0.0f, 0.0f);
-    glVertex2f(p1.x, p1.y);
-    p2 = p1 + k_axisScale * xf.q.GetXAxis();
-    glVertex2f(p2.x, p2.y);
+    const b2Vec2 extent( k_axisScale, k_axisScale );
+    const b2Vec2 p1 = xf.p;
+
+    if ( cullBounds( p1 - extent, p1 + extent ) )
+        return;
 
-    glColor3f(0.0f, 1.0f, 0.0f);
-    glVertex2f(p1.x, p1.y);
-    p2 = p1 + k_axisScale * xf.q.GetYAxis();
-    glVertex2f(p2.x, p2.y);
+    addVertex( mLineVertices, p1, ColorI( 255, 0, 0 ) );
+    addVertex( mLineVertices, p1 + k_axisScale * xf.q.GetXAxis(), ColorI( 255, 0, 0 ) );
 
-    glEnd();
+    addVertex( mLineVertices, p1, ColorI( 0, 255, 0 ) );
+    addVertex( mLineVertices, p1 + k_axisScale * xf.q.GetYAxis(), ColorI( 0, 255, 0 ) );
 }
 
 //-----------------------------------------------------------------------------
 
 void DebugDraw::DrawPoint( const b2Vec2& p, float32 size, const ColorF& color )
 {
-    glPointSize(size);
-    glBegin(GL_POINTS);
-    glColor3f(color.red, color.green, color.blue);
-    glVertex2f(p.x, p.y);
-    glEnd();
-    glPointSize(1.0f);
-}
+    if ( cullBounds( p, p ) )
+        return;
 
+    addVertex( mPointVertices, p, ColorI( color.red * 255.0f, color.green * 255.0f, color.blue * 255.0f ) );
+    mPointSizes.push_back( size );
+}
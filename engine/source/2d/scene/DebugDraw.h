@@ -35,14 +35,61 @@
 #include "graphics/color.h"
 #endif
 
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
+/// Draws the scene debug overlays.
+///
+/// Primitives are appended to line, triangle and point buffers and drawn by
+/// flush() in a handful of draw calls, rather than one immediate-mode draw
+/// per shape. Anything entirely outside the cull area set by beginFrame()
+/// is dropped before it reaches the buffers. Each primitive is counted
+/// against the current category so the cost of each debug option can be
+/// seen in the metrics.
 class DebugDraw
 {
 public:
-    DebugDraw() {}
+    enum DebugCategory
+    {
+        DEBUG_CATEGORY_AABB,
+        DEBUG_CATEGORY_OOBB,
+        DEBUG_CATEGORY_SLEEP,
+        DEBUG_CATEGORY_COLLISION_SHAPES,
+        DEBUG_CATEGORY_POSITION_AND_COM,
+        DEBUG_CATEGORY_SORT_POINTS,
+        DEBUG_CATEGORY_JOINTS,
+        DEBUG_CATEGORY_CONTROLLERS,
+        DEBUG_CATEGORY_OTHER,
+
+        DEBUG_CATEGORY_COUNT
+    };
+
+    /// Per-frame cost of a category.
+    struct CategoryStats
+    {
+        U32 primitives;     ///< Polygons, circles, segments and points drawn.
+        U32 culled;         ///< Primitives dropped by the cull area.
+        U32 vertices;       ///< Vertices added to the buffers.
+    };
+
+public:
+    DebugDraw();
     virtual ~DebugDraw() {}
 
+    /// Start a frame: clears the counters and sets the area outside which primitives are culled.
+    void beginFrame( const b2AABB& cullAABB );
+    /// Draw and clear the buffers.
+    void flush( void );
+
+    inline void setCategory( const DebugCategory category ) { mCategory = category; }
+    inline const CategoryStats& getCategoryStats( const DebugCategory category ) const { return mCategoryStats[category]; }
+    inline U32 getFlushCount( void ) const { return mFlushCount; }
+    inline U32 getDrawCallCount( void ) const { return mDrawCallCount; }
+    static const char* getCategoryDescription( const DebugCategory category );
+
     void DrawAABB( const b2AABB& aabb, const ColorF& color );
     void DrawOOBB( const b2Vec2* pOOBB, const ColorF& color );
     void DrawAsleep( const b2Vec2* pOOBB, const ColorF& color );
@@ -59,6 +106,32 @@ public:
     void DrawSegment( const b2Vec2& p1, const b2Vec2& p2, const ColorF& color);
     void DrawTransform(const b2Transform& xf);
     void DrawPoint(const b2Vec2& p, float32 size, const ColorF& color);
+
+private:
+    struct DebugVertex
+    {
+        Point2F mPosition;
+        ColorI  mColor;
+    };
+
+    bool cullBounds( const b2Vec2& lowerBound, const b2Vec2& upperBound );
+    bool cullVertices( const b2Vec2* vertices, const int32 vertexCount );
+    inline void addVertex( Vector<DebugVertex>& buffer, const b2Vec2& position, const ColorI& color );
+    void drawBuffer( const Vector<DebugVertex>& buffer, const U32 primitive );
+
+    Vector<DebugVertex> mLineVertices;
+    Vector<DebugVertex> mTriangleVertices;
+    Vector<DebugVertex> mPointVertices;
+    Vector<F32>         mPointSizes;
+    Vector<DebugVertex> mPointBatch;
+
+    bool                mCullEnabled;
+    b2AABB              mCullAABB;
+
+    DebugCategory       mCategory;
+    CategoryStats       mCategoryStats[DEBUG_CATEGORY_COUNT];
+    U32                 mFlushCount;
+    U32                 mDrawCallCount;
 };
 
 #endif // _DEBUG_DRAW_H_
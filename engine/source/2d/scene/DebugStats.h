@@ -97,6 +97,9 @@ public:
         // Particles.
         if ( particlesUsed > maxParticlesUsed ) maxParticlesUsed = particlesUsed;
 
+        // Scene tick.
+        if ( tickTime > maxTickTime ) maxTickTime = tickTime;
+
         // World profile.
         if ( worldProfile.step > maxWorldProfile.step ) maxWorldProfile.step = worldProfile.step;
         if ( worldProfile.collide > maxWorldProfile.collide ) maxWorldProfile.collide = worldProfile.collide;
@@ -197,6 +200,9 @@ public:
 
         frameCount = 0;
 
+        tickTime = 0.0f;
+        maxTickTime = 0.0f;
+
         dMemset( &worldProfile, 0, sizeof(worldProfile) );
         dMemset( &maxWorldProfile, 0, sizeof(maxWorldProfile) );
     }
@@ -287,6 +293,9 @@ public:
 
     U32     frameCount;
 
+    F32     tickTime;
+    F32     maxTickTime;
+
     b2Profile worldProfile;
     b2Profile maxWorldProfile;
 };
@@ -171,7 +171,11 @@ Scene::Scene() :
     mIsEditorScene(0),
     mUpdateCallback(false),
     mRenderCallback(false),
-    mSceneIndex(0)
+    mSceneIndex(0),
+
+    /// Batched contact delivery.
+    mContactBufferCallback(false),
+    mContactBufferGroupMask(MASK_ALL)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mSceneObjects );
@@ -191,6 +195,10 @@ Scene::Scene() :
     mControllers = new SimSet();
     mControllers->registerObject();
 
+    // Register the contact buffer.
+    mContactBuffer = new SceneContactBuffer();
+    mContactBuffer->registerObject();
+
     // Assign scene index.    
     mSceneIndex = ++sSceneMasterIndex;
     sSceneCount++;
@@ -204,6 +212,10 @@ Scene::~Scene()
     if ( mControllers.notNull() )
         mControllers->deleteObject();
 
+    // Unregister the contact buffer.
+    if ( mContactBuffer.notNull() )
+        mContactBuffer->deleteObject();
+
     // Decrease scene count.
     --sSceneCount;
 }
@@ -320,6 +332,8 @@ void Scene::initPersistFields()
     // Callbacks.
     addField("UpdateCallback", TypeBool, Offset(mUpdateCallback, Scene), &writeUpdateCallback, "");
     addField("RenderCallback", TypeBool, Offset(mRenderCallback, Scene), &writeRenderCallback, "");
+    addField("ContactBufferCallback", TypeBool, Offset(mContactBufferCallback, Scene), &writeContactBufferCallback, "Whether to deliver a tick's contacts in one 'onSceneContacts' callback instead of per-contact callbacks.");
+    addProtectedField("ContactBuffer", TypeSimObjectPtr, Offset(mContactBuffer, Scene), &defaultProtectedNotSetFn, &defaultProtectedGetFn, &defaultProtectedNotWriteFn, "The buffer holding the last tick's contacts when 'ContactBufferCallback' is on.");
 }
 
 //-----------------------------------------------------------------------------
@@ -596,6 +610,94 @@ void Scene::dispatchBeginContactCallbacks( void )
 
 //-----------------------------------------------------------------------------
 
+bool Scene::fillContactBuffer( const TickContact& tickContact, const bool begin )
+{
+    // Fetch scene objects.
+    SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
+    SceneObject* pSceneObjectB = tickContact.mpSceneObjectB;
+
+    // Skip if either object is being deleted.
+    if ( pSceneObjectA->isBeingDeleted() || pSceneObjectB->isBeingDeleted() )
+        return false;
+
+    // Skip unless either object subscribes with its collision callback and is in a subscribed group.
+    const bool subscribedA = pSceneObjectA->getCollisionCallback() && (pSceneObjectA->getSceneGroupMask() & mContactBufferGroupMask) != 0;
+    const bool subscribedB = pSceneObjectB->getCollisionCallback() && (pSceneObjectB->getSceneGroupMask() & mContactBufferGroupMask) != 0;
+    if ( !subscribedA && !subscribedB )
+        return false;
+
+    // Fetch shape indices.
+    const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
+    const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
+
+    // Sanity!
+    AssertFatal( shapeIndexA >= 0, "Scene::fillContactBuffer() - Cannot find shape index reported on physics proxy of a fixture." );
+    AssertFatal( shapeIndexB >= 0, "Scene::fillContactBuffer() - Cannot find shape index reported on physics proxy of a fixture." );
+
+    // Record the contact.
+    SceneContactBuffer::Contact& contact = mContactBuffer->addContact( begin );
+    contact.mObjectIdA = pSceneObjectA->getId();
+    contact.mObjectIdB = pSceneObjectB->getId();
+    contact.mShapeIndexA = shapeIndexA;
+    contact.mShapeIndexB = shapeIndexB;
+    contact.mPointCount = tickContact.mPointCount;
+    contact.mNormal = tickContact.mWorldManifold.normal;
+    for ( U32 n = 0; n < b2_maxManifoldPoints; ++n )
+    {
+        contact.mPoints[n] = tickContact.mWorldManifold.points[n];
+        contact.mNormalImpulses[n] = tickContact.mNormalImpulses[n];
+        contact.mTangentImpulses[n] = tickContact.mTangentImpulses[n];
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchContactBuffer( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_DispatchContactBuffer);
+
+    // Sanity!
+    AssertFatal( b2_maxManifoldPoints == 2, "Scene::dispatchContactBuffer() - Invalid assumption about max manifold points." );
+
+    // Finish if the buffer has gone.
+    if ( mContactBuffer.isNull() )
+        return;
+
+    // Reset the buffer.
+    mContactBuffer->clearContacts();
+
+    // Gather end contacts first to match the per-contact callback order.
+    for ( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
+        fillContactBuffer( *contactItr, false );
+
+    // Gather begin contacts.
+    for ( typeContactHash::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
+        fillContactBuffer( contactItr->value, true );
+
+    // Finish if nothing was subscribed.
+    if ( mContactBuffer->getContactCount() == 0 )
+        return;
+
+    // Does the scene handle the contacts callback?
+    Namespace* pNamespace = getNamespace();
+    if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneContacts" ) ) != NULL )
+    {
+        // Yes, so perform script callback on the Scene.
+        Con::executef( this, 2, "onSceneContacts", mContactBuffer->getIdString() );
+    }
+    else
+    {
+        // No, so call it on its behaviors.
+        const char* args[3] = { "onSceneContacts", "", mContactBuffer->getIdString() };
+        callOnBehaviors( 3, args );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::dispatchEndContactCallbacks( void )
 {
     // Debug Profiling.
@@ -717,6 +819,9 @@ void Scene::processTick( void )
     if ( !isProperlyAdded() )
         return;
 
+    // Time the whole tick.
+    b2Timer tickTimer;
+
     // Process Delete Requests.
     processDeleteRequests(false);
 
@@ -820,7 +925,15 @@ void Scene::processTick( void )
             // Yes, so fetch scene controller count.
             const S32 sceneControllerCount = (S32)pControllerSet->size();
 
+            // Discard last tick's body snapshot; the first controller to query rebuilds it if
+            // there are enough controllers to share it.
+            mControllerBodyGrid.invalidate();
+            mControllerBodyGrid.setActive( ControllerBodyGrid::isWorthBuilding( (U32)sceneControllerCount, (U32)mSceneObjects.size() ) );
+
             // Iterate scene controllers.
+            // NOTE: Controllers integrate their bodies serially. Applying a force costs around 6ns per body
+            // whereas handing work to another thread costs several microseconds so splitting a controller's
+            // bodies across threads only pays off with well over a thousand bodies in its area.
             for( S32 i = 0; i < sceneControllerCount; i++ )
             {
                 // Fetch the scene controller.
@@ -833,6 +946,10 @@ void Scene::processTick( void )
                 // Integrate.
                 pController->integrate( this, mSceneTime, Tickable::smTickSec, pDebugStats );
             }
+
+            // Don't hold the snapshot beyond the controllers as objects may be removed before the next tick.
+            mControllerBodyGrid.invalidate();
+            mControllerBodyGrid.setActive( false );
         }
 
         // Debug Profiling.
@@ -896,14 +1013,24 @@ void Scene::processTick( void )
         if ( isNormalScene )
         {
             // Dispatch contacts callbacks.
-            dispatchEndContactCallbacks();
-            dispatchBeginContactCallbacks();
+            if ( mContactBufferCallback )
+            {
+                dispatchContactBuffer();
+            }
+            else
+            {
+                dispatchEndContactCallbacks();
+                dispatchBeginContactCallbacks();
+            }
         }
 
         // Clear ticked scene objects.
         mTickedSceneObjects.clear();
     }
 
+    // Update tick time.
+    mDebugStats.tickTime = tickTimer.GetMilliseconds();
+
     // Update debug stat ranges.
     mDebugStats.updateRanges();
 }
@@ -977,6 +1104,9 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     b2AABB cameraAABB;
     CoreMath::mRotateAABB( pSceneRenderState->mRenderAABB, pSceneRenderState->mRenderAngle, cameraAABB );
 
+    // Start the debug draw frame culled to the camera.
+    mDebugDraw.beginFrame( cameraAABB );
+
     // Rotate the world matrix by the camera angle.
     const Vector2& cameraPosition = pSceneRenderState->mRenderPosition;
     glTranslatef( cameraPosition.x, cameraPosition.y, 0.0f );
@@ -1204,6 +1334,10 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     // Render object overlay.
                     pSceneObject->sceneRenderOverlay( pSceneRenderState );
                 }
+
+                // Flush debug draw.
+                // NOTE:    Overlays are batched per layer so they stay above the layer they belong to.
+                mDebugDraw.flush();
             }
 
             // Reset render queue.
@@ -1240,11 +1374,15 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     continue;
 
                 // Render the overlay.
+                mDebugDraw.setCategory( DebugDraw::DEBUG_CATEGORY_CONTROLLERS );
                 pController->renderOverlay( this, pSceneRenderState, &mBatchRenderer );
             }
 
             // Flush isolated batch.
             mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
+
+            // Flush debug draw.
+            mDebugDraw.flush();
         }
     }
 
@@ -1254,7 +1392,9 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
         // Debug Profiling.
         PROFILE_SCOPE(Scene_RenderSceneJointOverlays);
 
+        mDebugDraw.setCategory( DebugDraw::DEBUG_CATEGORY_JOINTS );
         mDebugDraw.DrawJoints( mpWorld );
+        mDebugDraw.flush();
     }
 
     // Update debug stat ranges.
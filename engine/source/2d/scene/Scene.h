@@ -47,6 +47,14 @@
 #include "2d/scene/WorldQuery.h"
 #endif
 
+#ifndef _CONTROLLER_BODY_GRID_H_
+#include "2d/scene/ControllerBodyGrid.h"
+#endif
+
+#ifndef _SCENE_CONTACT_BUFFER_H_
+#include "2d/scene/SceneContactBuffer.h"
+#endif
+
 #ifndef _DEBUG_DRAW_H_
 #include "2d/scene/DebugDraw.h"
 #endif
@@ -213,6 +221,7 @@ private:
     /// World.
     b2World*                    mpWorld;
     WorldQuery*                 mpWorldQuery;
+    ControllerBodyGrid          mControllerBodyGrid;
     b2Vec2                      mWorldGravity;
     S32                         mVelocityIterations;
     S32                         mPositionIterations;
@@ -267,11 +276,18 @@ private:
     typeContactVector           mEndContacts;
     U32                         mSceneIndex;
 
+    /// Batched contact delivery.
+    bool                        mContactBufferCallback;
+    U32                         mContactBufferGroupMask;
+    SimObjectPtr<SceneContactBuffer> mContactBuffer;
+
 private:   
     /// Contacts.
     void                        forwardContacts( void );
     void                        dispatchBeginContactCallbacks( void );
     void                        dispatchEndContactCallbacks( void );
+    void                        dispatchContactBuffer( void );
+    bool                        fillContactBuffer( const TickContact& tickContact, const bool begin );
 
     /// Joint definition.
     struct CommonJointDefinition
@@ -330,6 +346,7 @@ public:
     /// World.
     inline b2World*         getWorld( void ) const                      { return mpWorld; }
     inline WorldQuery*      getWorldQuery( const bool clearQuery = false ) { if ( clearQuery ) mpWorldQuery->clearQuery(); return mpWorldQuery; }
+    inline const ControllerBodyGrid* getControllerBodyGrid( void )      { if ( !mControllerBodyGrid.isActive() ) return NULL; if ( !mControllerBodyGrid.isValid() ) mControllerBodyGrid.build( mSceneObjects ); return &mControllerBodyGrid; }
     b2BlockAllocator*       getBlockAllocator( void )                   { return &mBlockAllocator; }
     inline b2Body*          getGroundBody( void ) const                 { return mpGroundBody; }
     virtual ePhysicsProxyType getPhysicsProxyType( void ) const         { return PhysicsProxy::PHYSIC_PROXY_GROUNDBODY; }
@@ -664,6 +681,11 @@ public:
     inline bool             getUpdateCallback( void ) const             { return mUpdateCallback; }
     inline void             setRenderCallback( const bool callback )    { mRenderCallback = callback; }
     inline bool             getRenderCallback( void ) const             { return mRenderCallback; }
+    inline void             setContactBufferCallback( const bool callback ) { mContactBufferCallback = callback; }
+    inline bool             getContactBufferCallback( void ) const      { return mContactBufferCallback; }
+    inline void             setContactBufferGroupMask( const U32 groupMask ) { mContactBufferGroupMask = groupMask; }
+    inline U32              getContactBufferGroupMask( void ) const     { return mContactBufferGroupMask; }
+    inline SceneContactBuffer* getContactBuffer( void ) const           { return mContactBuffer; }
     static SceneRenderRequest* createDefaultRenderRequest( SceneRenderQueue* pSceneRenderQueue, SceneObject* pSceneObject  );
 
     /// Taml children.
@@ -722,6 +744,7 @@ protected:
     // Callbacks.
     static bool writeUpdateCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getUpdateCallback(); }
     static bool writeRenderCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getRenderCallback(); }
+    static bool writeContactBufferCallback( void* obj, StringTableEntry pFieldName ) { return static_cast<Scene*>(obj)->getContactBufferCallback(); }
 
 public:
     static SimObjectPtr<Scene> LoadingScene;
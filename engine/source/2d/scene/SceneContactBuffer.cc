@@ -0,0 +1,90 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_CONTACT_BUFFER_H_
+#include "2d/scene/SceneContactBuffer.h"
+#endif
+
+// Script bindings.
+#include "2d/scene/SceneContactBuffer_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+IMPLEMENT_CONOBJECT( SceneContactBuffer );
+
+//-----------------------------------------------------------------------------
+
+SceneContactBuffer::SceneContactBuffer() :
+    mBeginContactCount( 0 )
+{
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mContacts );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneContactBuffer::clearContacts( void )
+{
+    // Keep the storage for the next tick.
+    mContacts.clear();
+    mBeginContactCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneContactBuffer::formatContactInfo( const U32 index, char* pBuffer, const U32 bufferSize ) const
+{
+    // Sanity!
+    AssertFatal( index < (U32)mContacts.size(), "SceneContactBuffer::formatContactInfo() - Invalid contact index." );
+
+    // Fetch contact.
+    const Contact& contact = mContacts[index];
+
+    // End contacts only carry the shape indices.
+    if ( contact.mBegin && contact.mPointCount == 2 )
+    {
+        dSprintf( pBuffer, bufferSize,
+            "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+            contact.mShapeIndexA, contact.mShapeIndexB,
+            contact.mNormal.x, contact.mNormal.y,
+            contact.mPoints[0].x, contact.mPoints[0].y,
+            contact.mNormalImpulses[0],
+            contact.mTangentImpulses[0],
+            contact.mPoints[1].x, contact.mPoints[1].y,
+            contact.mNormalImpulses[1],
+            contact.mTangentImpulses[1] );
+    }
+    else if ( contact.mBegin && contact.mPointCount == 1 )
+    {
+        dSprintf( pBuffer, bufferSize,
+            "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+            contact.mShapeIndexA, contact.mShapeIndexB,
+            contact.mNormal.x, contact.mNormal.y,
+            contact.mPoints[0].x, contact.mPoints[0].y,
+            contact.mNormalImpulses[0],
+            contact.mTangentImpulses[0] );
+    }
+    else
+    {
+        dSprintf( pBuffer, bufferSize, "%d %d", contact.mShapeIndexA, contact.mShapeIndexB );
+    }
+}
@@ -0,0 +1,86 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_CONTACT_BUFFER_H_
+#define _SCENE_CONTACT_BUFFER_H_
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// The contacts a scene gathered during a tick, delivered to script as a single object.
+///
+/// When a scene has "ContactBufferCallback" enabled it fills this buffer instead of issuing
+/// "onSceneCollision", "onCollision" and "onEndCollision" per contact, then calls
+/// "onSceneContacts" once.  Records are plain data; the misc-info string used by the
+/// per-contact callbacks is only formatted when script asks for it.
+class SceneContactBuffer : public SimObject
+{
+    typedef SimObject Parent;
+
+public:
+    struct Contact
+    {
+        SimObjectId     mObjectIdA;
+        SimObjectId     mObjectIdB;
+        S32             mShapeIndexA;
+        S32             mShapeIndexB;
+        bool            mBegin;
+        U32             mPointCount;
+        Vector2         mNormal;
+        Vector2         mPoints[2];
+        F32             mNormalImpulses[2];
+        F32             mTangentImpulses[2];
+    };
+
+    typedef Vector<Contact> typeContactVector;
+
+private:
+    typeContactVector   mContacts;
+    U32                 mBeginContactCount;
+
+public:
+    SceneContactBuffer();
+    virtual ~SceneContactBuffer() {}
+
+    void                clearContacts( void );
+    inline Contact&     addContact( const bool begin )                      { mContacts.increment(); Contact& contact = mContacts.last(); contact.mBegin = begin; if ( begin ) mBeginContactCount++; return contact; }
+
+    inline U32          getContactCount( void ) const                       { return (U32)mContacts.size(); }
+    inline U32          getBeginContactCount( void ) const                  { return mBeginContactCount; }
+    inline U32          getEndContactCount( void ) const                    { return getContactCount() - mBeginContactCount; }
+    inline const Contact& getContact( const U32 index ) const               { return mContacts[index]; }
+
+    /// Formats a contact the same way as the misc-info argument of the per-contact callbacks.
+    void                formatContactInfo( const U32 index, char* pBuffer, const U32 bufferSize ) const;
+
+    /// Declare Console Object.
+    DECLARE_CONOBJECT( SceneContactBuffer );
+};
+
+#endif // _SCENE_CONTACT_BUFFER_H_
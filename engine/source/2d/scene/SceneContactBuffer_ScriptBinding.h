@@ -0,0 +1,212 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleMethodGroupBeginWithDocs(SceneContactBuffer, SimObject)
+
+/*! Gets the number of contacts in the buffer.
+    @return The number of begin and end contacts gathered in the last scene tick.
+*/
+ConsoleMethodWithDocs(SceneContactBuffer, getContactCount, ConsoleInt, 2, 2, ())
+{
+    return object->getContactCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of begin contacts in the buffer.
+    @return The number of contacts that began in the last scene tick.
+*/
+ConsoleMethodWithDocs(SceneContactBuffer, getBeginContactCount, ConsoleInt, 2, 2, ())
+{
+    return object->getBeginContactCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of end contacts in the buffer.
+    @return The number of contacts that ended in the last scene tick.
+*/
+ConsoleMethodWithDocs(SceneContactBuffer, getEndContactCount, ConsoleInt, 2, 2, ())
+{
+    return object->getEndContactCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the contact began or ended.
+    @param contactIndex The contact index.
+    @return Whether the contact began (true) or ended (false).
+*/
+ConsoleMethodWithDocs(SceneContactBuffer, isBeginContact, ConsoleBool, 3, 3, (contactIndex))
+{
+    const U32 contactIndex = dAtoi(argv[2]);
+
+    if ( contactIndex >= object->getContactCount() )
+    {
+        Con::warnf("SceneContactBuffer::isBeginContact() - Invalid contact index '%d'.", contactIndex );
+        return false;
+    }
+
+    return object->getContact( contactIndex ).mBegin;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the scene objects involved in the contact.
+    @param contactIndex The contact index.
+    @return (sceneObjectA sceneObjectB) The scene objects involved in the contact.
+*/
+ConsoleMethodWithDocs(SceneContactBuffer, getContactObjects, ConsoleString, 3, 3, (contactIndex))
+{
+    const U32 contactIndex = dAtoi(argv[2]);
+
+    if ( contactIndex >= object->getContactCount() )
+    {
+        Con::warnf("SceneContactBuffer::getContactObjects() - Invalid contact index '%d'.", contactIndex );
+        return NULL;
+    }
+
+    const SceneContactBuffer::Contact& contact = object->getContact( contactIndex );
+
+    char* pBuffer = Con::getReturnBuffer(32);
+    dSprintf( pBuffer, 32, "%d %d", contact.mObjectIdA, contact.mObjectIdB );
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the collision shape indices involved in the contact.
+    @param contactIndex The contact index.
+    @return (shapeIndexA shapeIndexB) The collision shape indices on each scene object.
+*/
+ConsoleMethodWithDocs(SceneContactBuffer, getContactShapes, ConsoleString, 3, 3, (contactIndex))
+{
+    const U32 contactIndex = dAtoi(argv[2]);
+
+    if ( contactIndex >= object->getContactCount() )
+    {
+        Con::warnf("SceneContactBuffer::getContactShapes() - Invalid contact index '%d'.", contactIndex );
+        return NULL;
+    }
+
+    const SceneContactBuffer::Contact& contact = object->getContact( contactIndex );
+
+    char* pBuffer = Con::getReturnBuffer(32);
+    dSprintf( pBuffer, 32, "%d %d", contact.mShapeIndexA, contact.mShapeIndexB );
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of manifold points in the contact.
+    @param contactIndex The contact index.
+    @return The number of manifold points (zero for end contacts).
+*/
+ConsoleMethodWithDocs(SceneContactBuffer, getContactPointCount, ConsoleInt, 3, 3, (contactIndex))
+{
+    const U32 contactIndex = dAtoi(argv[2]);
+
+    if ( contactIndex >= object->getContactCount() )
+    {
+        Con::warnf("SceneContactBuffer::getContactPointCount() - Invalid contact index '%d'.", contactIndex );
+        return 0;
+    }
+
+    const SceneContactBuffer::Contact& contact = object->getContact( contactIndex );
+
+    return contact.mBegin ? contact.mPointCount : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the contact normal.
+    @param contactIndex The contact index.
+    @return (normalX normalY) The contact normal.
+*/
+ConsoleMethodWithDocs(SceneContactBuffer, getContactNormal, ConsoleString, 3, 3, (contactIndex))
+{
+    const U32 contactIndex = dAtoi(argv[2]);
+
+    if ( contactIndex >= object->getContactCount() )
+    {
+        Con::warnf("SceneContactBuffer::getContactNormal() - Invalid contact index '%d'.", contactIndex );
+        return NULL;
+    }
+
+    return object->getContact( contactIndex ).mNormal.scriptThis();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets a manifold point of the contact.
+    @param contactIndex The contact index.
+    @param pointIndex The manifold point index (0 or 1).
+    @return (pointX pointY normalImpulse tangentImpulse) The world point and the impulses applied there.
+*/
+ConsoleMethodWithDocs(SceneContactBuffer, getContactPoint, ConsoleString, 4, 4, (contactIndex, pointIndex))
+{
+    const U32 contactIndex = dAtoi(argv[2]);
+    const U32 pointIndex = dAtoi(argv[3]);
+
+    if ( contactIndex >= object->getContactCount() )
+    {
+        Con::warnf("SceneContactBuffer::getContactPoint() - Invalid contact index '%d'.", contactIndex );
+        return NULL;
+    }
+
+    const SceneContactBuffer::Contact& contact = object->getContact( contactIndex );
+
+    if ( !contact.mBegin || pointIndex >= contact.mPointCount )
+    {
+        Con::warnf("SceneContactBuffer::getContactPoint() - Invalid point index '%d'.", pointIndex );
+        return NULL;
+    }
+
+    char* pBuffer = Con::getReturnBuffer(64);
+    dSprintf( pBuffer, 64, "%0.4f %0.4f %0.4f %0.4f",
+        contact.mPoints[pointIndex].x, contact.mPoints[pointIndex].y,
+        contact.mNormalImpulses[pointIndex], contact.mTangentImpulses[pointIndex] );
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the contact formatted like the details argument of "onCollision" and "onEndCollision".
+    @param contactIndex The contact index.
+    @return The contact details.
+*/
+ConsoleMethodWithDocs(SceneContactBuffer, getContactInfo, ConsoleString, 3, 3, (contactIndex))
+{
+    const U32 contactIndex = dAtoi(argv[2]);
+
+    if ( contactIndex >= object->getContactCount() )
+    {
+        Con::warnf("SceneContactBuffer::getContactInfo() - Invalid contact index '%d'.", contactIndex );
+        return NULL;
+    }
+
+    char* pBuffer = Con::getReturnBuffer(128);
+    object->formatContactInfo( contactIndex, pBuffer, 128 );
+    return pBuffer;
+}
+
+ConsoleMethodGroupEndWithDocs(SceneContactBuffer)
@@ -3542,6 +3542,27 @@ ConsoleMethodWithDocs(Scene, getFrameCount, ConsoleInt, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Gets the time taken by the last scene tick.
+    This covers the objects, controllers, physics and callbacks but not rendering so it compares directly between headless and windowed games.
+    @return The time taken by the last scene tick in milliseconds.
+*/
+ConsoleMethodWithDocs(Scene, getTickTime, ConsoleFloat, 2, 2, ())
+{
+    return object->getDebugStats().tickTime;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the longest scene tick since the debug statistics were reset.
+    @return The longest scene tick in milliseconds.
+*/
+ConsoleMethodWithDocs(Scene, getMaxTickTime, ConsoleFloat, 2, 2, ())
+{
+    return object->getDebugStats().maxTickTime;
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether render batching is enabled or not.
     @param enabled Whether render batching is enabled or not.
     return No return value.
@@ -3589,4 +3610,107 @@ ConsoleMethodWithDocs(Scene, create, ConsoleString, 3, 3, (type))
     return pSceneObject == NULL ? NULL : pSceneObject->getIdString();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Sets the scene group(s) whose contacts are gathered into the contact buffer.
+    A contact is gathered when either object has its collision callback on and is in one of these groups.
+    @param groups A list of groups to gather contacts for.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setContactBufferGroups, ConsoleVoid, 3, 2 + MASK_BITCOUNT, (groups$))
+{
+    // The mask.
+    U32 mask = 0;
+
+    // Grab the element count of the first parameter.
+    const U32 elementCount = Utility::mGetStringElementCount(argv[2]);
+
+    // Make sure we get at least one number.
+    if (elementCount < 1)
+    {
+        object->setContactBufferGroupMask(MASK_ALL);
+        return;
+    }
+
+    // Space separated list.
+    if (argc == 3)
+    {
+        // Convert the string to a mask.
+        for (U32 i = 0; i < elementCount; i++)
+        {
+            S32 bit = dAtoi(Utility::mGetStringElement(argv[2], i));
+
+            // Make sure the group is valid.
+            if ((bit < 0) || (bit >= MASK_BITCOUNT))
+            {
+                Con::warnf("Scene::setContactBufferGroups() - Invalid group specified (%d); skipped!", bit);
+                continue;
+            }
+
+            mask |= (1 << bit);
+        }
+    }
+
+    // Comma separated list.
+    else
+    {
+        // Convert the list to a mask.
+        for (U32 i = 2; i < (U32)argc; i++)
+        {
+            S32 bit = dAtoi(argv[i]);
+
+            // Make sure the group is valid.
+            if ((bit < 0) || (bit >= MASK_BITCOUNT))
+            {
+                Con::warnf("Scene::setContactBufferGroups() - Invalid group specified (%d); skipped!", bit);
+                continue;
+            }
+
+            mask |= (1 << bit);
+        }
+    }
+
+    // Set contact buffer groups.
+    object->setContactBufferGroupMask(mask);
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the scene groups whose contacts are gathered into the contact buffer.
+    @return (groups) A list of groups to gather contacts for.
+*/
+ConsoleMethodWithDocs(Scene, getContactBufferGroups, ConsoleString, 2, 2, ())
+{
+    U32 mask = object->getContactBufferGroupMask();
+
+    bool first = true;
+    char* bits = Con::getReturnBuffer(128);
+    bits[0] = '\0';
+    for (S32 i = 0; i < MASK_BITCOUNT; i++)
+    {
+        if (mask & BIT(i))
+        {
+            char bit[4];
+            dSprintf(bit, 4, "%s%d", first ? "" : " ", i);
+            first = false;
+            dStrcat(bits, bit);
+        }
+    }
+
+    return bits;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the contact buffer.
+    The buffer is refilled each tick while "ContactBufferCallback" is on and passed to "onSceneContacts".
+    @return The SceneContactBuffer holding the last tick's contacts.
+*/
+ConsoleMethodWithDocs(Scene, getContactBuffer, ConsoleInt, 2, 2, ())
+{
+    SceneContactBuffer* pContactBuffer = object->getContactBuffer();
+
+    return pContactBuffer == NULL ? 0 : pContactBuffer->getId();
+}
+
 ConsoleMethodGroupEndWithDocs(Scene)
@@ -109,6 +109,8 @@ void CompositeSprite::initPersistFields()
     addProtectedField( "DefaultSpriteAngle", TypeF32, Offset(mDefaultSpriteSize, CompositeSprite), &setDefaultSpriteAngle, &getDefaultSpriteAngle, &writeDefaultSpriteAngle, "");
     addProtectedField( "BatchLayout", TypeEnum, Offset(mBatchLayoutType, CompositeSprite), &setBatchLayout, &defaultProtectedGetFn, &writeBatchLayout, 1, &batchLayoutTypeTable, "");
     addProtectedField( "BatchCulling", TypeBool, Offset(mBatchCulling, CompositeSprite), &setBatchCulling, &defaultProtectedGetFn, &writeBatchCulling, "");
+    addProtectedField( "BatchCullingGrid", TypeBool, Offset(mBatchCullingGrid, CompositeSprite), &setBatchCullingGrid, &defaultProtectedGetFn, &writeBatchCullingGrid, "");
+    addProtectedField( "BatchStatic", TypeBool, Offset(mBatchStatic, CompositeSprite), &setBatchStatic, &defaultProtectedGetFn, &writeBatchStatic, "");
     addField( "BatchIsolated", TypeBool, Offset(mBatchIsolated, CompositeSprite), &writeBatchIsolated, "");
     addField( "BatchSortMode", TypeEnum, Offset(mBatchSortMode, CompositeSprite), &writeBatchSortMode, 1, &SceneRenderQueue::renderSortTable, "");
 }
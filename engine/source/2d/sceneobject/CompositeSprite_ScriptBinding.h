@@ -151,6 +151,58 @@ ConsoleMethodWithDocs(CompositeSprite, getBatchCulling, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether the sprites are culled using a uniform grid rather than a tree.
+    The grid cells are the size of the default sprite stride so culling a regular tile map becomes simple index math.
+    The grid is rebuilt when any sprite is added, removed or moved so it suits layouts that rarely change.
+    Batch culling must be on for the grid to be used.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchCullingGrid, ConsoleVoid, 3, 3, (bool batchCullingGrid))
+{
+    // Fetch batch culling grid.
+    const bool batchCullingGrid = dAtob(argv[2]);
+
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchCullingGrid( batchCullingGrid );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the sprites are culled using a uniform grid or not.
+    @return Whether the sprites are culled using a uniform grid or not.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchCullingGrid, ConsoleBool, 2, 2, ())
+{
+    return object->getBatchCullingGrid();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the sprites are cached as a static batch.
+    Static-image sprites are cached as world-space quads in cells which are only rebuilt when a sprite or the composite changes.
+    This is considerably faster for large composites that rarely change such as tile maps.
+    The static batch is only used when the batch sort mode is off; animated sprites are still rendered individually.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchStatic, ConsoleVoid, 3, 3, (bool batchStatic))
+{
+    // Fetch batch static.
+    const bool batchStatic = dAtob(argv[2]);
+
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchStatic( batchStatic );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the sprites are cached as a static batch or not.
+    @return Whether the sprites are cached as a static batch or not.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchStatic, ConsoleBool, 2, 2, ())
+{
+    return object->getBatchStatic();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets the batch render sort mode.
     The render sort mode is used when isolated batch mode is on.
     @return No return value.
@@ -471,6 +523,27 @@ ConsoleMethodWithDocs(CompositeSprite, getSpriteAnimation, ConsoleString, 2, 2,
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether the sprite animation is driven by a clock shared with every other sprite playing the same cycling animation at the same time-scale.
+    @param sharedClock Whether to use a shared animation clock. False by default.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setSpriteSharedAnimationClock, ConsoleVoid, 3, 3, (bool sharedClock))
+{
+    object->setSpriteSharedAnimationClock( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the sprite animation is driven by a shared clock.
+    @return Whether a shared animation clock is requested.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getSpriteSharedAnimationClock, ConsoleBool, 2, 2, ())
+{
+    return object->getSpriteSharedAnimationClock();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Clears any image or animation asset from the sprite.
     @return No return value.
 */
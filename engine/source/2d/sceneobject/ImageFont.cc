@@ -32,6 +32,9 @@
 
 #include "ImageFont.h"
 
+// Debug Profiling.
+#include "debug/profiler.h"
+
 // Script bindings.
 #include "ImageFont_ScriptBinding.h"
 
@@ -89,13 +92,22 @@ IMPLEMENT_CONOBJECT(ImageFont);
 ImageFont::ImageFont() :
     mTextAlignment( ImageFont::ALIGN_CENTER ),
     mFontSize( 1.0f, 1.0f ),
-    mFontPadding( 0 )
+    mFontPadding( 0 ),
+    mGlyphLayoutSize( 0.0f, 0.0f ),
+    mGlyphLayoutDirty( true )
 {
    // Use a static body by default.
    mBodyDefinition.type = b2_staticBody;
 
     // Set as auto-sizing.
     mAutoSizing = true;
+
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mGlyphVertices );
+    VECTOR_SET_ASSOCIATION( mGlyphTexCoords );
+
+    // Register for refresh notifications.
+    mImageAsset.registerRefreshNotify( this );
 }
 
 //-----------------------------------------------------------------------------
@@ -169,23 +181,68 @@ void ImageFont::scenePrepareRender( const SceneRenderState* pSceneRenderState, S
 
 //------------------------------------------------------------------------------
 
+// Scratch buffer used to transform the cached glyph quads for submission.
+static Vector<Vector2> sGlyphRenderVertices;
+
+//------------------------------------------------------------------------------
+
 void ImageFont::sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
 {
+    // Debug Profiling.
+    PROFILE_SCOPE(ImageFont_SceneRender);
+
     // Finish if no image asset.
     if ( mImageAsset.isNull() )
         return;
 
-    // Fetch number of characters to render.
-    const U32 renderCharacters = mText.length();
-
     // Ignore if no text to render.
-    if( renderCharacters == 0 )
+    if( mText.length() == 0 )
         return;
 
-    // Fetch render OOBB.
-    const Vector2& renderOOBB0 = mRenderOOBB[0];
-    const Vector2& renderOOBB1 = mRenderOOBB[1];
-    const Vector2& renderOOBB3 = mRenderOOBB[3];
+    // Rebuild the glyph layout if it has changed.
+    if ( getGlyphLayoutDirty() )
+        updateGlyphLayout();
+
+    // Transform the glyph quads into world-space.
+    const b2Transform renderTransform = getRenderTransform();
+    const U32 vertexCount = mGlyphVertices.size();
+    sGlyphRenderVertices.setSize( vertexCount );
+    for ( U32 n = 0; n < vertexCount; ++n )
+    {
+        sGlyphRenderVertices[n] = b2Mul( renderTransform, mGlyphVertices[n] );
+    }
+
+    // Submit batched quads.
+    pBatchRenderer->SubmitQuads(
+        vertexCount / 4,
+        sGlyphRenderVertices.address(),
+        mGlyphTexCoords.address(),
+        mImageAsset->getImageTexture() );
+}
+
+//------------------------------------------------------------------------------
+
+void ImageFont::updateGlyphLayout( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ImageFont_UpdateGlyphLayout);
+
+    mGlyphVertices.clear();
+    mGlyphTexCoords.clear();
+
+    mGlyphLayoutSize = mSize;
+    mGlyphLayoutDirty = false;
+
+    // Finish if nothing to lay out.
+    const U32 renderCharacters = mText.length();
+    if ( mImageAsset.isNull() || renderCharacters == 0 )
+        return;
+
+    // Fetch local OOBB.
+    const Vector2 halfSize = getHalfSize();
+    const Vector2 localOOBB0( -halfSize.x, -halfSize.y );
+    const Vector2 localOOBB1( +halfSize.x, -halfSize.y );
+    const Vector2 localOOBB3( -halfSize.x, +halfSize.y );
 
     Vector2 characterOOBB0;
     Vector2 characterOOBB1;
@@ -198,14 +255,14 @@ void ImageFont::sceneRender( const SceneRenderState* pSceneRenderState, const Sc
         case ALIGN_LEFT:
             {
                 // Size is twice the padded text width as we're aligning to the left from the position expanding rightwards.
-                characterOOBB0.Set( (renderOOBB0.x + renderOOBB1.x)*0.5f, renderOOBB0.y );
+                characterOOBB0.Set( (localOOBB0.x + localOOBB1.x)*0.5f, localOOBB0.y );
             }
             break;
 
         case ALIGN_RIGHT:
             {
                 // Size is twice the padded text width as we're aligning to the right from the position expanding leftwards.
-                characterOOBB0 = renderOOBB0;
+                characterOOBB0 = localOOBB0;
             }
             break;
 
@@ -217,17 +274,17 @@ void ImageFont::sceneRender( const SceneRenderState* pSceneRenderState, const Sc
         case ALIGN_CENTER:
             {
                 // Size is the total padded text size as we're simply centered on the position.
-                characterOOBB0 = renderOOBB0;
+                characterOOBB0 = localOOBB0;
             }
             break;
     }
 
     // Calculate character width stride.
-    Vector2 characterWidthStride = (renderOOBB1 - renderOOBB0);
+    Vector2 characterWidthStride = (localOOBB1 - localOOBB0);
     characterWidthStride.Normalize( mFontSize.x + mFontPadding );
 
     // Calculate character height stride.
-    Vector2 characterHeightStride = (renderOOBB3 - renderOOBB0);
+    Vector2 characterHeightStride = (localOOBB3 - localOOBB0);
     characterHeightStride.Normalize( mFontSize.y );
 
     // Complete character OOBB.
@@ -235,7 +292,12 @@ void ImageFont::sceneRender( const SceneRenderState* pSceneRenderState, const Sc
     characterOOBB2 = characterOOBB1 + characterHeightStride;
     characterOOBB3 = characterOOBB2 - characterWidthStride;
 
-    // Render all the characters.    
+    mGlyphVertices.setSize( renderCharacters * 4 );
+    mGlyphTexCoords.setSize( renderCharacters * 4 );
+    Vector2* pGlyphVertex = mGlyphVertices.address();
+    Vector2* pGlyphTexCoord = mGlyphTexCoords.address();
+
+    // Lay out all the characters.
     for( U32 characterIndex = 0; characterIndex < renderCharacters; ++characterIndex )
     {
         // Fetch character.
@@ -255,17 +317,15 @@ void ImageFont::sceneRender( const SceneRenderState* pSceneRenderState, const Sc
         const Vector2& texLower = texelFrameArea.mTexelLower;
         const Vector2& texUpper = texelFrameArea.mTexelUpper;
 
-        // Submit batched quad.
-        pBatchRenderer->SubmitQuad(
-            characterOOBB0,
-            characterOOBB1,
-            characterOOBB2,
-            characterOOBB3,
-            Vector2( texLower.x, texUpper.y ),
-            Vector2( texUpper.x, texUpper.y ),
-            Vector2( texUpper.x, texLower.y ),
-            Vector2( texLower.x, texLower.y ),
-            mImageAsset->getImageTexture() );
+        // Store glyph quad.
+        *(pGlyphVertex++) = characterOOBB0;
+        *(pGlyphVertex++) = characterOOBB1;
+        *(pGlyphVertex++) = characterOOBB2;
+        *(pGlyphVertex++) = characterOOBB3;
+        (pGlyphTexCoord++)->Set( texLower.x, texUpper.y );
+        (pGlyphTexCoord++)->Set( texUpper.x, texUpper.y );
+        (pGlyphTexCoord++)->Set( texUpper.x, texLower.y );
+        (pGlyphTexCoord++)->Set( texLower.x, texLower.y );
 
         // Translate character OOBB.
         characterOOBB0 += characterWidthStride;
@@ -275,7 +335,6 @@ void ImageFont::sceneRender( const SceneRenderState* pSceneRenderState, const Sc
     }
 }
 
-
 //-----------------------------------------------------------------------------
 
 bool ImageFont::setImage( const char* pImageAssetId )
@@ -283,6 +342,9 @@ bool ImageFont::setImage( const char* pImageAssetId )
     // Set asset.
     mImageAsset = pImageAssetId;
 
+    // Rebuild the glyph layout.
+    invalidateGlyphLayout();
+
     // Finish if no image asset.
     if ( mImageAsset.isNull() )
         return false;
@@ -338,6 +400,9 @@ void ImageFont::setFontPadding( const F32 padding )
 
 void ImageFont::calculateSpatials( void )
 {
+    // Rebuild the glyph layout.
+    invalidateGlyphLayout();
+
     // Fetch number of characters to render.
     const U32 renderCharacters = mText.length();
 
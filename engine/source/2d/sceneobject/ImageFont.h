@@ -45,7 +45,7 @@
 
 //-----------------------------------------------------------------------------
 
-class ImageFont : public SceneObject
+class ImageFont : public SceneObject, protected AssetPtrCallback
 {
     typedef SceneObject          Parent;
 
@@ -79,6 +79,12 @@ private:
     Vector2                 mFontSize;
     TextAlignment           mTextAlignment;
 
+    /// Glyph layout cache.
+    Vector<Vector2>         mGlyphVertices;         ///< Local-space glyph quads.
+    Vector<Vector2>         mGlyphTexCoords;        ///< Glyph quad texture coordinates.
+    Vector2                 mGlyphLayoutSize;       ///< Size the layout was built for.
+    bool                    mGlyphLayoutDirty;
+
 private:
     void calculateSpatials( void );
 
@@ -109,12 +115,20 @@ public:
     void setFontPadding( const F32 padding );
     inline F32 getFontPadding( void ) const                                 { return mFontPadding; }
 
+    /// Glyph layout.
+    void updateGlyphLayout( void );
+    inline void invalidateGlyphLayout( void )                               { mGlyphLayoutDirty = true; }
+    inline bool getGlyphLayoutDirty( void ) const                           { return mGlyphLayoutDirty || mGlyphLayoutSize.notEqual( mSize ); }
+
     static TextAlignment getTextAlignmentEnum(const char* label);
     static const char* getTextAlignmentDescription(const TextAlignment alignment);
 
     // Declare Console Object.
     DECLARE_CONOBJECT(ImageFont);
 
+protected:
+    virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase )            { invalidateGlyphLayout(); }
+
 protected:
     static bool setImage(void* obj, const char* data)                       { static_cast<ImageFont*>(obj)->setImage( data ); return false; }
     static const char* getImage(void* obj, const char* data)                { return static_cast<ImageFont*>(obj)->getImage(); }
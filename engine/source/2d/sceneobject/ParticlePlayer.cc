@@ -688,6 +688,7 @@ void ParticlePlayer::sceneRenderOverlay( const SceneRenderState* sceneRenderStat
         return;
 
     // Draw camera pause distance.
+    pScene->mDebugDraw.setCategory( DebugDraw::DEBUG_CATEGORY_OTHER );
     pScene->mDebugDraw.DrawCircle( getRenderPosition(), mCameraIdleDistance, ColorF(1.0f, 1.0f, 0.0f ) );
 }
 
@@ -1284,6 +1285,9 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         // No, so fetch the animation asset.
         const AssetPtr<AnimationAsset>& animationAsset = pParticleAssetEmitter->getAnimationAsset();
 
+        // Share the animation clock if requested.
+        frameProvider.setSharedAnimationClock( pParticleAssetEmitter->getSharedAnimationClock() );
+
         // Play it.
         frameProvider.playAnimation( animationAsset );
     }
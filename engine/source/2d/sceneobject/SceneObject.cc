@@ -769,30 +769,35 @@ void SceneObject::sceneRenderOverlay( const SceneRenderState* sceneRenderState )
     // AABB debug draw.
     if ( debugMask & Scene::SCENE_DEBUG_AABB )
     {
+        pScene->mDebugDraw.setCategory( DebugDraw::DEBUG_CATEGORY_AABB );
         pScene->mDebugDraw.DrawAABB( mCurrentAABB, ColorF(0.7f, 0.7f, 0.9f) );
     }
 
     // OOBB debug draw.
     if ( debugMask & Scene::SCENE_DEBUG_OOBB )
     {
+        pScene->mDebugDraw.setCategory( DebugDraw::DEBUG_CATEGORY_OOBB );
         pScene->mDebugDraw.DrawOOBB( mRenderOOBB, ColorF(0.9f, 0.9f, 1.0f) );
     }
 
     // Asleep debug draw.
     if ( !getAwake() && debugMask & Scene::SCENE_DEBUG_SLEEP )
     {
+        pScene->mDebugDraw.setCategory( DebugDraw::DEBUG_CATEGORY_SLEEP );
         pScene->mDebugDraw.DrawAsleep( mRenderOOBB, ColorF( 0.0f, 1.0f, 0.0f ) );
     }
 
     // Collision Shapes.
     if ( debugMask & Scene::SCENE_DEBUG_COLLISION_SHAPES )
     {
+        pScene->mDebugDraw.setCategory( DebugDraw::DEBUG_CATEGORY_COLLISION_SHAPES );
         pScene->mDebugDraw.DrawCollisionShapes( getRenderTransform(), getBody() );
     }
 
     // Position and local center of mass.
     if ( debugMask & Scene::SCENE_DEBUG_POSITION_AND_COM )
     {
+        pScene->mDebugDraw.setCategory( DebugDraw::DEBUG_CATEGORY_POSITION_AND_COM );
         const b2Vec2 renderPosition = getRenderPosition();
 
         pScene->mDebugDraw.DrawPoint( renderPosition + getLocalCenter(), 6, ColorF( 0.0f, 1.0f, 0.4f ) );
@@ -802,6 +807,7 @@ void SceneObject::sceneRenderOverlay( const SceneRenderState* sceneRenderState )
     // Sort Points.
     if ( debugMask & Scene::SCENE_DEBUG_SORT_POINTS )
     {
+        pScene->mDebugDraw.setCategory( DebugDraw::DEBUG_CATEGORY_SORT_POINTS );
         pScene->mDebugDraw.DrawSortPoint( getRenderPosition(), getSize(), mSortPoint );
     }
 }
@@ -67,6 +67,10 @@
 #include "component/behaviors/behaviorInstance.h"
 #endif
 
+#ifndef _POOL_ALLOCATOR_H_
+#include "memory/poolAllocator.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 struct tDestroyNotification
@@ -576,6 +580,9 @@ public:
     /// Declare Console Object.
     DECLARE_CONOBJECT( SceneObject );
 
+    /// Scene objects are created and destroyed in bulk on level loads.
+    DECLARE_POOLED_ALLOCATION( SceneObject );
+
 protected:
     S32                     copyCircleCollisionShapeTo( SceneObject* pSceneObject, const b2FixtureDef& fixtureDef ) const;
     S32                     copyPolygonCollisionShapeTo( SceneObject* pSceneObject, const b2FixtureDef& fixtureDef ) const;
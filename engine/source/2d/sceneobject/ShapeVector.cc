@@ -25,6 +25,9 @@
 #include "2d/core/Utility.h"
 #include "ShapeVector.h"
 
+// Debug Profiling.
+#include "debug/profiler.h"
+
 // Script bindings.
 #include "ShapeVector_ScriptBinding.h"
 
@@ -42,11 +45,18 @@ ShapeVector::ShapeVector() :
     mIsCircle(false),
     mCircleRadius(1.0f),
     mFlipX(false),
-    mFlipY(false)
+    mFlipY(false),
+    mRenderGeometryDirty(true),
+    mCachedIsCircle(false),
+    mCachedFillMode(false),
+    mCachedCircleRadius(0.0f)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mPolygonBasisList );
     VECTOR_SET_ASSOCIATION( mPolygonLocalList );
+    VECTOR_SET_ASSOCIATION( mFillVertices );
+    VECTOR_SET_ASSOCIATION( mOutlineVertices );
+    VECTOR_SET_ASSOCIATION( mOutlineNormals );
 
    // Use a static body by default.
    mBodyDefinition.type = b2_staticBody;
@@ -116,191 +126,154 @@ void ShapeVector::onRemove()
 
 //----------------------------------------------------------------------------
 
+// Scratch buffers used to transform cached geometry for submission.
+static Vector<Vector2> sRenderVertices;
+static Vector<Vector2> sOutlineVertices;
+static Vector<Vector2> sRenderTextureCoords;
+
+//----------------------------------------------------------------------------
+
 void ShapeVector::sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
 {
-    // Fetch Vertex Count.
-    const U32 vertexCount = mPolygonLocalList.size();
+    // Debug Profiling.
+    PROFILE_SCOPE(ShapeVector_SceneRender);
 
     // Finish if not vertices.
-    if ( vertexCount == 0  && !mIsCircle)
+    if ( mPolygonLocalList.size() == 0 && !mIsCircle )
         return;
 
-    // Disable Texturing.
-    glDisable       ( GL_TEXTURE_2D );
+    // Rebuild the cached geometry if it has changed.
+    if ( getRenderGeometryDirty() )
+        updateRenderGeometry();
 
-    // Save Model-view.
-    glMatrixMode(GL_MODELVIEW);
-    glPushMatrix();
+    // Fetch the render transform.
+    const b2Transform renderTransform = getRenderTransform();
 
-    // Fetch Position/Rotation.
-    const Vector2 position = getRenderPosition();
+    // Submit the fill.
+    if ( mFillVertices.size() > 0 )
+        submitTriangles( pBatchRenderer, mFillVertices.address(), mFillVertices.size(), renderTransform, mFillColor );
 
-    // Set Blend Options.
-    setBlendOptions();
-    
-    if (mIsCircle)
-    {
-        glRotatef( mRadToDeg(getRenderAngle()), 0.0f, 0.0f, 1.0f );
-        renderCircleShape(position, mCircleRadius);
-    }
-    else
+    // Finish if no outline.
+    const U32 outlineCount = mOutlineVertices.size();
+    if ( outlineCount == 0 )
+        return;
+
+    // The outline is a band one pixel wide so it can batch with the fill.
+    const Vector2& renderScale = pSceneRenderState->mRenderScale;
+    const F32 halfWidth = 0.5f * getMax( renderScale.x, renderScale.y );
+
+    sOutlineVertices.setSize( outlineCount * 6 );
+    Vector2* pOutlineVertex = sOutlineVertices.address();
+    for ( U32 n = 0; n < outlineCount; ++n )
     {
-        // Move into Vector-Space.
-        glTranslatef( position.x, position.y, 0.0f );
-        glRotatef( mRadToDeg(getRenderAngle()), 0.0f, 0.0f, 1.0f );
-        renderPolygonShape(vertexCount);
+        const Vector2& start = mOutlineVertices[n];
+        const Vector2& end = mOutlineVertices[n + 1 == outlineCount ? 0 : n + 1];
+        const Vector2 offset = mOutlineNormals[n] * halfWidth;
+
+        *(pOutlineVertex++) = start - offset;
+        *(pOutlineVertex++) = end - offset;
+        *(pOutlineVertex++) = end + offset;
+        *(pOutlineVertex++) = start - offset;
+        *(pOutlineVertex++) = end + offset;
+        *(pOutlineVertex++) = start + offset;
     }
 
-    // Restore color.
-    glColor4f( 1,1,1,1 );
+    // The filled circle outline has always been drawn opaque.
+    ColorF lineColor = mLineColor;
+    if ( mIsCircle && mFillMode )
+        lineColor.alpha = 1.0f;
 
-    // Restore Matrix.
-    glPopMatrix();
+    submitTriangles( pBatchRenderer, sOutlineVertices.address(), sOutlineVertices.size(), renderTransform, lineColor );
 }
 
-void ShapeVector::renderCircleShape(Vector2 position, F32 radius)
+//----------------------------------------------------------------------------
+
+void ShapeVector::submitTriangles( BatchRender* pBatchRenderer, const Vector2* pLocalVertices, const U32 vertexCount, const b2Transform& renderTransform, const ColorF& color )
 {
-    if (mFillMode)
+    // Untextured so the texture coordinates are never sampled.
+    if ( (U32)sRenderTextureCoords.size() < vertexCount )
     {
-        const float32 k_segments = 32.0f;
-        const float32 k_increment = 2.0f * b2_pi / k_segments;
-        float32 theta = 0.0f;
-
-        glEnable(GL_BLEND);
-        glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        glColor4f(mFillColor.red, mFillColor.green, mFillColor.blue, mFillColor.alpha);
-
-        glBegin(GL_TRIANGLE_FAN);
-        for (int32 i = 0; i < k_segments; ++i)
-        {
-            Vector2 v = position + radius * Vector2(cosf(theta), sinf(theta));
-            glVertex2f(v.x, v.y);
-            theta += k_increment;
-        }
-        glEnd();
-
-        glDisable(GL_BLEND);
+        const U32 oldSize = sRenderTextureCoords.size();
+        sRenderTextureCoords.setSize( vertexCount );
+        for ( U32 n = oldSize; n < vertexCount; ++n )
+            sRenderTextureCoords[n].SetZero();
+    }
 
-        theta = 0.0f;
-        glColor4f(mLineColor.red, mLineColor.green, mLineColor.blue, 1.0f);
-        glBegin(GL_LINE_LOOP);
-        for (int32 i = 0; i < k_segments; ++i)
-        {
-            Vector2 v = position + radius * Vector2(cosf(theta), sinf(theta));
-            glVertex2f(v.x, v.y);
-            theta += k_increment;
-        }
-        glEnd();
+    // Transform into world-space.
+    sRenderVertices.setSize( vertexCount );
+    for ( U32 n = 0; n < vertexCount; ++n )
+    {
+        sRenderVertices[n] = b2Mul( renderTransform, pLocalVertices[n] );
     }
-    else
+
+    // Submit in runs that fit the batch buffer.
+    const U32 maxRunVertices = BATCHRENDER_MAXTRIANGLES * 3;
+    for ( U32 start = 0; start < vertexCount; start += maxRunVertices )
     {
-        const float32 k_segments = 36.0f;
-        const float32 k_increment = 2.0f * b2_pi / k_segments;
-        float32 theta = 0.0f;
-
-        glColor4f(mLineColor.red, mLineColor.green, mLineColor.blue, mLineColor.alpha);
-        
-        glBegin(GL_LINE_LOOP);
-        for (int32 i = 0; i < k_segments; ++i)
-        {
-            Vector2 v = position + radius * Vector2(cosf(theta), sinf(theta));
-            glVertex2f(v.x, v.y);
-            theta += k_increment;
-        }
-        glEnd();
+        const U32 runVertices = getMin( vertexCount - start, maxRunVertices );
+        pBatchRenderer->SubmitTriangles( runVertices, sRenderVertices.address() + start, sRenderTextureCoords.address(), BadTextureHandle, color );
     }
 }
 
-void ShapeVector::renderPolygonShape(U32 vertexCount)
+//----------------------------------------------------------------------------
+
+void ShapeVector::updateRenderGeometry( void )
 {
-#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
-    // Fill Mode?
-    if ( mFillMode )
+    // Debug Profiling.
+    PROFILE_SCOPE(ShapeVector_UpdateRenderGeometry);
+
+    mFillVertices.clear();
+    mOutlineVertices.clear();
+    mOutlineNormals.clear();
+
+    if ( mIsCircle )
     {
-        // Yes, so set polygon mode to FILL.
-        //glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
-
-        // Set Fill color.
-        glColor4f( (GLfloat)mFillColor.red, (GLfloat)mFillColor.green, (GLfloat)mFillColor.blue, (GLfloat)mFillColor.alpha );
-
-        GLfloat vert1[] = {//get first vert and make triangles based off of this one
-            (GLfloat)(mPolygonLocalList[0].x),
-            (GLfloat)(mPolygonLocalList[0].y),
-        };
-        GLfloat prevVert[] = {
-            (GLfloat)(mPolygonLocalList[1].x),
-            (GLfloat)(mPolygonLocalList[1].y),
-        };
-        
-        
-        // Draw Object.
-            for ( U32 n = 2; n < vertexCount; n++ )
-            {
-                //glVertex2fv ( (GLfloat*)&(mPolygonLocalList[n]) );
-                GLfloat vertex[] = {
-                                    vert1[0], vert1[1],
-                                    (GLfloat)(mPolygonLocalList[n].x), (GLfloat)(mPolygonLocalList[n].y),
-                                    prevVert[0], prevVert[1],
-                };
-                
-                glVertexPointer(2, GL_FLOAT, 0, vertex );
-                glDrawArrays(GL_TRIANGLES, 0, 3 );
-                prevVert[0] = (GLfloat)(mPolygonLocalList[n].x);//save the current one's for nxt time
-                prevVert[1] = (GLfloat)(mPolygonLocalList[n].y);
-            }
-        //glDrawArrays(GL_TRIANGLES, 0, vertexCount);
-        //glEnd();
- 
-    }
+        // Filled circles use fewer segments, as before.
+        const U32 segments = mFillMode ? 32 : 36;
+        const F32 increment = M_2PI_F / segments;
 
-    // Set Line color.
-    glColor4f(mLineColor.red, mLineColor.green, mLineColor.blue, mLineColor.alpha );
-    
-        for ( U32 n = 1; n <= vertexCount; n++ )
+        mOutlineVertices.setSize( segments );
+        for ( U32 n = 0; n < segments; ++n )
         {
-            GLfloat verts[] = {
-                (GLfloat)(mPolygonLocalList[n - 1].x),
-                (GLfloat)(mPolygonLocalList[n - 1].y),
-                (GLfloat)(mPolygonLocalList[n == vertexCount ? 0 : n].x),
-                (GLfloat)(mPolygonLocalList[n == vertexCount ? 0 : n].y),
-            };
-
-            glVertexPointer(2, GL_FLOAT, 0, verts );			
-            glDrawArrays(GL_LINE_LOOP, 0, 2);//draw last two
+            const F32 theta = increment * n;
+            mOutlineVertices[n].Set( mCircleRadius * mCos(theta), mCircleRadius * mSin(theta) );
         }
-
-#else
-    // Fill Mode?
-    if ( mFillMode )
+    }
+    else
     {
-        // Yes, so set polygon mode to FILL.
-        glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
-
-        // Set Fill color.
-        glColor4fv( (GLfloat*)&mFillColor );
-
-        // Draw Object.
-        glBegin( GL_POLYGON );
-            for ( U32 n = 0; n < vertexCount; n++ )
-            {
-                glVertex2fv ( (GLfloat*)&(mPolygonLocalList[n]) );
-            }
-        glEnd();
+        mOutlineVertices = mPolygonLocalList;
     }
 
-    // Set Line color.
-    glColor4fv( (GLfloat*)&mLineColor );
+    const U32 vertexCount = mOutlineVertices.size();
 
-    // Draw Object.
-    glBegin(GL_LINES);
-        for ( U32 n = 1; n <= vertexCount; n++ )
+    // Triangulate the fill as a fan.
+    // NOTE:    As with the previous GL_POLYGON fill, the shape is assumed to be convex.
+    if ( mFillMode && vertexCount >= 3 )
+    {
+        mFillVertices.reserve( (vertexCount - 2) * 3 );
+        for ( U32 n = 1; n < vertexCount - 1; ++n )
         {
-            glVertex2fv ( (GLfloat*)&(mPolygonLocalList[n - 1]) );
-            glVertex2fv ( (GLfloat*)&(mPolygonLocalList[n == vertexCount ? 0 : n]) );
+            mFillVertices.push_back( mOutlineVertices[0] );
+            mFillVertices.push_back( mOutlineVertices[n] );
+            mFillVertices.push_back( mOutlineVertices[n + 1] );
         }
-    glEnd();
+    }
 
-#endif
+    // Calculate the outline edge normals.
+    mOutlineNormals.setSize( vertexCount );
+    for ( U32 n = 0; n < vertexCount; ++n )
+    {
+        Vector2 edge = mOutlineVertices[n + 1 == vertexCount ? 0 : n + 1] - mOutlineVertices[n];
+        if ( edge.Normalize() > 0.0f )
+            mOutlineNormals[n].Set( -edge.y, edge.x );
+        else
+            mOutlineNormals[n].SetZero();
+    }
+
+    mCachedIsCircle = mIsCircle;
+    mCachedFillMode = mFillMode;
+    mCachedCircleRadius = mCircleRadius;
+    mRenderGeometryDirty = false;
 }
 
 //----------------------------------------------------------------------------
@@ -582,6 +555,9 @@ void ShapeVector::generateLocalPoly( void )
             mPolygonLocalList[n] = polyVertex;
         }
     }
+
+    // Rebuild the render geometry.
+    invalidateRenderGeometry();
 }
 
 //----------------------------------------------------------------------------
@@ -45,6 +45,15 @@ protected:
     bool                    mFlipX;
     bool                    mFlipY;
 
+    /// Render geometry cache.
+    Vector<Vector2>         mFillVertices;          ///< Local-space fill triangles.
+    Vector<Vector2>         mOutlineVertices;       ///< Local-space outline loop.
+    Vector<Vector2>         mOutlineNormals;        ///< Outline edge normals.
+    bool                    mRenderGeometryDirty;
+    bool                    mCachedIsCircle;
+    bool                    mCachedFillMode;
+    F32                     mCachedCircleRadius;
+
 public:
     ShapeVector();
     ~ShapeVector();
@@ -78,8 +87,11 @@ public:
     /// Internal Crunchers.
     void generateLocalPoly( void );
 
-    void renderCircleShape(Vector2 position, F32 radius);
-    void renderPolygonShape(U32 vertexCount);
+    /// Render geometry.
+    void updateRenderGeometry( void );
+    inline void invalidateRenderGeometry( void )                { mRenderGeometryDirty = true; }
+    inline bool getRenderGeometryDirty( void ) const            { return mRenderGeometryDirty || mCachedIsCircle != mIsCircle || mCachedFillMode != mFillMode || mCachedCircleRadius != mCircleRadius; }
+    inline U32 getRenderTriangleCount( void ) const             { return (U32)(mFillVertices.size() / 3) + ((U32)mOutlineVertices.size() * 2); }
 
     /// Render flipping.
     inline void setFlip( const bool flipX, const bool flipY )   { mFlipX = flipX; mFlipY = flipY; generateLocalPoly(); }
@@ -97,7 +109,7 @@ public:
     virtual bool shouldRender( void ) const { return true; }
 
     /// Render batching.
-    virtual bool isBatchRendered( void ) { return false; }
+    virtual bool isBatchRendered( void ) { return true; }
 
     /// Clone support
     void copyTo(SimObject* obj);
@@ -106,6 +118,8 @@ public:
     DECLARE_CONOBJECT(ShapeVector);
 
 protected:
+    void submitTriangles( BatchRender* pBatchRenderer, const Vector2* pLocalVertices, const U32 vertexCount, const b2Transform& renderTransform, const ColorF& color );
+
     static bool setPolyList(void* obj, const char* data)
     {
        const U32 count = Utility::mGetStringElementCount(data) >> 1;
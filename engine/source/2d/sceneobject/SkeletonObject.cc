@@ -46,16 +46,18 @@ IMPLEMENT_CONOBJECT(SkeletonObject);
 
 //------------------------------------------------------------------------------
 
-SkeletonObject::SkeletonObject() :  mPreTickTime( 0.0f ),
+SkeletonObject::SkeletonObject() :  mSkeletonSpriteImage(StringTable->EmptyString),
+                                    mPoseCacheQuantum(0.0f),
+                                    mSkeleton(NULL),
+                                    mState(NULL),
+                                    mPreTickTime( 0.0f ),
                                     mPostTickTime( 0.0f ),
                                     mTimeScale(1),
                                     mLastFrameTime(0),
+                                    mAnimationDuration(0.0),
                                     mTotalAnimationTime(0),
-                                    mSkeleton(NULL),
-                                    mState(NULL),
-                                    mAnimationCycle(false),
                                     mAnimationFinished(true),
-                                    mAnimationDuration(0.0),
+                                    mAnimationCycle(false),
                                     mFlipX(false),
                                     mFlipY(false)
 {
@@ -91,6 +93,7 @@ void SkeletonObject::initPersistFields()
     addProtectedField("RootBoneScale", TypeVector2, NULL, &setRootBoneScale, &getRootBoneScale, &writeRootBoneScale, "Scaling of the skeleton's root bone");
     addProtectedField("RootBoneOffset", TypeVector2, NULL, &setRootBoneOffset, &getRootBoneOffset, &writeRootBoneOffset, "X/Y offset of the skeleton's root bone");
     addProtectedField("AnimationCycle", TypeBool, Offset(mAnimationCycle, SkeletonObject), &setAnimationCycle, &defaultProtectedGetFn, &writeAnimationCycle, "Whether the animation loops or not");
+    addProtectedField("PoseCacheQuantum", TypeF32, Offset(mPoseCacheQuantum, SkeletonObject), &setPoseCacheQuantum, &defaultProtectedGetFn, &writePoseCacheQuantum, "The time quantum (in seconds) used to share evaluated poses between instances playing the same animation.  Zero disables pose caching.");
     addField("FlipX", TypeBool, Offset(mFlipX, SkeletonObject), &writeFlipX, "");
     addField("FlipY", TypeBool, Offset(mFlipY, SkeletonObject), &writeFlipY, "");
 }
@@ -176,6 +179,7 @@ void SkeletonObject::copyTo(SimObject* object)
     pComposite->setCurrentSkin( getCurrentSkin() );
     pComposite->setRootBoneScale( getRootBoneScale() );
     pComposite->setRootBoneOffset( getRootBoneOffset() );
+    pComposite->setPoseCacheQuantum( getPoseCacheQuantum() );
 }
 
 //-----------------------------------------------------------------------------
@@ -337,6 +341,7 @@ void SkeletonObject::generateComposition( void )
     // Clear existing visualization
     clearSprites();
     mSkeletonSprites.clear();
+    mSkeletonSpriteAttachments.clear();
     
     // Finish if skeleton asset isn't available.
     if ( mSkeletonAsset.isNull() )
@@ -382,87 +387,212 @@ void SkeletonObject::generateComposition( void )
 
 void SkeletonObject::updateComposition( const F32 time )
 {
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonObject_UpdateComposition);
+
     // Update position/orientation/state of visualization
     float delta = (time - mLastFrameTime) * mTimeScale;
     mLastFrameTime = time;
     
     spSkeleton_update(mSkeleton, delta);
+
+    // Set the flip before the world transform is calculated.
+    mSkeleton->flipX = getFlipX();
+    mSkeleton->flipY = getFlipY();
+
+    const SkeletonPose* pPose = NULL;
     
     if (!mAnimationFinished)
     {
         spAnimationState_update(mState, delta);
-        spAnimationState_apply(mState, mSkeleton);
+
+        // Fetch the only track if it's not mixing.
+        spTrackEntry* pTrack = mState->trackCount == 1 ? mState->tracks[0] : NULL;
+
+        // Can the pose be shared?
+        if ( mPoseCacheQuantum > 0.0f && pTrack != NULL && pTrack->previous == NULL )
+        {
+            // Yes, so fetch the cached pose.
+            pPose = fetchCachedPose( pTrack );
+        }
+        else
+        {
+            spAnimationState_apply(mState, mSkeleton);
+        }
     }
+
+    // Compute the pose if not cached.
+    if ( pPose == NULL )
+    {
+        spSkeleton_updateWorldTransform(mSkeleton);
+        computePose( mSkeletonPose );
+        pPose = &mSkeletonPose;
+    }
+
+    // Apply the pose to the sprites.
+    applyPose( *pPose );
     
-    spSkeleton_updateWorldTransform(mSkeleton);
-    
-    // Get the ImageAsset used by the sprites
-    StringTableEntry assetId = (*mSkeletonAsset).mImageAsset.getAssetId();
-    
-    clearSprites();
-    
-    Vector2 vertices[4];
+    if (mLastFrameTime >= mTotalAnimationTime)
+        mAnimationFinished = true;
     
-    F32 vertexPositions[8];
-    for (int i = 0; i < mSkeleton->slotCount; ++i)
+    if (mAnimationFinished && !mAnimationCycle)
+    {
+        onAnimationFinished();
+    }
+    else
+    {
+        mAnimationFinished = false;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+const SkeletonPose* SkeletonObject::fetchCachedPose( spTrackEntry* pTrack )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonObject_FetchCachedPose);
+
+    // Fetch the animation time.
+    F32 animationTime = pTrack->time;
+    if ( !pTrack->loop && animationTime > pTrack->endTime )
+        animationTime = pTrack->endTime;
+    else if ( pTrack->loop && pTrack->animation->duration > 0.0f )
+        animationTime = mFmod( animationTime, pTrack->animation->duration );
+
+    // Generate the pose key.
+    SkeletonPoseKey poseKey;
+    poseKey.mpAnimation = pTrack->animation;
+    poseKey.mpSkin = mSkeleton->skin;
+    poseKey.mFrame = (S32)mFloor( (animationTime / mPoseCacheQuantum) + 0.5f );
+    poseKey.mFlipX = getFlipX();
+    poseKey.mFlipY = getFlipY();
+    poseKey.mRootScale = mSkeletonScale;
+    poseKey.mRootOffset = mSkeletonOffset;
+
+    // Note the track as applied.
+    pTrack->lastTime = pTrack->time;
+
+    // Finish if the pose is already cached.
+    const SkeletonPose* pCachedPose = mSkeletonAsset->findPose( poseKey );
+    if ( pCachedPose != NULL )
+        return pCachedPose;
+
+    // Evaluate the pose at the quantized time.
+    const F32 poseTime = poseKey.mFrame * mPoseCacheQuantum;
+    spAnimation_apply( pTrack->animation, mSkeleton, poseTime, poseTime, 0, NULL, NULL );
+    spSkeleton_updateWorldTransform( mSkeleton );
+
+    // Cache the pose.
+    SkeletonPose* pPose = mSkeletonAsset->createPose( poseKey );
+    computePose( *pPose );
+
+    return pPose;
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::computePose( SkeletonPose& pose ) const
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonObject_ComputePose);
+
+    // Reset the pose.
+    pose.clear();
+
+    const F32 skeletonX = mSkeleton->x;
+    const F32 skeletonY = mSkeleton->y;
+
+    // Compute the world vertices of all region attachments.
+    for ( S32 i = 0; i < mSkeleton->slotCount; ++i )
     {
-        spSlot* slot = mSkeleton->slots[i];
-        spAttachment* attachment = slot->attachment;
+        const spSlot* slot = mSkeleton->slots[i];
+        const spAttachment* attachment = slot->attachment;
         
         if (!attachment || attachment->type != ATTACHMENT_REGION)
             continue;
-        
-        spRegionAttachment* regionAttachment = (spRegionAttachment*)attachment;
-        spRegionAttachment_computeWorldVertices(regionAttachment, slot->skeleton->x, slot->skeleton->y, slot->bone, vertexPositions);
-        
-        SpriteBatchItem* pSprite = SpriteBatch::createSprite();
+
+        const float* offset = ((const spRegionAttachment*)attachment)->offset;
+        const spBone* bone = slot->bone;
+        const F32 x = skeletonX + bone->worldX;
+        const F32 y = skeletonY + bone->worldY;
+
+        // NOTE: The sprite explicit vertices are ordered #1, #4, #3, #2.
+        pose.mVertices.push_back( Vector2( offset[VERTEX_X1] * bone->m00 + offset[VERTEX_Y1] * bone->m01 + x, offset[VERTEX_X1] * bone->m10 + offset[VERTEX_Y1] * bone->m11 + y ) );
+        pose.mVertices.push_back( Vector2( offset[VERTEX_X4] * bone->m00 + offset[VERTEX_Y4] * bone->m01 + x, offset[VERTEX_X4] * bone->m10 + offset[VERTEX_Y4] * bone->m11 + y ) );
+        pose.mVertices.push_back( Vector2( offset[VERTEX_X3] * bone->m00 + offset[VERTEX_Y3] * bone->m01 + x, offset[VERTEX_X3] * bone->m10 + offset[VERTEX_Y3] * bone->m11 + y ) );
+        pose.mVertices.push_back( Vector2( offset[VERTEX_X2] * bone->m00 + offset[VERTEX_Y2] * bone->m01 + x, offset[VERTEX_X2] * bone->m10 + offset[VERTEX_Y2] * bone->m11 + y ) );
+
+        pose.mAttachments.push_back( attachment->name );
+        pose.mColors.push_back( ColorF( slot->r, slot->g, slot->b, slot->a ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::applyPose( const SkeletonPose& pose )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SkeletonObject_ApplyPose);
+
+    // Get the ImageAsset used by the sprites
+    StringTableEntry assetId = (*mSkeletonAsset).mImageAsset.getAssetId();
+
+    // Recreate the sprites if the image changed.
+    if ( assetId != mSkeletonSpriteImage )
+    {
+        clearSprites();
+        mSkeletonSprites.clear();
+        mSkeletonSpriteAttachments.clear();
+        mSkeletonSpriteImage = assetId;
+    }
+
+    const U32 regionCount = pose.getRegionCount();
+
+    for ( U32 i = 0; i < regionCount; ++i )
+    {
+        SpriteBatchItem* pSprite;
+
+        // Reuse an existing sprite if available.
+        if ( i < (U32)mSkeletonSprites.size() )
+        {
+            pSprite = mSkeletonSprites[i];
+            pSprite->setVisible( true );
+        }
+        else
+        {
+            pSprite = SpriteBatch::createSprite();
+            pSprite->setImage( assetId );
+            mSkeletonSprites.push_back( pSprite );
+            mSkeletonSpriteAttachments.push_back( NULL );
+        }
 
         pSprite->setDepth(mSceneLayerDepth);
         
         pSprite->setSrcBlendFactor(mSrcBlendFactor);
         pSprite->setDstBlendFactor(mDstBlendFactor);
-        
-        mSkeleton->r = mBlendColor.red;
-        mSkeleton->g = mBlendColor.green;
-        mSkeleton->b = mBlendColor.blue;
-        mSkeleton->a = mBlendColor.alpha;
-        
-        F32 alpha = mSkeleton->a * slot->a;
+
+        const ColorF& slotColor = pose.mColors[i];
+        F32 alpha = mBlendColor.alpha * slotColor.alpha;
         pSprite->setBlendColor(ColorF(
-            mSkeleton->r * slot->r * alpha,
-            mSkeleton->g * slot->g * alpha,
-            mSkeleton->b * slot->b * alpha,
+            mBlendColor.red * slotColor.red * alpha,
+            mBlendColor.green * slotColor.green * alpha,
+            mBlendColor.blue * slotColor.blue * alpha,
             alpha
         ));
-        
-        mSkeleton->flipX = getFlipX();
-        mSkeleton->flipY = getFlipY();
-        
-        vertices[0].x = vertexPositions[VERTEX_X1];
-        vertices[0].y = vertexPositions[VERTEX_Y1];
-        vertices[1].x = vertexPositions[VERTEX_X4];
-        vertices[1].y = vertexPositions[VERTEX_Y4];
-        vertices[2].x = vertexPositions[VERTEX_X3];
-        vertices[2].y = vertexPositions[VERTEX_Y3];
-        vertices[3].x = vertexPositions[VERTEX_X2];
-        vertices[3].y = vertexPositions[VERTEX_Y2];
-        pSprite->setExplicitVertices(vertices);
-        
-        pSprite->setImage(assetId);
-        pSprite->setNamedImageFrame(attachment->name);
-    }
-    
-    if (mLastFrameTime >= mTotalAnimationTime)
-        mAnimationFinished = true;
-    
-    if (mAnimationFinished && !mAnimationCycle)
-    {
-        onAnimationFinished();
-    }
-    else
-    {
-        mAnimationFinished = false;
+
+        pSprite->setExplicitVertices( pose.mVertices.address() + (i*4) );
+
+        // Only change the frame if the attachment changed.
+        if ( mSkeletonSpriteAttachments[i] != pose.mAttachments[i] )
+        {
+            pSprite->setNamedImageFrame( pose.mAttachments[i] );
+            mSkeletonSpriteAttachments[i] = pose.mAttachments[i];
+        }
     }
+
+    // Hide any unused sprites.
+    for ( U32 i = regionCount; i < (U32)mSkeletonSprites.size(); ++i )
+        mSkeletonSprites[i]->setVisible( false );
 }
 
 void SkeletonObject::onAnimationFinished()
@@ -45,6 +45,10 @@ protected:
 private:
     typedef Vector<SpriteBatchItem*> typeSkeletonSpritesVector;
     typeSkeletonSpritesVector   mSkeletonSprites;
+    Vector<const char*>         mSkeletonSpriteAttachments;
+    StringTableEntry            mSkeletonSpriteImage;
+    SkeletonPose                mSkeletonPose;
+    F32                         mPoseCacheQuantum;
     
     AssetPtr<SkeletonAsset>     mSkeletonAsset;
     spSkeleton*                 mSkeleton;
@@ -120,6 +124,10 @@ public:
     
     inline void setAnimationCycle( const bool isLooping ) { mAnimationCycle = isLooping; }
     inline bool getAnimationCycle( void ) const {return mAnimationCycle; };
+
+    /// Pose caching.
+    inline void setPoseCacheQuantum( const F32 quantum ) { mPoseCacheQuantum = getMax( quantum, 0.0f ); }
+    inline F32 getPoseCacheQuantum( void ) const { return mPoseCacheQuantum; }
     
     void onAnimationFinished();
     
@@ -129,6 +137,9 @@ public:
 protected:
     void generateComposition( void );
     void updateComposition( const F32 time );
+    const SkeletonPose* fetchCachedPose( spTrackEntry* pTrack );
+    void computePose( SkeletonPose& pose ) const;
+    void applyPose( const SkeletonPose& pose );
     
 protected:
     static bool setSkeletonAsset( void* obj, const char* data )                  { static_cast<SkeletonObject*>(obj)->setSkeletonAsset(data); return false; }
@@ -153,6 +164,9 @@ protected:
     
     static bool setAnimationCycle( void* obj, const char* data )                 { static_cast<SkeletonObject*>(obj)->setAnimationCycle( dAtob(data) ); return false; }
     static bool writeAnimationCycle( void* obj, StringTableEntry pFieldName )    { return static_cast<SkeletonObject*>(obj)->getAnimationCycle() == false; }
+
+    static bool setPoseCacheQuantum( void* obj, const char* data )               { static_cast<SkeletonObject*>(obj)->setPoseCacheQuantum( dAtof(data) ); return false; }
+    static bool writePoseCacheQuantum( void* obj, StringTableEntry pFieldName )  { return mNotZero( static_cast<SkeletonObject*>(obj)->getPoseCacheQuantum() ); }
     
     static bool writeFlipX( void* obj, StringTableEntry pFieldName )             { return static_cast<SkeletonObject*>(obj)->getFlipX() == true; }
     static bool writeFlipY( void* obj, StringTableEntry pFieldName )             { return static_cast<SkeletonObject*>(obj)->getFlipY() == true; }
@@ -308,4 +308,26 @@ ConsoleMethodWithDocs(SkeletonObject, setMix, ConsoleBool, 5, 5, (fromAnimation,
     return object->setMix(argv[2], argv[3], dAtof(argv[4]));
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Sets the time quantum used to share evaluated poses between instances.
+    Instances playing the same animation of the same skeleton asset in lockstep share a single evaluated pose per quantum.
+    @param quantum The time quantum in seconds. Zero disables pose caching.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(SkeletonObject, setPoseCacheQuantum, ConsoleVoid, 3, 3, (quantum))
+{
+    object->setPoseCacheQuantum( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the time quantum used to share evaluated poses between instances.
+    @return The time quantum in seconds. Zero means pose caching is disabled.
+*/
+ConsoleMethodWithDocs(SkeletonObject, getPoseCacheQuantum, ConsoleFloat, 2, 2, ())
+{
+    return object->getPoseCacheQuantum();
+}
+
 ConsoleMethodGroupEndWithDocs(SkeletonObject)
@@ -19,6 +19,7 @@
 #include <Box2D/Collision/b2DynamicTree.h>
 #include <cstring>
 #include <cfloat>
+#include <algorithm>
 using namespace std;
 
 
@@ -770,6 +771,149 @@ void b2DynamicTree::RebuildBottomUp()
 	Validate();
 }
 
+struct b2MortonLeaf
+{
+	uint32 code;
+	int32 index;
+};
+
+inline bool b2MortonLessThan(const b2MortonLeaf& leaf1, const b2MortonLeaf& leaf2)
+{
+	return leaf1.code < leaf2.code;
+}
+
+// Spread the low 16 bits of x so that there is a zero bit between each of them.
+inline uint32 b2MortonSpread(uint32 x)
+{
+	x &= 0x0000ffff;
+	x = (x | (x << 8)) & 0x00ff00ff;
+	x = (x | (x << 4)) & 0x0f0f0f0f;
+	x = (x | (x << 2)) & 0x33333333;
+	x = (x | (x << 1)) & 0x55555555;
+	return x;
+}
+
+void b2DynamicTree::RebuildTopDown()
+{
+	b2MortonLeaf* leaves = (b2MortonLeaf*)b2Alloc(b2Max(m_nodeCount, 1) * sizeof(b2MortonLeaf));
+	int32 count = 0;
+
+	b2Vec2 lower(b2_maxFloat, b2_maxFloat);
+	b2Vec2 upper(-b2_maxFloat, -b2_maxFloat);
+
+	// Build array of leaves and the bounds of their centers. Free the rest.
+	for (int32 i = 0; i < m_nodeCapacity; ++i)
+	{
+		if (m_nodes[i].height < 0)
+		{
+			// free node in pool
+			continue;
+		}
+
+		if (m_nodes[i].IsLeaf())
+		{
+			m_nodes[i].parent = b2_nullNode;
+			leaves[count].index = i;
+			++count;
+
+			b2Vec2 center = m_nodes[i].aabb.GetCenter();
+			lower = b2Min(lower, center);
+			upper = b2Max(upper, center);
+		}
+		else
+		{
+			FreeNode(i);
+		}
+	}
+
+	if (count == 0)
+	{
+		m_root = b2_nullNode;
+		b2Free(leaves);
+		return;
+	}
+
+	// Quantize the leaf centers and sort them along a Morton curve.
+	b2Vec2 extent = upper - lower;
+	b2Vec2 scale;
+	scale.x = extent.x > b2_epsilon ? 65535.0f / extent.x : 0.0f;
+	scale.y = extent.y > b2_epsilon ? 65535.0f / extent.y : 0.0f;
+
+	for (int32 i = 0; i < count; ++i)
+	{
+		b2Vec2 center = m_nodes[leaves[i].index].aabb.GetCenter();
+		uint32 x = (uint32)((center.x - lower.x) * scale.x);
+		uint32 y = (uint32)((center.y - lower.y) * scale.y);
+		leaves[i].code = (b2MortonSpread(y) << 1) | b2MortonSpread(x);
+	}
+
+	std::sort(leaves, leaves + count, b2MortonLessThan);
+
+	int32* nodes = (int32*)b2Alloc(count * sizeof(int32));
+	for (int32 i = 0; i < count; ++i)
+	{
+		nodes[i] = leaves[i].index;
+	}
+	b2Free(leaves);
+
+	m_root = BuildTopDown(nodes, count);
+	m_nodes[m_root].parent = b2_nullNode;
+	b2Free(nodes);
+}
+
+// Build a subtree over a run of leaves by splitting it in half.
+// Leaves that are adjacent in Morton order are spatially close.
+int32 b2DynamicTree::BuildTopDown(const int32* leaves, int32 count)
+{
+	if (count == 1)
+	{
+		return leaves[0];
+	}
+
+	int32 half = count / 2;
+	int32 index1 = BuildTopDown(leaves, half);
+	int32 index2 = BuildTopDown(leaves + half, count - half);
+
+	// Allocating may grow the pool so fetch node pointers afterwards.
+	int32 parentIndex = AllocateNode();
+	b2TreeNode* parent = m_nodes + parentIndex;
+	b2TreeNode* child1 = m_nodes + index1;
+	b2TreeNode* child2 = m_nodes + index2;
+
+	parent->child1 = index1;
+	parent->child2 = index2;
+	parent->height = 1 + b2Max(child1->height, child2->height);
+	parent->aabb.Combine(child1->aabb, child2->aabb);
+	parent->parent = b2_nullNode;
+
+	child1->parent = parentIndex;
+	child2->parent = parentIndex;
+
+	return parentIndex;
+}
+
+void b2DynamicTree::CreateProxies(const b2AABB* aabbs, void* const* userData, int32 count, int32* proxyIds)
+{
+	if (count <= 0)
+	{
+		return;
+	}
+
+	// Create the leaves without inserting them.
+	b2Vec2 r(b2_aabbExtension, b2_aabbExtension);
+	for (int32 i = 0; i < count; ++i)
+	{
+		int32 proxyId = AllocateNode();
+		m_nodes[proxyId].aabb.lowerBound = aabbs[i].lowerBound - r;
+		m_nodes[proxyId].aabb.upperBound = aabbs[i].upperBound + r;
+		m_nodes[proxyId].userData = userData[i];
+		m_nodes[proxyId].height = 0;
+		proxyIds[i] = proxyId;
+	}
+
+	RebuildTopDown();
+}
+
 void b2DynamicTree::ShiftOrigin(const b2Vec2& newOrigin)
 {
 	// Build array of leaves. Free the rest.
@@ -118,6 +118,16 @@ public:
 	/// Build an optimal tree. Very expensive. For testing.
 	void RebuildBottomUp();
 
+	/// Build a balanced tree by sorting the leaves in Morton order and splitting
+	/// them top-down. Much cheaper than RebuildBottomUp so it can be used at runtime.
+	void RebuildTopDown();
+
+	/// Create a batch of proxies and rebuild the tree top-down once. This is much
+	/// faster than calling CreateProxy for each AABB when many proxies are added at
+	/// once and leaves the tree balanced. Existing proxies keep their ids.
+	/// @param proxyIds receives the id of each created proxy.
+	void CreateProxies(const b2AABB* aabbs, void* const* userData, int32 count, int32* proxyIds);
+
 	/// Shift the world origin. Useful for large worlds.
 	/// The shift formula is: position -= newOrigin
 	/// @param newOrigin the new origin with respect to the old origin
@@ -133,6 +143,8 @@ private:
 
 	int32 Balance(int32 index);
 
+	int32 BuildTopDown(const int32* leaves, int32 count);
+
 	int32 ComputeHeight() const;
 	int32 ComputeHeight(int32 nodeId) const;
 
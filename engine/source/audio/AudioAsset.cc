@@ -32,6 +32,21 @@
 #include "console/consoleTypes.h"
 #endif
 
+#ifndef _AUDIOSTREAMSOURCEFACTORY_H_
+#include "audio/audioStreamSourceFactory.h"
+#endif
+
+#ifndef _AUDIOMIXER_H_
+#include "audio/audioMixer.h"
+#endif
+
+#ifndef _GAMEINTERFACE_H_
+#include "game/gameInterface.h"
+#endif
+
+// Script bindings.
+#include "AudioAsset_ScriptBinding.h"
+
 //-----------------------------------------------------------------------------
 
 ConsoleType( audioAssetPtr, TypeAudioAssetPtr, sizeof(AssetPtr<AudioAsset>), ASSET_ID_FIELD_PREFIX )
@@ -79,6 +94,8 @@ ConsoleSetType( TypeAudioAssetPtr )
 
 IMPLEMENT_CONOBJECT(AudioAsset);
 
+Vector<AudioAsset*> AudioAsset::smAudioAssets;
+
 //--------------------------------------------------------------------------
 
 AudioAsset::AudioAsset()
@@ -98,6 +115,47 @@ AudioAsset::AudioAsset()
    mDescription.mConeOutsideVolume   = 1.0f;
    mDescription.mConeVector.set(0, 0, 1);
 
+   mPrimed                           = false;
+   mDuration                         = -1.0f;
+}
+
+//--------------------------------------------------------------------------
+
+AudioAsset::~AudioAsset()
+{
+   releasePreload();
+}
+
+//--------------------------------------------------------------------------
+
+bool AudioAsset::onAdd()
+{
+   // Call parent.
+   if ( !Parent::onAdd() )
+      return false;
+
+   smAudioAssets.push_back( this );
+
+   return true;
+}
+
+//--------------------------------------------------------------------------
+
+void AudioAsset::onRemove()
+{
+   for ( S32 i = 0; i < smAudioAssets.size(); ++i )
+   {
+      if ( smAudioAssets[i] == this )
+      {
+         smAudioAssets.erase_fast( i );
+         break;
+      }
+   }
+
+   releasePreload();
+
+   // Call parent.
+   Parent::onRemove();
 }
 
 //--------------------------------------------------------------------------
@@ -183,6 +241,10 @@ void AudioAsset::setAudioFile( const char* pAudioFile )
     if ( pAudioFile == mAudioFile )
         return;
 
+    // Any preload is for the old file.
+    releasePreload();
+    mDuration = -1.0f;
+
     // Update.
     mAudioFile = getOwned() ? expandAssetFilePath( pAudioFile ) : pAudioFile;
 
@@ -244,6 +306,9 @@ void AudioAsset::setStreaming( const bool streaming )
     if ( streaming == mDescription.mIsStreaming )
         return;
 
+    // A preload is either a buffer or a primed stream.
+    releasePreload();
+
     // UPdate.
     mDescription.mIsStreaming = streaming;
 
@@ -284,4 +349,114 @@ void AudioAsset::onTamlPostWrite( void )
     mAudioFile = expandAssetFilePath( mAudioFile );
 }
 
+//-----------------------------------------------------------------------------
+
+bool AudioAsset::preload( void )
+{
+    // Ignore if no audio file.
+    if ( mAudioFile == StringTable->EmptyString )
+        return false;
+
+    // Headless games never decode audio, only its metadata.
+    if ( Game->isHeadless() )
+        return getDuration() > 0.0f;
+
+    // Streaming assets are primed rather than loaded.
+    if ( getStreaming() )
+    {
+        if ( !mPrimed )
+            mPrimed = AudioStreamSourceFactory::prime( mAudioFile );
+
+        return mPrimed;
+    }
+
+    // Hold the buffer so it stays loaded.
+    if ( mPreloadedBuffer.isNull() )
+        mPreloadedBuffer = AudioBuffer::find( mAudioFile );
+
+    return !mPreloadedBuffer.isNull() && mPreloadedBuffer->getALBuffer() != 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioAsset::releasePreload( void )
+{
+    if ( mPrimed )
+    {
+        AudioStreamSourceFactory::unprime( mAudioFile );
+        mPrimed = false;
+    }
+
+    mPreloadedBuffer = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 AudioAsset::getDuration( void )
+{
+    // Use the cached duration if available.
+    if ( mDuration >= 0.0f )
+        return mDuration;
+
+    mDuration = 0.0f;
+
+    Stream* pStream = ResourceManager->openStream( mAudioFile );
+    if ( pStream == NULL )
+        return mDuration;
+
+    U32 channels, sampleRate, frames;
+    if ( AudioBuffer::readWAVInfo( *pStream, channels, sampleRate, frames ) )
+        mDuration = (F32)frames / (F32)sampleRate;
+
+    ResourceManager->closeStream( pStream );
+
+    return mDuration;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AudioAsset::getResidentBytes( void ) const
+{
+    U32 bytes = 0;
+
+    if ( getStreaming() )
+    {
+        // Primed data and the rings of any streams playing the file.
+        bytes += AudioStreamSourceFactory::getPrimedBytes( mAudioFile );
+        bytes += alxGetStreamingResidentBytes( mAudioFile );
+    }
+    else
+    {
+        // Only count the buffer if it is already loaded.
+        ResourceObject* pResourceObject = ResourceManager->find( mAudioFile );
+        if ( pResourceObject != NULL && pResourceObject->mInstance != NULL )
+            bytes += static_cast<AudioBuffer*>( pResourceObject->mInstance )->getResidentBytes();
+    }
+
+    // The software mixer keeps its own copy of the samples.
+    if ( SoftwareMixer != NULL )
+        bytes += SoftwareMixer->getSampleBytes( mAudioFile );
+
+    return bytes;
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioAsset::dumpResidentMemory( void )
+{
+    Con::printf( "Audio asset resident memory:" );
 
+    U32 totalBytes = 0;
+    for ( S32 i = 0; i < smAudioAssets.size(); ++i )
+    {
+        const AudioAsset* pAudioAsset = smAudioAssets[i];
+        const U32 bytes = pAudioAsset->getResidentBytes();
+        totalBytes += bytes;
+
+        Con::printf( "  %-40s %10d bytes  %s%s%s", pAudioAsset->getAssetId(), bytes, pAudioAsset->getAudioFile(),
+            pAudioAsset->getStreaming() ? " (streaming)" : "",
+            pAudioAsset->getPreloaded() ? " (preloaded)" : "" );
+    }
+
+    Con::printf( "  %d audio assets, %d bytes total.", smAudioAssets.size(), totalBytes );
+}
@@ -60,8 +60,17 @@ private:
    StringTableEntry mAudioFile;
    Audio::Description mDescription;
 
+   Resource<AudioBuffer> mPreloadedBuffer;
+   bool mPrimed;
+   F32 mDuration;
+
+   static Vector<AudioAsset*> smAudioAssets;
+
 public:
    AudioAsset();
+   virtual ~AudioAsset();
+   virtual bool onAdd();
+   virtual void onRemove();
    static void initPersistFields();
    virtual void copyTo(SimObject* object);
 
@@ -83,6 +92,19 @@ public:
    void setDescription( const Audio::Description& audioDescription );
    inline const Audio::Description& getAudioDescription( void ) const { return mDescription; }
 
+   /// Load the audio now rather than on first play. Streaming assets have
+   /// the start of the stream decoded so playback starts without a disk read.
+   bool preload( void );
+   void releasePreload( void );
+   inline bool getPreloaded( void ) const { return mPrimed || !mPreloadedBuffer.isNull(); }
+
+   /// Length of the audio in seconds, read from the file header only.
+   F32 getDuration( void );
+
+   /// Memory held for this asset's audio: loaded buffers, primed and playing streams, and mixer samples.
+   U32 getResidentBytes( void ) const;
+   static void dumpResidentMemory( void );
+
    DECLARE_CONOBJECT(AudioAsset);
 
 protected:
@@ -0,0 +1,87 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleMethodGroupBeginWithDocs(AudioAsset, AssetBase)
+
+/*! Loads the audio now rather than when it is first played.
+    Streaming assets have the start of the stream decoded instead, so playback starts without waiting on the disk.
+    Only compressed (IMA ADPCM) streams can be primed.
+    @return Returns true if the audio was preloaded.
+*/
+ConsoleMethodWithDocs(AudioAsset, preload, ConsoleBool, 2, 2, ())
+{
+    return object->preload();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Releases anything held by a previous preload.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(AudioAsset, releasePreload, ConsoleVoid, 2, 2, ())
+{
+    object->releasePreload();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the audio is preloaded.
+    @return Returns true if the audio is preloaded.
+*/
+ConsoleMethodWithDocs(AudioAsset, getPreloaded, ConsoleBool, 2, 2, ())
+{
+    return object->getPreloaded();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the length of the audio.
+    Only the file header is read so this is available in headless games where audio is never decoded.
+    @return Returns the length in seconds, or zero if the file could not be read.
+*/
+ConsoleMethodWithDocs(AudioAsset, getDuration, ConsoleFloat, 2, 2, ())
+{
+    return object->getDuration();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the memory held for the asset's audio.
+    This covers loaded buffers, primed data, the buffers of streams playing the file and samples cached by the software mixer.
+    @return Returns the resident memory in bytes.
+*/
+ConsoleMethodWithDocs(AudioAsset, getResidentBytes, ConsoleInt, 2, 2, ())
+{
+    return object->getResidentBytes();
+}
+
+ConsoleMethodGroupEndWithDocs(AudioAsset)
+
+//-----------------------------------------------------------------------------
+
+/*! Prints the memory held by each loaded audio asset to the console.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(dumpAudioAssetMemory, ConsoleVoid, 1, 1, ())
+{
+    AudioAsset::dumpResidentMemory();
+}
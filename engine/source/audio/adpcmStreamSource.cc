@@ -0,0 +1,607 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "audio/adpcmStreamSource.h"
+#include "audio/audioBuffer.h"
+#include "audio/imaAdpcm.h"
+#include "io/fileStream.h"
+#include "io/memstream.h"
+#include "io/zip/zipArchive.h"
+#include "console/console.h"
+
+AdpcmStreamSource::PrimedMap AdpcmStreamSource::smPrimedStreams;
+
+// Slots hold whole blocks so the decoder never splits one
+static U32 getBlocksPerSlot(const AdpcmStreamSource::Header &header)
+{
+    return getMax((U32)AdpcmStreamSource::SlotTargetFrames / header.mBlockFrames, (U32)1);
+}
+
+//-----------------------------------------------------------------------------
+
+AdpcmStreamSource::AdpcmStreamSource(const char *filename)
+{
+    mStream = NULL;
+    mZip = NULL;
+    mFileData = NULL;
+    mBlock = NULL;
+    mSlotData = NULL;
+    mFreeSlots = NULL;
+    mThread = NULL;
+    bIsValid = false;
+    bBuffersAllocated = false;
+    mBufferList[0] = 0;
+    clear();
+
+    mFilename = filename;
+    mPosition = Point3F(0.f,0.f,0.f);
+}
+
+AdpcmStreamSource::~AdpcmStreamSource()
+{
+    freeStream();
+}
+
+void AdpcmStreamSource::clear()
+{
+    freeStream();
+
+    mHandle           = NULL_AUDIOHANDLE;
+    mSource           = 0;
+
+    dMemset(&mDescription, 0, sizeof(Audio::Description));
+    dMemset(&mHeader, 0, sizeof(mHeader));
+    mEnvironment = 0;
+    mPosition.set(0.f,0.f,0.f);
+    mDirection.set(0.f,1.f,0.f);
+    mPitch = 1.f;
+    mScore = 0.f;
+    mCullTime = 0;
+    mFramesPlayed = 0;
+
+    bReady = false;
+    bFinishedPlaying = false;
+    bIsValid = false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AdpcmStreamSource::readHeader(Stream &stream, Header &header)
+{
+    AudioBuffer::WAVHeader wav;
+    if(!AudioBuffer::readWAVHeader(stream, wav))
+        return false;
+
+    if(wav.mFormat != ImaAdpcm::WAVFormatTag || wav.mChannels > 2)
+        return false;
+
+    header.mChannels = wav.mChannels;
+    header.mSampleRate = wav.mSampleRate;
+    header.mBlockAlign = wav.mBlockAlign;
+    header.mBlockFrames = ImaAdpcm::getBlockFrames(wav.mBlockAlign, wav.mChannels);
+    if(header.mBlockFrames == 0)
+        return false;
+
+    header.mDataStart = wav.mDataStart;
+    header.mDataSize = wav.mDataSize;
+    header.mBlockCount = (wav.mDataSize + wav.mBlockAlign - 1) / wav.mBlockAlign;
+    return true;
+}
+
+bool AdpcmStreamSource::isAdpcmFile(const char *filename)
+{
+    Stream *stream = ResourceManager->openStream(filename);
+    if(stream == NULL)
+        return false;
+
+    Header header;
+    const bool result = readHeader(*stream, header);
+    ResourceManager->closeStream(stream);
+
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+
+Stream *AdpcmStreamSource::openDecodeStream(const char *filename, Zip::ZipArchive *&zip, U8 *&fileData, U32 &fileDataSize)
+{
+    zip = NULL;
+    fileData = NULL;
+    fileDataSize = 0;
+
+    ResourceObject *obj = ResourceManager->find(filename);
+    if(obj == NULL)
+        return NULL;
+
+    if(obj->flags & ResourceObject::VolumeBlock)
+    {
+        // Files in a mapped zip get their own stream over the mapping, which the decoder can read
+        const Zip::CentralDir *cd = obj->mCentralDir;
+        if(obj->mZipArchive->isMapped() && (cd->mFlags & Zip::Encrypted) == 0 &&
+            (cd->mCompressMethod == Zip::Stored || cd->mCompressMethod == Zip::Deflated))
+        {
+            Stream *stream = obj->mZipArchive->openFileForRead(cd);
+            if(stream)
+                zip = obj->mZipArchive;
+
+            return stream;
+        }
+
+        // Otherwise the archive's shared stream isn't thread safe, so the file is read whole here
+        Stream *stream = ResourceManager->openStream(obj);
+        if(stream == NULL)
+            return NULL;
+
+        fileDataSize = stream->getStreamSize();
+        fileData = new U8[getMax(fileDataSize, (U32)1)];
+        const bool read = stream->read(fileDataSize, fileData);
+        ResourceManager->closeStream(stream);
+
+        if(!read)
+        {
+            delete [] fileData;
+            fileData = NULL;
+            fileDataSize = 0;
+            return NULL;
+        }
+
+        return new MemStream(fileDataSize, fileData, true, false);
+    }
+
+    char path[1024];
+    ResourceManager->getFullPath(filename, path, sizeof(path));
+
+    FileStream *stream = new FileStream;
+    if(!stream->open(path, FileStream::Read))
+    {
+        delete stream;
+        return NULL;
+    }
+
+    return stream;
+}
+
+void AdpcmStreamSource::closeDecodeStream(Stream *stream, Zip::ZipArchive *zip, U8 *fileData)
+{
+    if(zip)
+        zip->closeFile(stream);
+    else
+        delete stream;
+
+    delete [] fileData;
+}
+
+U32 AdpcmStreamSource::decodeBlocks(Stream *stream, const Header &header, U32 &nextBlock, U32 blocks, bool looping, U8 *scratch, S16 *out)
+{
+    U32 frames = 0;
+    for(U32 i = 0;i < blocks;++i)
+    {
+        if(nextBlock >= header.mBlockCount)
+        {
+            if(!looping)
+                break;
+
+            nextBlock = 0;
+            stream->setPosition(header.mDataStart);
+        }
+
+        // The last block may be short
+        const U32 bytes = getMin(header.mBlockAlign, header.mDataSize - nextBlock * header.mBlockAlign);
+        if(!stream->read(bytes, scratch))
+        {
+            nextBlock = header.mBlockCount;
+            break;
+        }
+
+        frames += ImaAdpcm::decodeBlock(scratch, bytes, header.mChannels, out + frames * header.mChannels);
+        ++nextBlock;
+    }
+
+    return frames;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AdpcmStreamSource::queueBuffer(ALuint buffer, const S16 *data, U32 frames)
+{
+    alBufferData(buffer, mFormat, data, frames * mHeader.mChannels * sizeof(S16), mHeader.mSampleRate);
+    if(alGetError() != AL_NO_ERROR)
+        return false;
+
+    alSourceQueueBuffers(mSource, 1, &buffer);
+    if(alGetError() != AL_NO_ERROR)
+        return false;
+
+    for(U32 i = 0;i < RingSlots;++i)
+    {
+        if(mBufferList[i] == buffer)
+            mBufferFrames[i] = frames;
+    }
+
+    ++mBuffersQueued;
+    return true;
+}
+
+bool AdpcmStreamSource::initStream()
+{
+    alSourceStop(mSource);
+    alSourcei(mSource, AL_BUFFER, 0);
+
+    mStream = openDecodeStream(mFilename, mZip, mFileData, mFileDataSize);
+    if(mStream == NULL)
+        return false;
+
+    if(!readHeader(*mStream, mHeader) || mHeader.mBlockCount == 0)
+    {
+        Con::warnf("AdpcmStreamSource - '%s' is not an IMA ADPCM WAV file.", mFilename);
+        freeStream();
+        return false;
+    }
+
+    mFormat = mHeader.mChannels == 1 ? AL_FORMAT_MONO16 : AL_FORMAT_STEREO16;
+    mBlocksPerSlot = getBlocksPerSlot(mHeader);
+    mFramesPerSlot = mBlocksPerSlot * mHeader.mBlockFrames;
+    mSlotData = new S16[RingSlots * mFramesPerSlot * mHeader.mChannels];
+    mBlock = new U8[mHeader.mBlockAlign];
+
+    // Clear Error Code
+    alGetError();
+
+    alGenBuffers(RingSlots, mBufferList);
+    if(alGetError() != AL_NO_ERROR)
+    {
+        freeStream();
+        return false;
+    }
+
+    bBuffersAllocated = true;
+    mBuffersQueued = 0;
+    mFramesPlayed = 0;
+    mNextBlock = 0;
+    dMemset(mBufferFrames, 0, sizeof(mBufferFrames));
+
+    // Fill the OpenAL queue up front, from the primed data if there is any
+    U32 numBuffers = 0;
+    PrimedMap::iterator itr = smPrimedStreams.find(StringTable->insert(mFilename));
+    if(itr != smPrimedStreams.end() && itr->value->mHeader.mDataSize == mHeader.mDataSize &&
+        itr->value->mHeader.mBlockAlign == mHeader.mBlockAlign)
+    {
+        PrimedStream *primed = itr->value;
+        for(; numBuffers < primed->mSlots;++numBuffers)
+        {
+            if(!queueBuffer(mBufferList[numBuffers], getSlot(primed->mData, numBuffers), primed->mSlotFrames[numBuffers]))
+                return false;
+        }
+
+        mNextBlock = primed->mNextBlock;
+        mStream->setPosition(mHeader.mDataStart + mNextBlock * mHeader.mBlockAlign);
+    }
+    else
+    {
+        for(; numBuffers < RingSlots;++numBuffers)
+        {
+            const U32 frames = decodeBlocks(mStream, mHeader, mNextBlock, mBlocksPerSlot, mDescription.mIsLooping, mBlock, mSlotData);
+            if(frames == 0)
+                break;
+
+            if(!queueBuffer(mBufferList[numBuffers], mSlotData, frames))
+                return false;
+        }
+    }
+
+    for(U32 i = numBuffers;i < RingSlots;++i)
+        mIdleBuffers.push_back(mBufferList[i]);
+
+    // The decoder takes over from here
+    mReadSlot = 0;
+    mWriteSlot = 0;
+    mFilledSlots = 0;
+    mEndOfStream = !mDescription.mIsLooping && mNextBlock >= mHeader.mBlockCount;
+#ifndef TORQUE_OS_EMSCRIPTEN
+    // Threads never run on Emscripten, so updateBuffers() decodes there instead
+    if(!mEndOfStream)
+    {
+        mStopDecode = false;
+        mFreeSlots = new Semaphore(RingSlots);
+        mThread = new DecodeThread(this);
+        mThread->start();
+    }
+#endif
+
+    alSourcei(mSource, AL_LOOPING, AL_FALSE);
+    bReady = true;
+    bIsValid = true;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AdpcmStreamSource::DecodeThread::run(void *arg /* = 0 */)
+{
+    mSource->decodeLoop();
+}
+
+void AdpcmStreamSource::decodeLoop()
+{
+    for(;;)
+    {
+        // Wait for the main thread to free a slot
+        mFreeSlots->acquire(true);
+        if(mStopDecode)
+            break;
+
+        if(decodeSlot())
+            break;
+    }
+}
+
+bool AdpcmStreamSource::decodeSlot()
+{
+    const U32 frames = decodeBlocks(mStream, mHeader, mNextBlock, mBlocksPerSlot, mDescription.mIsLooping, mBlock, getSlot(mSlotData, mWriteSlot));
+    const bool finished = frames == 0 || (!mDescription.mIsLooping && mNextBlock >= mHeader.mBlockCount);
+
+    MutexHandle handle;
+    handle.lock(&mMutex, true);
+
+    if(frames)
+    {
+        mSlotFrames[mWriteSlot] = frames;
+        mWriteSlot = (mWriteSlot + 1) % RingSlots;
+        ++mFilledSlots;
+    }
+
+    mEndOfStream = finished;
+    handle.unlock();
+
+    return finished;
+}
+
+bool AdpcmStreamSource::updateBuffers()
+{
+    // don't do anything if buffer isn't initialized
+    if(!bIsValid)
+        return false;
+
+    // reset AL error code
+    alGetError();
+
+    // Take back the buffers that have been played
+    ALint processed = 0;
+    alGetSourcei(mSource, AL_BUFFERS_PROCESSED, &processed);
+    while(processed-- > 0)
+    {
+        ALuint bufferID;
+        alSourceUnqueueBuffers(mSource, 1, &bufferID);
+        if(alGetError() != AL_NO_ERROR)
+            return false;
+
+        for(U32 i = 0;i < RingSlots;++i)
+        {
+            if(mBufferList[i] == bufferID)
+                mFramesPlayed += mBufferFrames[i];
+        }
+
+        --mBuffersQueued;
+        mIdleBuffers.push_back(bufferID);
+    }
+
+    // Without a decode thread, fill the free slots here
+    if(mThread == NULL)
+    {
+        while(!mEndOfStream && mFilledSlots < (U32)mIdleBuffers.size())
+            decodeSlot();
+    }
+
+    // Refill them from the decoded slots
+    U32 filledSlots;
+    bool endOfStream;
+    for(;;)
+    {
+        mMutex.lock(true);
+        filledSlots = mFilledSlots;
+        endOfStream = mEndOfStream;
+        mMutex.unlock();
+
+        if(filledSlots == 0 || mIdleBuffers.empty())
+            break;
+
+        const ALuint bufferID = mIdleBuffers.last();
+        mIdleBuffers.pop_back();
+
+        if(!queueBuffer(bufferID, getSlot(mSlotData, mReadSlot), mSlotFrames[mReadSlot]))
+            return false;
+
+        mMutex.lock(true);
+        mReadSlot = (mReadSlot + 1) % RingSlots;
+        --mFilledSlots;
+        mMutex.unlock();
+
+        if(mFreeSlots)
+            mFreeSlots->release();
+    }
+
+    if(mBuffersQueued == 0 && filledSlots == 0 && endOfStream)
+    {
+        bFinishedPlaying = true;
+        return false;
+    }
+
+    // The source stops if the decoder fell behind, so restart it once there is data
+    ALint state;
+    alGetSourcei(mSource, AL_SOURCE_STATE, &state);
+    if(state == AL_STOPPED && mBuffersQueued > 0)
+        alSourcePlay(mSource);
+
+    return true;
+}
+
+void AdpcmStreamSource::freeStream()
+{
+    bReady = false;
+
+    if(mThread)
+    {
+        mStopDecode = true;
+        mFreeSlots->release();
+        mThread->join();
+        delete mThread;
+        mThread = NULL;
+    }
+
+    delete mFreeSlots;
+    mFreeSlots = NULL;
+
+    closeDecodeStream(mStream, mZip, mFileData);
+    mStream = NULL;
+    mZip = NULL;
+    mFileData = NULL;
+    mFileDataSize = 0;
+
+    delete [] mBlock;
+    mBlock = NULL;
+
+    delete [] mSlotData;
+    mSlotData = NULL;
+
+    if(bBuffersAllocated)
+    {
+        if(mSource != 0)
+        {
+            alSourceStop(mSource);
+            alSourcei(mSource, AL_BUFFER, 0);
+        }
+
+        alDeleteBuffers(RingSlots, mBufferList);
+        for(U32 i = 0;i < RingSlots;++i)
+            mBufferList[i] = 0;
+
+        bBuffersAllocated = false;
+    }
+
+    mIdleBuffers.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+F32 AdpcmStreamSource::getElapsedTime()
+{
+    if(mHeader.mSampleRate == 0)
+        return -1.f;
+
+    // Looping streams report the position within the file
+    const F32 total = getTotalTime();
+    const F32 elapsed = (F32)((F64)mFramesPlayed / (F64)mHeader.mSampleRate);
+
+    return total > 0.f ? mFmod(elapsed, total) : elapsed;
+}
+
+F32 AdpcmStreamSource::getTotalTime()
+{
+    if(mHeader.mSampleRate == 0 || mHeader.mBlockCount == 0)
+        return -1.f;
+
+    const U32 lastBlockBytes = mHeader.mDataSize - (mHeader.mBlockCount - 1) * mHeader.mBlockAlign;
+    const U32 frames = (mHeader.mBlockCount - 1) * mHeader.mBlockFrames + ImaAdpcm::getBlockFrames(lastBlockBytes, mHeader.mChannels);
+
+    return (F32)frames / (F32)mHeader.mSampleRate;
+}
+
+U32 AdpcmStreamSource::getResidentBytes()
+{
+    // The decoded ring, the same again queued in OpenAL, and any in-memory copy of the file
+    U32 bytes = mFileDataSize;
+    if(mSlotData != NULL)
+        bytes += RingSlots * mFramesPerSlot * mHeader.mChannels * sizeof(S16) * 2;
+
+    return bytes;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AdpcmStreamSource::prime(const char *filename)
+{
+    StringTableEntry name = StringTable->insert(filename);
+    if(smPrimedStreams.find(name) != smPrimedStreams.end())
+        return true;
+
+    Zip::ZipArchive *zip;
+    U8 *fileData;
+    U32 fileDataSize;
+    Stream *stream = openDecodeStream(name, zip, fileData, fileDataSize);
+    if(stream == NULL)
+        return false;
+
+    Header header;
+    if(!readHeader(*stream, header) || header.mBlockCount == 0)
+    {
+        closeDecodeStream(stream, zip, fileData);
+        return false;
+    }
+
+    const U32 blocksPerSlot = getBlocksPerSlot(header);
+    const U32 framesPerSlot = blocksPerSlot * header.mBlockFrames;
+
+    PrimedStream *primed = new PrimedStream;
+    primed->mHeader = header;
+    primed->mData = new S16[RingSlots * framesPerSlot * header.mChannels];
+    primed->mSlots = 0;
+    primed->mNextBlock = 0;
+
+    U8 *scratch = new U8[header.mBlockAlign];
+    for(U32 slot = 0;slot < RingSlots;++slot)
+    {
+        const U32 frames = decodeBlocks(stream, header, primed->mNextBlock, blocksPerSlot, false, scratch, primed->mData + slot * framesPerSlot * header.mChannels);
+        if(frames == 0)
+            break;
+
+        primed->mSlotFrames[slot] = frames;
+        ++primed->mSlots;
+    }
+
+    delete [] scratch;
+    closeDecodeStream(stream, zip, fileData);
+
+    smPrimedStreams.insert(name, primed);
+    return true;
+}
+
+void AdpcmStreamSource::unprime(const char *filename)
+{
+    PrimedMap::iterator itr = smPrimedStreams.find(StringTable->insert(filename));
+    if(itr == smPrimedStreams.end())
+        return;
+
+    delete [] itr->value->mData;
+    delete itr->value;
+    smPrimedStreams.erase(itr);
+}
+
+U32 AdpcmStreamSource::getPrimedBytes(const char *filename)
+{
+    PrimedMap::iterator itr = smPrimedStreams.find(StringTable->insert(filename));
+    if(itr == smPrimedStreams.end())
+        return 0;
+
+    const Header &header = itr->value->mHeader;
+    return RingSlots * getBlocksPerSlot(header) * header.mBlockFrames * header.mChannels * sizeof(S16);
+}
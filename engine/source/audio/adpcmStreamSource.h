@@ -0,0 +1,173 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ADPCMSTREAMSOURCE_H_
+#define _ADPCMSTREAMSOURCE_H_
+
+#ifndef _AUDIOSTREAMSOURCE_H_
+#include "audio/audioStreamSource.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+namespace Zip
+{
+   class ZipArchive;
+}
+
+/// Streams an IMA ADPCM WAV file.
+///
+/// A worker thread reads and decodes the file into a small ring of PCM
+/// slots. updateBuffers() runs on the main thread and hands finished slots
+/// to OpenAL, so the main thread never touches the disk after the stream
+/// starts. Only the ring and the OpenAL queue are resident, whatever the
+/// length of the file. Where there are no threads updateBuffers() decodes
+/// the free slots itself.
+///
+/// The first part of a file can be primed ahead of time so that starting
+/// the stream doesn't have to wait on the disk either:
+///
+/// @code
+///      AdpcmStreamSource::prime("game/audio/music.wav");
+///      alxPlay(pMusicAsset);
+/// @endcode
+class AdpcmStreamSource: public AudioStreamSource
+{
+public:
+    enum
+    {
+        RingSlots = 4,              ///< Decoded slots, also the number of OpenAL buffers
+        SlotTargetFrames = 8192     ///< Slots hold whole blocks, about this many frames
+    };
+
+    /// Layout of an IMA ADPCM WAV file
+    struct Header
+    {
+        U32 mChannels;
+        U32 mSampleRate;
+        U32 mBlockAlign;
+        U32 mBlockFrames;
+        U32 mBlockCount;
+        U32 mDataStart;
+        U32 mDataSize;
+    };
+
+    AdpcmStreamSource(const char *filename);
+    virtual ~AdpcmStreamSource();
+
+    virtual bool initStream();
+    virtual bool updateBuffers();
+    virtual void freeStream();
+    virtual F32 getElapsedTime();
+    virtual F32 getTotalTime();
+    virtual U32 getResidentBytes();
+
+    /// Read the header of an IMA ADPCM WAV file, leaving the stream at the start of the data
+    static bool readHeader(Stream &stream, Header &header);
+    static bool isAdpcmFile(const char *filename);
+
+    /// Decode the start of a file now so the next stream of it starts without reading
+    static bool prime(const char *filename);
+    static void unprime(const char *filename);
+    static U32 getPrimedBytes(const char *filename);
+
+private:
+    class DecodeThread : public Thread
+    {
+        AdpcmStreamSource *mSource;
+
+    public:
+        DecodeThread(AdpcmStreamSource *source) : Thread(0, 0, false), mSource(source) {}
+        virtual void run(void *arg = 0);
+    };
+
+    struct PrimedStream
+    {
+        Header mHeader;
+        S16 *mData;
+        U32 mSlotFrames[RingSlots];
+        U32 mSlots;
+        U32 mNextBlock;
+    };
+
+    typedef HashMap<StringTableEntry, PrimedStream*> PrimedMap;
+    static PrimedMap smPrimedStreams;
+
+    Header mHeader;
+    Stream *mStream;
+    Zip::ZipArchive *mZip;          ///< Archive mStream came from, if it is a mapped zip stream
+    U8 *mFileData;                  ///< Whole file, when it can't be read off the main thread
+    U32 mFileDataSize;
+    U8 *mBlock;
+    U32 mNextBlock;
+    U32 mBlocksPerSlot;
+    U32 mFramesPerSlot;
+    ALenum mFormat;
+
+    // The ring, shared with the decode thread
+    Mutex mMutex;
+    Semaphore *mFreeSlots;
+    S16 *mSlotData;
+    U32 mSlotFrames[RingSlots];
+    U32 mReadSlot;
+    U32 mWriteSlot;
+    U32 mFilledSlots;
+    bool mEndOfStream;
+    volatile bool mStopDecode;
+    DecodeThread *mThread;
+
+    // OpenAL side, main thread only
+    ALuint mBufferList[RingSlots];
+    U32 mBufferFrames[RingSlots];
+    Vector<ALuint> mIdleBuffers;
+    U32 mBuffersQueued;
+    U64 mFramesPlayed;
+
+    bool bReady;
+    bool bBuffersAllocated;
+
+    void clear();
+    void decodeLoop();
+    bool decodeSlot();
+    bool queueBuffer(ALuint buffer, const S16 *data, U32 frames);
+    S16 *getSlot(S16 *base, U32 slot) const { return base + slot * mFramesPerSlot * mHeader.mChannels; }
+
+    static Stream *openDecodeStream(const char *filename, Zip::ZipArchive *&zip, U8 *&fileData, U32 &fileDataSize);
+    static void closeDecodeStream(Stream *stream, Zip::ZipArchive *zip, U8 *fileData);
+    static U32 decodeBlocks(Stream *stream, const Header &header, U32 &nextBlock, U32 blocks, bool looping, U8 *scratch, S16 *out);
+};
+
+#endif // _ADPCMSTREAMSOURCE_H_
@@ -26,6 +26,7 @@
 #include "console/console.h"
 #include "console/consoleTypes.h"
 #include "game/gameConnection.h"
+#include "game/gameInterface.h"
 #include "io/fileStream.h"
 #include "audio/audioStreamSourceFactory.h"
 
@@ -2342,6 +2343,19 @@ F32 alxGetStreamDuration( AUDIOHANDLE handle )
    return (*itr)->getTotalTime();
 }
 
+U32 alxGetStreamingResidentBytes( const char *filename )
+{
+   U32 bytes = 0;
+   for(StreamingList::iterator itr = mStreamingList.begin(); itr != mStreamingList.end(); itr++)
+   {
+      const char *streamFile = (*itr)->getFilename();
+      if(streamFile && !dStricmp(streamFile, filename))
+         bytes += (*itr)->getResidentBytes();
+   }
+
+   return bytes;
+}
+
 // Namespace: Audio ---------------------------------------------------------
 namespace Audio
 {
@@ -2438,6 +2452,13 @@ bool OpenALInit()
 {
    OpenALShutdown();
 
+   // Headless games have no audio device.
+   if (Game->isHeadless())
+   {
+      Con::printf("   OpenAL is not available in a headless game.");
+      return false;
+   }
+
    if(!OpenALDLLInit())
       return false;
 
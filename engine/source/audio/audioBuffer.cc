@@ -22,6 +22,7 @@
 
 #include "platform/platformAL.h"
 #include "audio/audioBuffer.h"
+#include "audio/imaAdpcm.h"
 #include "io/stream.h"
 #include "console/console.h"
 #include "memory/frameAllocator.h"
@@ -38,65 +39,6 @@
 
 //#define LOG_SOUND_LOADS
 
-/// WAV File-header
-struct WAVFileHdr
-{
-  ALubyte  id[4];
-  ALsizei  size;
-  ALubyte  type[4];
-};
-
-//// WAV Fmt-header
-struct WAVFmtHdr
-{
-  ALushort format;
-  ALushort channels;
-  ALuint   samplesPerSec;
-  ALuint   bytesPerSec;
-  ALushort blockAlign;
-  ALushort bitsPerSample;
-};
-
-/// WAV FmtEx-header
-struct WAVFmtExHdr
-{
-  ALushort size;
-  ALushort samplesPerBlock;
-};
-
-/// WAV Smpl-header
-struct WAVSmplHdr
-{
-  ALuint   manufacturer;
-  ALuint   product;
-  ALuint   samplePeriod;
-  ALuint   note;
-  ALuint   fineTune;
-  ALuint   SMPTEFormat;
-  ALuint   SMPTEOffest;
-  ALuint   loops;
-  ALuint   samplerData;
-  struct
-  {
-    ALuint identifier;
-    ALuint type;
-    ALuint start;
-    ALuint end;
-    ALuint fraction;
-    ALuint count;
-  }      loop[1];
-};
-
-/// WAV Chunk-header
-struct WAVChunkHdr
-{
-  ALubyte  id[4];
-  ALuint   size;
-};
-
-#define CHUNKSIZE 4096
-
-
 
 //--------------------------------------
 AudioBuffer::AudioBuffer(StringTableEntry filename)
@@ -106,6 +48,7 @@ AudioBuffer::AudioBuffer(StringTableEntry filename)
    mFilename = filename;
    mLoading = false;
    malBuffer = 0;
+   mResidentBytes = 0;
 }
 
 AudioBuffer::~AudioBuffer()
@@ -249,138 +192,191 @@ ALuint AudioBuffer::getALBuffer()
 */
 bool AudioBuffer::readWAV(ResourceObject *obj)
 {
-   WAVChunkHdr chunkHdr;
-   WAVFmtExHdr fmtExHdr;
-   WAVFileHdr  fileHdr;
-   WAVSmplHdr  smplHdr;
-   WAVFmtHdr   fmtHdr;
-
    ALenum  format = AL_FORMAT_MONO16;
    char   *data   = NULL;
    ALsizei size   = 0;
    ALsizei freq   = 22050;
-   ALboolean loop = AL_FALSE;
 
    Stream *stream = ResourceManager->openStream(obj);
    if (!stream)
       return false;
 
-   stream->read(4, &fileHdr.id[0]);
-   stream->read(&fileHdr.size);
-   stream->read(4, &fileHdr.type[0]);
+   readWAVData(*stream, format, data, size, freq);
 
-   fileHdr.size=((fileHdr.size+1)&~1)-4;
+   ResourceManager->closeStream(stream);
+   if (data)
+   {
+      alBufferData(malBuffer, format, data, size, freq);
+      delete [] data;
+      if (alGetError() != AL_NO_ERROR)
+         return false;
 
-   stream->read(4, &chunkHdr.id[0]);
-   stream->read(&chunkHdr.size);
-   // unread chunk data rounded up to nearest WORD
-   S32 chunkRemaining = chunkHdr.size + (chunkHdr.size&1);
+      mResidentBytes = size;
+      return true;
+   }
 
-   while ((fileHdr.size!=0) && (stream->getStatus() != Stream::EOS))
+   return false;
+}
+
+/*!   Read the format and data chunk position of a WAV file from the given stream.
+*/
+bool AudioBuffer::readWAVHeader(Stream &s, WAVHeader &header)
+{
+   char id[4];
+   U32 size;
+
+   if (!s.read(4, id) || dStrncmp(id, "RIFF", 4) != 0)
+      return false;
+   s.read(&size);
+   if (!s.read(4, id) || dStrncmp(id, "WAVE", 4) != 0)
+      return false;
+
+   bool haveFormat = false;
+   while (s.read(4, id) && s.read(&size))
    {
-      // WAV Format header
-      if (!dStrncmp((const char*)chunkHdr.id,"fmt ",4))
+      const U32 chunkStart = s.getPosition();
+
+      if (!dStrncmp(id, "fmt ", 4))
       {
-         stream->read(&fmtHdr.format);
-         stream->read(&fmtHdr.channels);
-         stream->read(&fmtHdr.samplesPerSec);
-         stream->read(&fmtHdr.bytesPerSec);
-         stream->read(&fmtHdr.blockAlign);
-         stream->read(&fmtHdr.bitsPerSample);
-
-         if (fmtHdr.format==0x0001)
-         {
-            format=(fmtHdr.channels==1?
-               (fmtHdr.bitsPerSample==8?AL_FORMAT_MONO8:AL_FORMAT_MONO16):
-               (fmtHdr.bitsPerSample==8?AL_FORMAT_STEREO8:AL_FORMAT_STEREO16));
-            freq=fmtHdr.samplesPerSec;
-            chunkRemaining -= sizeof(WAVFmtHdr);
-         }
-         else
-         {
-            stream->read(sizeof(WAVFmtExHdr), &fmtExHdr);
-            chunkRemaining -= sizeof(WAVFmtExHdr);
-         }
+         U32 bytesPerSec;
+
+         s.read(&header.mFormat);
+         s.read(&header.mChannels);
+         s.read(&header.mSampleRate);
+         s.read(&bytesPerSec);
+         s.read(&header.mBlockAlign);
+         s.read(&header.mBitsPerSample);
+
+         haveFormat = header.mChannels != 0 && header.mSampleRate != 0 && header.mBlockAlign != 0;
       }
-      // WAV Format header
-      else if (!dStrncmp((const char*)chunkHdr.id,"data",4))
+      else if (!dStrncmp(id, "data", 4))
       {
-         if (fmtHdr.format==0x0001)
-         {
-            size=chunkHdr.size;
-            data=new char[chunkHdr.size];
-            if (data)
-            {
-               stream->read(chunkHdr.size, data);
-#if defined(TORQUE_BIG_ENDIAN)
-               // need to endian-flip the 16-bit data.
-               if (fmtHdr.bitsPerSample==16) // !!!TBD we don't handle stereo, so may be RL flipped.
-               {
-                  U16 *ds = (U16*)data;
-                  U16 *de = (U16*)(data+size);
-                  while (ds<de)
-                  {
-#if defined(TORQUE_BIG_ENDIAN)
-                     *ds = convertLEndianToHost(*ds);
-#else
-                     *ds = convertBEndianToHost(*ds);
-#endif
-                     ds++;
-                  }
-               }
-#endif
-               chunkRemaining -= chunkHdr.size;
-            }
-            else
-               break;
-         }
-         else if (fmtHdr.format==0x0011)
-         {
-            //IMA ADPCM
-         }
-         else if (fmtHdr.format==0x0055)
-         {
-            //MP3 WAVE
-         }
+         if (!haveFormat)
+            return false;
+
+         header.mDataStart = chunkStart;
+         header.mDataSize = size;
+         return true;
       }
-      // WAV Loop header
-      else if (!dStrncmp((const char*)chunkHdr.id,"smpl",4))
+
+      // Chunks are padded to an even size
+      if (!s.setPosition(chunkStart + size + (size & 1)))
+         return false;
+   }
+
+   return false;
+}
+
+/*!   Read the format and frame count of a WAV file from the given stream.
+      The data chunk is skipped rather than read.
+*/
+bool AudioBuffer::readWAVInfo(Stream &s, U32 &channels, U32 &sampleRate, U32 &frames)
+{
+   WAVHeader header;
+   if (!readWAVHeader(s, header))
+      return false;
+
+   channels = header.mChannels;
+   sampleRate = header.mSampleRate;
+
+   if (header.mFormat == 0x0001)
+   {
+      frames = header.mDataSize / header.mBlockAlign;
+      return true;
+   }
+
+   if (header.mFormat == ImaAdpcm::WAVFormatTag && header.mChannels <= 2)
+   {
+      const U32 blockFrames = ImaAdpcm::getBlockFrames(header.mBlockAlign, header.mChannels);
+      frames = (header.mDataSize / header.mBlockAlign) * blockFrames;
+
+      // A trailing partial block still holds whole frames.
+      const U32 partialBytes = header.mDataSize % header.mBlockAlign;
+      if (partialBytes > 0)
+         frames += ImaAdpcm::getBlockFrames(partialBytes, header.mChannels);
+
+      return blockFrames != 0;
+   }
+
+   return false;
+}
+
+/*!   Read the PCM data of a WAV file from the given stream.
+*/
+bool AudioBuffer::readWAVData(Stream &s, ALenum &format, char *&data, ALsizei &size, ALsizei &freq)
+{
+   data = NULL;
+   size = 0;
+
+   WAVHeader header;
+   if (!readWAVHeader(s, header))
+      return false;
+
+   if (header.mFormat == 0x0001)
+   {
+      format=(header.mChannels==1?
+         (header.mBitsPerSample==8?AL_FORMAT_MONO8:AL_FORMAT_MONO16):
+         (header.mBitsPerSample==8?AL_FORMAT_STEREO8:AL_FORMAT_STEREO16));
+      freq=header.mSampleRate;
+
+      data=new char[header.mDataSize];
+      if (!s.read(header.mDataSize, data))
       {
-         // this struct read is NOT endian safe but it is ok because
-         // we are only testing the loops field against ZERO
-         stream->read(sizeof(WAVSmplHdr), &smplHdr);
-         loop = (smplHdr.loops ? AL_TRUE : AL_FALSE);
-         chunkRemaining -= sizeof(WAVSmplHdr);
+         delete [] data;
+         data = NULL;
+         return false;
       }
 
-      // either we have unread chunk data or we found an unknown chunk type
-      // loop and read up to 1K bytes at a time until we have
-      // read to the end of this chunk
-      char buffer[1024];
-      AssertFatal(chunkRemaining >= 0, "AudioBuffer::readWAV: remaining chunk data should never be less than zero.");
-      while (chunkRemaining > 0)
+      size=header.mDataSize;
+#if defined(TORQUE_BIG_ENDIAN)
+      // need to endian-flip the 16-bit data.
+      if (header.mBitsPerSample==16) // !!!TBD we don't handle stereo, so may be RL flipped.
       {
-         S32 readSize = getMin(1024, chunkRemaining);
-         stream->read(readSize, buffer);
-         chunkRemaining -= readSize;
+         U16 *ds = (U16*)data;
+         U16 *de = (U16*)(data+size);
+         while (ds<de)
+         {
+            *ds = convertLEndianToHost(*ds);
+            ds++;
+         }
       }
-
-      fileHdr.size-=(((chunkHdr.size+1)&~1)+8);
-
-      // read next chunk header...
-      stream->read(4, &chunkHdr.id[0]);
-      stream->read(&chunkHdr.size);
-      // unread chunk data rounded up to nearest WORD
-      chunkRemaining = chunkHdr.size + (chunkHdr.size&1);
+#endif
+      return true;
    }
 
-   ResourceManager->closeStream(stream);
-   if (data)
+   // IMA ADPCM is decoded to 16-bit PCM
+   if (header.mFormat == ImaAdpcm::WAVFormatTag && header.mChannels <= 2)
    {
-      alBufferData(malBuffer, format, data, size, freq);
-      delete [] data;
-      return (alGetError() == AL_NO_ERROR);
+      const U32 blockAlign = header.mBlockAlign;
+      const U32 blockFrames = ImaAdpcm::getBlockFrames(blockAlign, header.mChannels);
+      if (blockFrames == 0)
+         return false;
+
+      format=(header.mChannels==1?AL_FORMAT_MONO16:AL_FORMAT_STEREO16);
+      freq=header.mSampleRate;
+
+      U8 *block = new U8[blockAlign];
+      const U32 blockCount = (header.mDataSize + blockAlign - 1) / blockAlign;
+      data = new char[blockCount * blockFrames * header.mChannels * sizeof(S16)];
+      S16 *pcm = (S16*)data;
+
+      U32 frames = 0;
+      U32 compressedLeft = header.mDataSize;
+      while (compressedLeft > 0)
+      {
+         const U32 blockBytes = getMin(compressedLeft, blockAlign);
+         if (!s.read(blockBytes, block))
+            break;
+
+         frames += ImaAdpcm::decodeBlock(block, blockBytes, header.mChannels, pcm + frames * header.mChannels);
+         compressedLeft -= blockBytes;
+      }
+
+      delete [] block;
+
+      size = frames * header.mChannels * sizeof(S16);
+      return true;
    }
 
    return false;
-}
\ No newline at end of file
+}
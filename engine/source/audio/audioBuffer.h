@@ -43,6 +43,7 @@ private:
    StringTableEntry  mFilename;
    bool              mLoading;
    ALuint            malBuffer;
+   U32               mResidentBytes;
 
    bool readRIFFchunk(Stream &s, const char *seekLabel, U32 *size);
    bool readWAV(ResourceObject *obj);
@@ -52,10 +53,36 @@ public:
    ~AudioBuffer();
    ALuint getALBuffer();
    bool isLoading() {return(mLoading);}
+   /// Bytes of PCM data handed to OpenAL
+   U32 getResidentBytes() const {return(mResidentBytes);}
 
    static Resource<AudioBuffer> find(const char *filename);
    static ResourceInstance* construct(Stream& stream);
 
+   /// The format and data chunk of a WAV file
+   struct WAVHeader
+   {
+      U16 mFormat;            ///< Format tag, 1 for PCM
+      U16 mChannels;
+      U32 mSampleRate;
+      U16 mBlockAlign;
+      U16 mBitsPerSample;
+      U32 mDataStart;         ///< Stream position of the sample data
+      U32 mDataSize;
+   };
+
+   /// Walk the chunks of a WAV file up to its data, leaving the stream at the
+   /// start of the sample data. The format is not checked beyond being present.
+   static bool readWAVHeader(Stream &stream, WAVHeader &header);
+
+   /// Read the PCM data of a WAV file. On success data is allocated with new[]
+   /// and owned by the caller.
+   static bool readWAVData(Stream &stream, ALenum &format, char *&data, ALsizei &size, ALsizei &freq);
+
+   /// Read only the format and length of a WAV file without touching the
+   /// sample data.
+   static bool readWAVInfo(Stream &stream, U32 &channels, U32 &sampleRate, U32 &frames);
+
 };
 
 
@@ -0,0 +1,700 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "audio/audioMixer.h"
+#include "audio/audioMixerDevice.h"
+#include "audio/audioMixerKernels.h"
+#include "audio/audioBuffer.h"
+#include "audio/AudioAsset.h"
+#include "console/console.h"
+#include "math/mMathFn.h"
+#include "assets/assetManager.h"
+#include "game/gameInterface.h"
+
+#include "audioMixer_ScriptBinding.h"
+
+AudioMixer *SoftwareMixer = NULL;
+
+// Voices quieter than this are never mixed
+static const F32 sMinAudibleGain = 0.001f;
+
+//-----------------------------------------------------------------------------
+
+void AudioMixer::create()
+{
+   SoftwareMixer = new AudioMixer;
+}
+
+void AudioMixer::destroy()
+{
+   delete SoftwareMixer;
+   SoftwareMixer = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioMixer::MixerThread::run(void *arg /* = 0 */)
+{
+   // Pace the blocks to real time; the devices themselves never block.
+   const F64 blockMs = (F64)BlockFrames * 1000.0 / (F64)mMixer->mSampleRate;
+   F64 deadline = (F64)Platform::getRealMilliseconds();
+
+   while(!mMixer->mStopThread)
+   {
+      mMixer->mixBlock();
+
+      deadline += blockMs;
+      const F64 now = (F64)Platform::getRealMilliseconds();
+      if(deadline > now)
+         Platform::sleep((U32)(deadline - now));
+      else if(now - deadline > 250.0)
+         deadline = now;   // Fell badly behind, don't try to catch up
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+AudioMixer::AudioMixer()
+{
+   VECTOR_SET_ASSOCIATION(mFreeVoices);
+   VECTOR_SET_ASSOCIATION(mCandidates);
+   VECTOR_SET_ASSOCIATION(mMixJobs);
+
+   // Hand out low indices first
+   mFreeVoices.setSize(MaxVoices);
+   for(U32 i = 0;i < MaxVoices;++i)
+   {
+      mVoices[i].mGeneration = 1;
+      mVoices[i].mActive = false;
+      mFreeVoices[i] = MaxVoices - 1 - i;
+   }
+   mCandidates.reserve(MaxVoices);
+   mMixJobs.reserve(MaxVoices);
+
+   mActiveVoiceCount = 0;
+   mMixedVoiceLimit = DefaultMixedVoiceLimit;
+
+   mListenerPosition.set(0.0f, 0.0f, 0.0f);
+   mMasterVolume = 1.0f;
+   for(U32 i = 0;i < Audio::AudioVolumeChannels;++i)
+      mChannelVolumes[i] = 1.0f;
+
+   mSampleBytes = 0;
+
+   mDevice = NULL;
+   mThread = NULL;
+   mStopThread = false;
+   mSampleRate = DefaultSampleRate;
+
+   mBlocksMixed = 0;
+   mLastMixedVoices = 0;
+   mLastVirtualVoices = 0;
+   mRealTimeFactor = 0.0f;
+}
+
+AudioMixer::~AudioMixer()
+{
+   closeDevice();
+   stopAll();
+
+   for(HashMap<StringTableEntry, Sample *>::iterator itr = mSamples.begin();itr != mSamples.end();++itr)
+   {
+      delete [] itr->value->mData;
+      delete itr->value;
+   }
+   mSamples.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+bool AudioMixer::openDevice(const char *name, const char *filename, U32 sampleRate, bool threaded)
+{
+   closeDevice();
+
+   AudioMixerDevice *device = AudioMixerDevice::create(name, filename);
+   if(device == NULL)
+      return false;
+
+   mSampleRate = getMax(sampleRate, (U32)8000);
+   if(!device->open(mSampleRate, OutputChannels))
+   {
+      delete device;
+      return false;
+   }
+
+   mDevice = device;
+   mBlocksMixed = 0;
+   mRealTimeFactor = 0.0f;
+
+   if(threaded)
+   {
+      mStopThread = false;
+      mThread = new MixerThread(this);
+      mThread->start();
+   }
+
+   return true;
+}
+
+void AudioMixer::closeDevice()
+{
+   if(mThread)
+   {
+      mStopThread = true;
+      mThread->join();
+      delete mThread;
+      mThread = NULL;
+   }
+
+   if(mDevice)
+   {
+      mDevice->close();
+      delete mDevice;
+      mDevice = NULL;
+   }
+}
+
+bool AudioMixer::render(F32 seconds)
+{
+   if(mDevice == NULL || mThread != NULL)
+   {
+      Con::warnf("AudioMixer::render - Needs a device opened without a mixer thread.");
+      return false;
+   }
+
+   const U32 blocks = (U32)mCeil(seconds * (F32)mSampleRate / (F32)BlockFrames);
+
+   const U32 startTime = Platform::getRealMilliseconds();
+   for(U32 i = 0;i < blocks;++i)
+      mixBlock();
+   const U32 elapsed = getMax(Platform::getRealMilliseconds() - startTime, (U32)1);
+
+   mRealTimeFactor = ((F32)(blocks * BlockFrames) / (F32)mSampleRate) / ((F32)elapsed / 1000.0f);
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+const AudioMixer::Sample *AudioMixer::loadSample(const char *filename)
+{
+   StringTableEntry name = StringTable->insert(filename);
+
+   HashMap<StringTableEntry, Sample *>::iterator itr = mSamples.find(name);
+   if(itr != mSamples.end())
+      return itr->value;
+
+   ResourceObject *obj = ResourceManager->find(name);
+   if(obj == NULL)
+   {
+      Con::warnf("AudioMixer::loadSample - Could not find '%s'.", name);
+      return NULL;
+   }
+
+   S32 len = dStrlen(name);
+   if(len < 4 || dStricmp(name + len - 4, ".wav"))
+   {
+      Con::warnf("AudioMixer::loadSample - Only WAV files can be mixed, '%s' skipped.", name);
+      return NULL;
+   }
+
+   Stream *stream = ResourceManager->openStream(obj);
+   if(stream == NULL)
+      return NULL;
+
+   // Headless games never hear the mix, so only the length is read to time voices
+   if(Game->isHeadless())
+   {
+      Sample *sample = new Sample;
+      sample->mFilename = name;
+      sample->mData = NULL;
+
+      const bool read = AudioBuffer::readWAVInfo(*stream, sample->mChannels, sample->mSampleRate, sample->mFrames);
+      ResourceManager->closeStream(stream);
+
+      if(!read)
+      {
+         delete sample;
+         Con::warnf("AudioMixer::loadSample - Could not read '%s'.", name);
+         return NULL;
+      }
+
+      mSamples.insert(name, sample);
+      return sample;
+   }
+
+   ALenum format = AL_FORMAT_MONO16;
+   char *data = NULL;
+   ALsizei size = 0;
+   ALsizei freq = 22050;
+   AudioBuffer::readWAVData(*stream, format, data, size, freq);
+   ResourceManager->closeStream(stream);
+
+   if(data == NULL)
+   {
+      Con::warnf("AudioMixer::loadSample - Could not read '%s'.", name);
+      return NULL;
+   }
+
+   Sample *sample = new Sample;
+   sample->mFilename = name;
+   sample->mChannels = (format == AL_FORMAT_STEREO8 || format == AL_FORMAT_STEREO16) ? 2 : 1;
+   sample->mSampleRate = freq;
+
+   if(format == AL_FORMAT_MONO8 || format == AL_FORMAT_STEREO8)
+   {
+      // Widen unsigned 8 bit to signed 16 bit
+      sample->mFrames = size / sample->mChannels;
+      sample->mData = new S16[size];
+      for(ALsizei i = 0;i < size;++i)
+         sample->mData[i] = (S16)(((S32)(U8)data[i] - 128) << 8);
+      delete [] data;
+   }
+   else
+   {
+      sample->mFrames = size / (sample->mChannels * sizeof(S16));
+      sample->mData = (S16 *)data;
+   }
+
+   mSamples.insert(name, sample);
+   mSampleBytes += sample->mFrames * sample->mChannels * sizeof(S16);
+
+   return sample;
+}
+
+bool AudioMixer::addSample(const char *name, const S16 *data, U32 frames, U32 channels, U32 sampleRate)
+{
+   if(name == NULL || data == NULL || frames == 0 || channels < 1 || channels > 2 || sampleRate == 0)
+      return false;
+
+   StringTableEntry entry = StringTable->insert(name);
+   if(mSamples.find(entry) != mSamples.end())
+      return false;
+
+   Sample *sample = new Sample;
+   sample->mFilename = entry;
+   sample->mChannels = channels;
+   sample->mSampleRate = sampleRate;
+   sample->mFrames = frames;
+   sample->mData = new S16[frames * channels];
+   dMemcpy(sample->mData, data, frames * channels * sizeof(S16));
+
+   mSamples.insert(entry, sample);
+   mSampleBytes += frames * channels * sizeof(S16);
+
+   return true;
+}
+
+void AudioMixer::purgeSamples()
+{
+   MutexHandle mixHandle;
+   mixHandle.lock(&mMixMutex, true);
+
+   MutexHandle handle;
+   handle.lock(&mMutex, true);
+
+   Vector<StringTableEntry> unused;
+   for(HashMap<StringTableEntry, Sample *>::iterator itr = mSamples.begin();itr != mSamples.end();++itr)
+   {
+      bool inUse = false;
+      for(U32 i = 0;i < MaxVoices && !inUse;++i)
+         inUse = mVoices[i].mActive && mVoices[i].mSample == itr->value;
+
+      if(!inUse)
+         unused.push_back(itr->key);
+   }
+
+   for(S32 i = 0;i < unused.size();++i)
+   {
+      HashMap<StringTableEntry, Sample *>::iterator itr = mSamples.find(unused[i]);
+      Sample *sample = itr->value;
+      mSampleBytes -= sample->mFrames * sample->mChannels * sizeof(S16);
+      delete [] sample->mData;
+      delete sample;
+      mSamples.erase(itr);
+   }
+}
+
+U32 AudioMixer::getSampleBytes(const char *filename) const
+{
+   // Samples are only added and removed on the main thread
+   HashMap<StringTableEntry, Sample *>::const_iterator itr = mSamples.find(StringTable->insert(filename));
+   if(itr == mSamples.end())
+      return 0;
+
+   return itr->value->mFrames * itr->value->mChannels * sizeof(S16);
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AudioMixer::play(const char *filename, F32 volume, bool looping, F32 priority, U32 volumeChannel)
+{
+   // Loading happens on the calling thread, outside the lock
+   const Sample *sample = loadSample(filename);
+   if(sample == NULL || sample->mFrames == 0)
+      return 0;
+
+   MutexHandle handle;
+   handle.lock(&mMutex, true);
+
+   if(mFreeVoices.empty())
+   {
+      Con::warnf("AudioMixer::play - All %d voices are in use.", MaxVoices);
+      return 0;
+   }
+
+   const U32 index = mFreeVoices.last();
+   mFreeVoices.pop_back();
+
+   Voice &voice = mVoices[index];
+   voice.mActive = true;
+   voice.mSample = sample;
+   voice.mVolume = mClampF(volume, 0.0f, 1.0f);
+   voice.mPriority = getMax(priority, 0.0f);
+   voice.mVolumeChannel = volumeChannel < Audio::AudioVolumeChannels ? volumeChannel : 0;
+   voice.mLooping = looping;
+   voice.mIs3D = false;
+   voice.mPosition.set(0.0f, 0.0f, 0.0f);
+   voice.mReferenceDistance = 1.0f;
+   voice.mMaxDistance = 100.0f;
+   voice.mCursor = 0.0;
+   voice.mGainLeft = voice.mGainRight = 0.0f;
+   mActiveVoiceCount++;
+
+   return (voice.mGeneration << VoiceIndexBits) | index;
+}
+
+U32 AudioMixer::play(const AudioAsset *asset, F32 priority)
+{
+   const Audio::Description &desc = asset->getAudioDescription();
+   return play(asset->getAudioFile(), desc.mVolume, desc.mIsLooping, priority, desc.mVolumeChannel);
+}
+
+//-----------------------------------------------------------------------------
+
+AudioMixer::Voice *AudioMixer::lookupVoice(U32 handle)
+{
+   // Called with the mutex held
+   Voice &voice = mVoices[handle & (MaxVoices - 1)];
+   if(!voice.mActive || voice.mGeneration != (handle >> VoiceIndexBits))
+      return NULL;
+   return &voice;
+}
+
+void AudioMixer::freeVoice(U32 index)
+{
+   // Called with the mutex held
+   Voice &voice = mVoices[index];
+   voice.mActive = false;
+
+   // Move the generation on so handles to the old voice go stale. Zero is
+   // skipped so that no handle is ever 0.
+   voice.mGeneration = (voice.mGeneration + 1) & GenerationMask;
+   if(voice.mGeneration == 0)
+      voice.mGeneration = 1;
+
+   mFreeVoices.push_back(index);
+   mActiveVoiceCount--;
+}
+
+void AudioMixer::stop(U32 handle)
+{
+   MutexHandle mutexHandle;
+   mutexHandle.lock(&mMutex, true);
+
+   if(lookupVoice(handle) != NULL)
+      freeVoice(handle & (MaxVoices - 1));
+}
+
+void AudioMixer::stopAll()
+{
+   MutexHandle handle;
+   handle.lock(&mMutex, true);
+
+   for(U32 i = 0;i < MaxVoices;++i)
+   {
+      if(mVoices[i].mActive)
+         freeVoice(i);
+   }
+}
+
+bool AudioMixer::isPlaying(U32 handle)
+{
+   MutexHandle mutexHandle;
+   mutexHandle.lock(&mMutex, true);
+
+   return lookupVoice(handle) != NULL;
+}
+
+void AudioMixer::setVoiceVolume(U32 handle, F32 volume)
+{
+   MutexHandle mutexHandle;
+   mutexHandle.lock(&mMutex, true);
+
+   Voice *voice = lookupVoice(handle);
+   if(voice)
+      voice->mVolume = mClampF(volume, 0.0f, 1.0f);
+}
+
+void AudioMixer::setVoicePriority(U32 handle, F32 priority)
+{
+   MutexHandle mutexHandle;
+   mutexHandle.lock(&mMutex, true);
+
+   Voice *voice = lookupVoice(handle);
+   if(voice)
+      voice->mPriority = getMax(priority, 0.0f);
+}
+
+void AudioMixer::setVoicePosition(U32 handle, const Point3F &position, F32 referenceDistance, F32 maxDistance)
+{
+   MutexHandle mutexHandle;
+   mutexHandle.lock(&mMutex, true);
+
+   Voice *voice = lookupVoice(handle);
+   if(voice)
+   {
+      voice->mIs3D = true;
+      voice->mPosition = position;
+      voice->mReferenceDistance = getMax(referenceDistance, 0.001f);
+      voice->mMaxDistance = getMax(maxDistance, voice->mReferenceDistance);
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioMixer::setListenerPosition(const Point3F &position)
+{
+   MutexHandle handle;
+   handle.lock(&mMutex, true);
+   mListenerPosition = position;
+}
+
+void AudioMixer::setMasterVolume(F32 volume)
+{
+   MutexHandle handle;
+   handle.lock(&mMutex, true);
+   mMasterVolume = mClampF(volume, 0.0f, 1.0f);
+}
+
+void AudioMixer::setChannelVolume(U32 channel, F32 volume)
+{
+   if(channel >= Audio::AudioVolumeChannels)
+      return;
+
+   MutexHandle handle;
+   handle.lock(&mMutex, true);
+   mChannelVolumes[channel] = mClampF(volume, 0.0f, 1.0f);
+}
+
+void AudioMixer::setMixedVoiceLimit(U32 limit)
+{
+   MutexHandle handle;
+   handle.lock(&mMutex, true);
+   mMixedVoiceLimit = getMax(getMin(limit, (U32)MaxVoices), (U32)1);
+}
+
+//-----------------------------------------------------------------------------
+
+S32 QSORT_CALLBACK AudioMixer::compareCandidates(const void *a, const void *b)
+{
+   const F32 scoreA = ((const AudioMixer::Candidate *)a)->mScore;
+   const F32 scoreB = ((const AudioMixer::Candidate *)b)->mScore;
+   return scoreA < scoreB ? 1 : (scoreA > scoreB ? -1 : 0);
+}
+
+void AudioMixer::rankVoices()
+{
+   // Called with the mutex held
+   mCandidates.clear();
+
+   for(U32 i = 0;i < MaxVoices;++i)
+   {
+      Voice &voice = mVoices[i];
+      if(!voice.mActive)
+         continue;
+
+      F32 gain = voice.mVolume * mMasterVolume * mChannelVolumes[voice.mVolumeChannel];
+      F32 pan = 0.0f;
+
+      if(voice.mIs3D)
+      {
+         const Point3F offset = voice.mPosition - mListenerPosition;
+         const F32 distance = offset.len();
+
+         // Inverse distance between the reference and max distance, silent beyond
+         if(distance >= voice.mMaxDistance)
+            gain = 0.0f;
+         else if(distance > voice.mReferenceDistance)
+            gain *= voice.mReferenceDistance / distance;
+
+         pan = mClampF(offset.x / getMax(distance, voice.mReferenceDistance), -1.0f, 1.0f);
+      }
+
+      voice.mGainLeft = gain * getMin(1.0f, 1.0f - pan);
+      voice.mGainRight = gain * getMin(1.0f, 1.0f + pan);
+
+      if(gain < sMinAudibleGain)
+         continue;
+
+      Candidate candidate;
+      candidate.mScore = gain * voice.mPriority;
+      candidate.mIndex = i;
+      mCandidates.push_back(candidate);
+   }
+
+   // Only order them when there are more than we will mix
+   if((U32)mCandidates.size() > mMixedVoiceLimit)
+   {
+      dQsort(mCandidates.address(), mCandidates.size(), sizeof(Candidate), compareCandidates);
+      mCandidates.setSize(mMixedVoiceLimit);
+   }
+}
+
+void AudioMixer::mixVoice(MixJob &job, U32 frames)
+{
+   // Called without the mutex, on a copy of the voice
+   const Sample &sample = *job.mSample;
+   const F64 step = (F64)sample.mSampleRate / (F64)mSampleRate;
+
+   U32 mixed = 0;
+   while(mixed < frames)
+   {
+      if(job.mCursor >= (F64)sample.mFrames)
+      {
+         if(!job.mLooping)
+            break;
+         job.mCursor -= (F64)sample.mFrames;
+      }
+
+      F32 *out = mMixBuffer + mixed * OutputChannels;
+      const U32 remaining = frames - mixed;
+
+      if(sample.mSampleRate == mSampleRate)
+      {
+         // Straight copy, cursor stays on whole frames
+         const U32 start = (U32)job.mCursor;
+         const U32 count = getMin(remaining, sample.mFrames - start);
+         const S16 *in = sample.mData + start * sample.mChannels;
+
+         if(sample.mChannels == 1)
+            AudioMixerKernels::mixMono(out, in, count, job.mGainLeft, job.mGainRight);
+         else
+            AudioMixerKernels::mixStereo(out, in, count, job.mGainLeft, job.mGainRight);
+
+         job.mCursor += count;
+         mixed += count;
+      }
+      else
+      {
+         // Stop at the end of the sample so a loop can wrap. This stays in
+         // F64 as F32 can't hold the cursor exactly in long samples.
+         const F64 untilEnd = mCeilD(((F64)sample.mFrames - job.mCursor) / step);
+         const U32 count = untilEnd < (F64)remaining ? getMax((U32)untilEnd, (U32)1) : remaining;
+
+         AudioMixerKernels::mixResampled(out, sample.mData, sample.mChannels, sample.mFrames, job.mCursor, step, count, job.mGainLeft, job.mGainRight);
+         mixed += count;
+      }
+   }
+}
+
+void AudioMixer::advanceVoice(Voice &voice, U32 frames)
+{
+   // Called with the mutex held
+   const Sample &sample = *voice.mSample;
+   voice.mCursor += (F64)frames * (F64)sample.mSampleRate / (F64)mSampleRate;
+
+   if(voice.mCursor >= (F64)sample.mFrames && voice.mLooping)
+      voice.mCursor = mFmodD(voice.mCursor, (F64)sample.mFrames);
+}
+
+void AudioMixer::mixBlock()
+{
+   dMemset(mMixBuffer, 0, sizeof(mMixBuffer));
+
+   mMixMutex.lock();
+   mMutex.lock();
+
+   rankVoices();
+
+   // Copy what the audible voices need so that they can be mixed without
+   // holding up play(), stop() and the rest on the main thread.
+   mMixJobs.clear();
+   for(S32 i = 0;i < mCandidates.size();++i)
+   {
+      const Voice &voice = mVoices[mCandidates[i].mIndex];
+      if(voice.mSample->mData == NULL)
+         continue;
+
+      MixJob job;
+      job.mSample = voice.mSample;
+      job.mCursor = voice.mCursor;
+      job.mLooping = voice.mLooping;
+      job.mGainLeft = voice.mGainLeft;
+      job.mGainRight = voice.mGainRight;
+      mMixJobs.push_back(job);
+   }
+
+   // Advance every voice, mixed or not, and retire any that finished
+   const U32 activeVoices = mActiveVoiceCount;
+   for(U32 i = 0;i < MaxVoices;++i)
+   {
+      Voice &voice = mVoices[i];
+      if(!voice.mActive)
+         continue;
+
+      advanceVoice(voice, BlockFrames);
+
+      if(voice.mCursor >= (F64)voice.mSample->mFrames && !voice.mLooping)
+         freeVoice(i);
+   }
+
+   mLastMixedVoices = mMixJobs.size();
+   mLastVirtualVoices = activeVoices - mMixJobs.size();
+   mBlocksMixed++;
+
+   mMutex.unlock();
+
+   for(S32 i = 0;i < mMixJobs.size();++i)
+      mixVoice(mMixJobs[i], BlockFrames);
+
+   mMixMutex.unlock();
+
+   AudioMixerKernels::convertToS16(mOutputBuffer, mMixBuffer, BlockFrames * OutputChannels);
+   mDevice->write(mOutputBuffer, BlockFrames);
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioMixer::getStats(Stats &stats)
+{
+   MutexHandle handle;
+   handle.lock(&mMutex, true);
+
+   stats.mActiveVoices = mActiveVoiceCount;
+   stats.mMixedVoices = mLastMixedVoices;
+   stats.mVirtualVoices = mLastVirtualVoices;
+   stats.mBlocksMixed = mBlocksMixed;
+   stats.mSamplesLoaded = mSamples.size();
+   stats.mSampleBytes = mSampleBytes;
+   stats.mRealTimeFactor = mRealTimeFactor;
+   stats.mSimd = AudioMixerKernels::isSimdEnabled();
+}
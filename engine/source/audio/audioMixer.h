@@ -0,0 +1,251 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _AUDIOMIXER_H_
+#define _AUDIOMIXER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _PLATFORMAUDIO_H_
+#include "platform/platformAudio.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+class AudioMixerDevice;
+class AudioAsset;
+
+/// Engine side software mixer with virtual voices.
+///
+/// Any number of voices up to MaxVoices can be playing. Each block the
+/// voices are ranked by priority times their audible gain (volume, channel
+/// volume, master volume and distance attenuation) and only the loudest
+/// few, see setMixedVoiceLimit(), are actually mixed. The rest are virtual:
+/// their play position keeps advancing so they come back in the right place
+/// when they rank high enough again.
+///
+/// The mixer runs alongside the OpenAL layer rather than replacing it and
+/// has a single global instance:
+///
+/// @code
+///      SoftwareMixer->openDevice("null");
+///      U32 voice = SoftwareMixer->play(pAsset, 2.0f);
+///      SoftwareMixer->setVoicePosition(voice, Point3F(10, 0, 0));
+/// @endcode
+///
+/// Output goes to an AudioMixerDevice. With a threaded device the mixing
+/// happens on a dedicated thread paced to real time; otherwise call render()
+/// to mix a given amount of audio synchronously, which is how the mixer is
+/// benchmarked and tested headless.
+class AudioMixer
+{
+public:
+   enum
+   {
+      DefaultSampleRate = 44100,
+      OutputChannels = 2,
+      BlockFrames = 512,
+      VoiceIndexBits = 12,
+      MaxVoices = 1 << VoiceIndexBits,
+      GenerationMask = (1 << (32 - VoiceIndexBits)) - 1,
+      DefaultMixedVoiceLimit = 64
+   };
+
+   /// Decoded sample data, shared by every voice playing the file
+   struct Sample
+   {
+      StringTableEntry mFilename;
+      S16 *mData;             ///< NULL in headless games, where samples are timed but not decoded
+      U32 mFrames;
+      U32 mChannels;
+      U32 mSampleRate;
+   };
+
+   struct Stats
+   {
+      U32 mActiveVoices;      ///< Voices playing, audible or not
+      U32 mMixedVoices;       ///< Voices mixed in the last block
+      U32 mVirtualVoices;     ///< Voices skipped in the last block
+      U32 mBlocksMixed;       ///< Blocks mixed since the device was opened
+      U32 mSamplesLoaded;     ///< Entries in the sample cache
+      U32 mSampleBytes;       ///< Memory held by the sample cache
+      F32 mRealTimeFactor;    ///< Audio seconds mixed per second by the last render()
+      bool mSimd;             ///< Whether the SSE2 kernels are in use
+   };
+
+protected:
+   struct Voice
+   {
+      U32 mGeneration;
+      bool mActive;
+      const Sample *mSample;
+      F32 mVolume;
+      F32 mPriority;
+      U32 mVolumeChannel;
+      bool mLooping;
+      bool mIs3D;
+      Point3F mPosition;
+      F32 mReferenceDistance;
+      F32 mMaxDistance;
+      F64 mCursor;            ///< Position in source frames
+
+      // Worked out when ranking
+      F32 mGainLeft;
+      F32 mGainRight;
+   };
+
+   /// What mixBlock() needs to mix a voice once the lock is released
+   struct MixJob
+   {
+      const Sample *mSample;
+      F64 mCursor;
+      bool mLooping;
+      F32 mGainLeft;
+      F32 mGainRight;
+   };
+
+   struct Candidate
+   {
+      F32 mScore;
+      U32 mIndex;
+   };
+
+   class MixerThread : public Thread
+   {
+      AudioMixer *mMixer;
+
+   public:
+      MixerThread(AudioMixer *mixer) : Thread(0, 0, false), mMixer(mixer) {}
+      virtual void run(void *arg = 0);
+   };
+
+   // Guards the voices, listener and volumes against the mixer thread
+   Mutex mMutex;
+
+   // Held by mixBlock() while it mixes without mMutex, so that purgeSamples()
+   // can't free a sample that is still being read. Always taken before mMutex.
+   Mutex mMixMutex;
+
+   Voice mVoices[MaxVoices];
+   Vector<U32> mFreeVoices;
+   Vector<Candidate> mCandidates;
+   Vector<MixJob> mMixJobs;
+   U32 mActiveVoiceCount;
+   U32 mMixedVoiceLimit;
+
+   Point3F mListenerPosition;
+   F32 mMasterVolume;
+   F32 mChannelVolumes[Audio::AudioVolumeChannels];
+
+   // Main thread only
+   HashMap<StringTableEntry, Sample *> mSamples;
+   U32 mSampleBytes;
+
+   AudioMixerDevice *mDevice;
+   MixerThread *mThread;
+   volatile bool mStopThread;
+   U32 mSampleRate;
+
+   F32 mMixBuffer[BlockFrames * OutputChannels];
+   S16 mOutputBuffer[BlockFrames * OutputChannels];
+   U32 mBlocksMixed;
+   U32 mLastMixedVoices;
+   U32 mLastVirtualVoices;
+   F32 mRealTimeFactor;
+
+   AudioMixer();
+   ~AudioMixer();
+
+   const Sample *loadSample(const char *filename);
+   Voice *lookupVoice(U32 handle);
+   void freeVoice(U32 index);
+   static S32 QSORT_CALLBACK compareCandidates(const void *a, const void *b);
+   void rankVoices();
+   void mixVoice(MixJob &job, U32 frames);
+   void advanceVoice(Voice &voice, U32 frames);
+   void mixBlock();
+
+public:
+   static void create();                  ///< Create the global mixer
+   static void destroy();                 ///< Close the device and free everything
+
+   /// Open an output device ("null" or "wav"). When threaded, mixing runs on
+   /// its own thread in real time, otherwise nothing is mixed until render().
+   bool openDevice(const char *name, const char *filename = NULL, U32 sampleRate = DefaultSampleRate, bool threaded = true);
+   void closeDevice();
+   bool isDeviceOpen() const { return mDevice != NULL; }
+
+   /// Mix the given number of seconds of audio now, on the calling thread.
+   /// Only valid when the device was opened without a thread.
+   bool render(F32 seconds);
+
+   /// Start a voice. Returns 0 if the sample could not be loaded or all voices are in use.
+   U32 play(const char *filename, F32 volume = 1.0f, bool looping = false, F32 priority = 1.0f, U32 volumeChannel = 0);
+   U32 play(const AudioAsset *asset, F32 priority = 1.0f);
+
+   void stop(U32 handle);
+   void stopAll();
+   bool isPlaying(U32 handle);
+
+   void setVoiceVolume(U32 handle, F32 volume);
+   void setVoicePriority(U32 handle, F32 priority);
+   /// Placing a voice makes it positional, attenuated between the reference and max distance.
+   void setVoicePosition(U32 handle, const Point3F &position, F32 referenceDistance = 1.0f, F32 maxDistance = 100.0f);
+
+   void setListenerPosition(const Point3F &position);
+   void setMasterVolume(F32 volume);
+   void setChannelVolume(U32 channel, F32 volume);
+   void setMixedVoiceLimit(U32 limit);
+   U32 getMixedVoiceLimit() const { return mMixedVoiceLimit; }
+
+   /// Cache decoded 16 bit sample data under a name so that play() can use
+   /// it without a file, e.g. for generated audio. The data is copied.
+   /// Returns false if a sample with the name is already cached.
+   bool addSample(const char *name, const S16 *data, U32 frames, U32 channels, U32 sampleRate);
+
+   /// Drop cached samples no voice is playing.
+   void purgeSamples();
+   /// Memory held by the cached sample for a file, if any
+   U32 getSampleBytes(const char *filename) const;
+
+   void getStats(Stats &stats);
+};
+
+extern AudioMixer *SoftwareMixer;
+
+#endif // _AUDIOMIXER_H_
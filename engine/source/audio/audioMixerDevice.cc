@@ -0,0 +1,130 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "audio/audioMixerDevice.h"
+#include "console/console.h"
+
+//-----------------------------------------------------------------------------
+
+AudioMixerDevice *AudioMixerDevice::create(const char *name, const char *filename)
+{
+   if(!dStricmp(name, "null"))
+      return new NullAudioMixerDevice;
+
+   if(!dStricmp(name, "wav"))
+   {
+      if(filename == NULL || *filename == 0)
+      {
+         Con::warnf("AudioMixerDevice::create - The wav device needs a filename.");
+         return NULL;
+      }
+      return new WavFileAudioMixerDevice(filename);
+   }
+
+   Con::warnf("AudioMixerDevice::create - Unknown device '%s'.", name);
+   return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+WavFileAudioMixerDevice::WavFileAudioMixerDevice(const char *filename)
+{
+   Con::expandPath(mFilename, sizeof(mFilename), filename);
+   mChannels = 0;
+   mDataBytes = 0;
+   mOpen = false;
+}
+
+WavFileAudioMixerDevice::~WavFileAudioMixerDevice()
+{
+   close();
+}
+
+void WavFileAudioMixerDevice::writeHeader(U32 sampleRate)
+{
+   const U16 blockAlign = (U16)(mChannels * sizeof(S16));
+
+   mStream.write(4, "RIFF");
+   mStream.write((U32)(36 + mDataBytes));
+   mStream.write(4, "WAVE");
+
+   mStream.write(4, "fmt ");
+   mStream.write((U32)16);
+   mStream.write((U16)1);
+   mStream.write((U16)mChannels);
+   mStream.write((U32)sampleRate);
+   mStream.write((U32)(sampleRate * blockAlign));
+   mStream.write(blockAlign);
+   mStream.write((U16)16);
+
+   mStream.write(4, "data");
+   mStream.write((U32)mDataBytes);
+}
+
+bool WavFileAudioMixerDevice::open(U32 sampleRate, U32 channels)
+{
+   close();
+
+   if(!mStream.open(mFilename, FileStream::Write))
+   {
+      Con::warnf("WavFileAudioMixerDevice::open - Could not open '%s' for write.", mFilename);
+      return false;
+   }
+
+   mChannels = channels;
+   mDataBytes = 0;
+   mOpen = true;
+
+   // The sizes are patched in on close
+   writeHeader(sampleRate);
+   return true;
+}
+
+void WavFileAudioMixerDevice::write(const S16 *samples, U32 frames)
+{
+   if(!mOpen)
+      return;
+
+   const U32 count = frames * mChannels;
+#if defined(TORQUE_BIG_ENDIAN)
+   for(U32 i = 0;i < count;++i)
+      mStream.write(samples[i]);
+#else
+   mStream.write(count * sizeof(S16), samples);
+#endif
+   mDataBytes += count * sizeof(S16);
+}
+
+void WavFileAudioMixerDevice::close()
+{
+   if(!mOpen)
+      return;
+
+   // Patch the RIFF and data chunk sizes
+   mStream.setPosition(4);
+   mStream.write((U32)(36 + mDataBytes));
+   mStream.setPosition(40);
+   mStream.write((U32)mDataBytes);
+
+   mStream.close();
+   mOpen = false;
+}
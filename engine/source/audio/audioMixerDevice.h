@@ -0,0 +1,85 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _AUDIOMIXERDEVICE_H_
+#define _AUDIOMIXERDEVICE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+/// Where the software mixer sends its interleaved S16 output.
+class AudioMixerDevice
+{
+public:
+   virtual ~AudioMixerDevice() {}
+
+   virtual const char *getName() const = 0;
+   virtual bool open(U32 sampleRate, U32 channels) = 0;
+   virtual void close() = 0;
+   virtual void write(const S16 *samples, U32 frames) = 0;
+
+   /// Create a device by name ("null" or "wav"). filename is used by the WAV
+   /// device. Returns NULL for an unknown name.
+   static AudioMixerDevice *create(const char *name, const char *filename);
+};
+
+//-----------------------------------------------------------------------------
+
+/// Discards the output. Used to run and measure the mixer headless.
+class NullAudioMixerDevice : public AudioMixerDevice
+{
+public:
+   virtual const char *getName() const { return "null"; }
+   virtual bool open(U32 sampleRate, U32 channels) { return true; }
+   virtual void close() {}
+   virtual void write(const S16 *samples, U32 frames) {}
+};
+
+//-----------------------------------------------------------------------------
+
+/// Writes the output to a 16 bit PCM WAV file.
+class WavFileAudioMixerDevice : public AudioMixerDevice
+{
+   char mFilename[1024];
+   FileStream mStream;
+   U32 mChannels;
+   U32 mDataBytes;
+   bool mOpen;
+
+   void writeHeader(U32 sampleRate);
+
+public:
+   WavFileAudioMixerDevice(const char *filename);
+   virtual ~WavFileAudioMixerDevice();
+
+   virtual const char *getName() const { return "wav"; }
+   virtual bool open(U32 sampleRate, U32 channels);
+   virtual void close();
+   virtual void write(const S16 *samples, U32 frames);
+};
+
+#endif // _AUDIOMIXERDEVICE_H_
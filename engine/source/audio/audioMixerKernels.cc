@@ -0,0 +1,175 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "audio/audioMixerKernels.h"
+#include "math/mMathFn.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TORQUE_AUDIO_MIXER_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace AudioMixerKernels
+{
+
+// Scale from S16 to the -1..1 range the mixer accumulates in
+static const F32 sInputScale = 1.0f / 32768.0f;
+
+//-----------------------------------------------------------------------------
+
+bool isSimdEnabled()
+{
+#ifdef TORQUE_AUDIO_MIXER_SSE2
+   return true;
+#else
+   return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void mixMono(F32 *out, const S16 *in, U32 frames, F32 gainLeft, F32 gainRight)
+{
+   gainLeft *= sInputScale;
+   gainRight *= sInputScale;
+
+   U32 frame = 0;
+
+#ifdef TORQUE_AUDIO_MIXER_SSE2
+   const __m128 gains = _mm_setr_ps(gainLeft, gainRight, gainLeft, gainRight);
+   for(;frame + 4 <= frames;frame += 4)
+   {
+      // Sign extend four samples to 32 bits and convert
+      const __m128i packed = _mm_loadl_epi64((const __m128i *)(in + frame));
+      const __m128 samples = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16));
+
+      // Duplicate each sample into a left/right pair
+      const __m128 pairsLow = _mm_unpacklo_ps(samples, samples);
+      const __m128 pairsHigh = _mm_unpackhi_ps(samples, samples);
+
+      F32 *dest = out + frame * 2;
+      _mm_storeu_ps(dest, _mm_add_ps(_mm_loadu_ps(dest), _mm_mul_ps(pairsLow, gains)));
+      _mm_storeu_ps(dest + 4, _mm_add_ps(_mm_loadu_ps(dest + 4), _mm_mul_ps(pairsHigh, gains)));
+   }
+#endif
+
+   for(;frame < frames;++frame)
+   {
+      const F32 sample = in[frame];
+      out[frame * 2] += sample * gainLeft;
+      out[frame * 2 + 1] += sample * gainRight;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void mixStereo(F32 *out, const S16 *in, U32 frames, F32 gainLeft, F32 gainRight)
+{
+   gainLeft *= sInputScale;
+   gainRight *= sInputScale;
+
+   U32 frame = 0;
+
+#ifdef TORQUE_AUDIO_MIXER_SSE2
+   const __m128 gains = _mm_setr_ps(gainLeft, gainRight, gainLeft, gainRight);
+   for(;frame + 4 <= frames;frame += 4)
+   {
+      // Eight samples, four frames
+      const __m128i packed = _mm_loadu_si128((const __m128i *)(in + frame * 2));
+      const __m128 samplesLow = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16));
+      const __m128 samplesHigh = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16));
+
+      F32 *dest = out + frame * 2;
+      _mm_storeu_ps(dest, _mm_add_ps(_mm_loadu_ps(dest), _mm_mul_ps(samplesLow, gains)));
+      _mm_storeu_ps(dest + 4, _mm_add_ps(_mm_loadu_ps(dest + 4), _mm_mul_ps(samplesHigh, gains)));
+   }
+#endif
+
+   for(;frame < frames;++frame)
+   {
+      out[frame * 2] += in[frame * 2] * gainLeft;
+      out[frame * 2 + 1] += in[frame * 2 + 1] * gainRight;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void mixResampled(F32 *out, const S16 *in, U32 channels, U32 sourceFrames, F64 &position, F64 step, U32 frames, F32 gainLeft, F32 gainRight)
+{
+   gainLeft *= sInputScale;
+   gainRight *= sInputScale;
+
+   for(U32 frame = 0;frame < frames;++frame)
+   {
+      const U32 index = (U32)position;
+      const U32 next = index + 1 < sourceFrames ? index + 1 : index;
+      const F32 fraction = (F32)(position - (F64)index);
+
+      if(channels == 1)
+      {
+         const F32 sample = in[index] + (in[next] - in[index]) * fraction;
+         out[frame * 2] += sample * gainLeft;
+         out[frame * 2 + 1] += sample * gainRight;
+      }
+      else
+      {
+         const F32 left = in[index * 2] + (in[next * 2] - in[index * 2]) * fraction;
+         const F32 right = in[index * 2 + 1] + (in[next * 2 + 1] - in[index * 2 + 1]) * fraction;
+         out[frame * 2] += left * gainLeft;
+         out[frame * 2 + 1] += right * gainRight;
+      }
+
+      position += step;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void convertToS16(S16 *out, const F32 *in, U32 samples)
+{
+   U32 sample = 0;
+
+#ifdef TORQUE_AUDIO_MIXER_SSE2
+   const __m128 scale = _mm_set1_ps(32767.0f);
+   const __m128 minimum = _mm_set1_ps(-1.0f);
+   const __m128 maximum = _mm_set1_ps(1.0f);
+   for(;sample + 8 <= samples;sample += 8)
+   {
+      const __m128 low = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + sample), minimum), maximum);
+      const __m128 high = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + sample + 4), minimum), maximum);
+      const __m128i packed = _mm_packs_epi32(_mm_cvtps_epi32(_mm_mul_ps(low, scale)), _mm_cvtps_epi32(_mm_mul_ps(high, scale)));
+      _mm_storeu_si128((__m128i *)(out + sample), packed);
+   }
+#endif
+
+   for(;sample < samples;++sample)
+   {
+      F32 value = in[sample];
+      if(value > 1.0f)
+         value = 1.0f;
+      else if(value < -1.0f)
+         value = -1.0f;
+      out[sample] = (S16)mFloor(value * 32767.0f + 0.5f);
+   }
+}
+
+} // namespace AudioMixerKernels
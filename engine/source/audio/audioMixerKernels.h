@@ -0,0 +1,56 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _AUDIOMIXERKERNELS_H_
+#define _AUDIOMIXERKERNELS_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+/// Inner loops of the software mixer.
+///
+/// The output is always interleaved stereo F32. The straight copy kernels
+/// have SSE2 versions when the compiler targets it and plain C versions
+/// otherwise; resampling stays scalar.
+namespace AudioMixerKernels
+{
+   /// True when the SSE2 kernels were compiled in
+   bool isSimdEnabled();
+
+   /// Accumulate mono S16 samples into interleaved stereo output
+   void mixMono(F32 *out, const S16 *in, U32 frames, F32 gainLeft, F32 gainRight);
+
+   /// Accumulate interleaved stereo S16 samples into interleaved stereo output
+   void mixStereo(F32 *out, const S16 *in, U32 frames, F32 gainLeft, F32 gainRight);
+
+   /// Accumulate with linear interpolation, stepping the source position by
+   /// step per output frame. position is advanced. The caller keeps position
+   /// below sourceFrames for every frame mixed; the last source frame is
+   /// interpolated against itself.
+   void mixResampled(F32 *out, const S16 *in, U32 channels, U32 sourceFrames, F64 &position, F64 step, U32 frames, F32 gainLeft, F32 gainRight);
+
+   /// Convert F32 samples to S16 with saturation
+   void convertToS16(S16 *out, const F32 *in, U32 samples);
+}
+
+#endif // _AUDIOMIXERKERNELS_H_
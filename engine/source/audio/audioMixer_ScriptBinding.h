@@ -0,0 +1,286 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin(AudioMixer, "Functions for the software audio mixer.");
+
+/*! @defgroup AudioMixerFunctions Audio Mixer
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Opens an output device for the software mixer.
+    @param device The device name, either "null" or "wav".
+    @param filename The file to write for the "wav" device.
+    @param sampleRate The output sample rate. Defaults to 44100.
+    @param threaded Whether to mix on a background thread. Defaults to true.
+    @return Returns true if the device was opened.
+    @sa mixerCloseDevice
+*/
+ConsoleFunctionWithDocs(mixerOpenDevice, ConsoleBool, 2, 5, ( device, [filename], [sampleRate], [threaded] ))
+{
+    if ( SoftwareMixer == NULL )
+        return false;
+
+    const char* pFilename = argc > 2 ? argv[2] : NULL;
+    const U32 sampleRate = argc > 3 ? dAtoi(argv[3]) : AudioMixer::DefaultSampleRate;
+    const bool threaded = argc > 4 ? dAtob(argv[4]) : true;
+
+    return SoftwareMixer->openDevice( argv[1], pFilename, sampleRate, threaded );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Closes the software mixer output device.
+    @return No return value.
+    @sa mixerOpenDevice
+*/
+ConsoleFunctionWithDocs(mixerCloseDevice, ConsoleVoid, 1, 1, ())
+{
+    if ( SoftwareMixer != NULL )
+        SoftwareMixer->closeDevice();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Mixes the specified amount of audio on the calling thread.
+    Only valid when the device was opened without a mixer thread.
+    @param seconds The amount of audio to mix.
+    @return Returns true if the audio was mixed.
+*/
+ConsoleFunctionWithDocs(mixerRender, ConsoleBool, 2, 2, ( seconds ))
+{
+    if ( SoftwareMixer == NULL )
+        return false;
+
+    return SoftwareMixer->render( dAtof(argv[1]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Plays an audio asset on the software mixer.
+    @param audio-assetId The audio asset to play.
+    @param priority The voice priority used when choosing which voices are mixed. Defaults to 1.
+    @return Returns a voice handle or 0 if the asset could not be played.
+*/
+ConsoleFunctionWithDocs(mixerPlay, ConsoleInt, 2, 3, ( audio-assetId, [priority] ))
+{
+    if ( SoftwareMixer == NULL )
+        return 0;
+
+    // Fetch asset Id.
+    const char* pAssetId = argv[1];
+
+    // Acquire audio asset.
+    AudioAsset* pAudioAsset = AssetDatabase.acquireAsset<AudioAsset>( pAssetId );
+
+    // Did we get the audio asset?
+    if ( pAudioAsset == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "mixerPlay() - Could not find audio asset '%s'.", pAssetId );
+        return 0;
+    }
+
+    const F32 priority = argc > 2 ? dAtof(argv[2]) : 1.0f;
+    const U32 handle = SoftwareMixer->play( pAudioAsset, priority );
+
+    // Release asset.
+    AssetDatabase.releaseAsset( pAssetId );
+
+    return handle;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Stops a voice on the software mixer.
+    @param handle The voice handle returned by mixerPlay.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(mixerStop, ConsoleVoid, 2, 2, ( handle ))
+{
+    if ( SoftwareMixer != NULL )
+        SoftwareMixer->stop( dAtoi(argv[1]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Stops every voice on the software mixer.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(mixerStopAll, ConsoleVoid, 1, 1, ())
+{
+    if ( SoftwareMixer != NULL )
+        SoftwareMixer->stopAll();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Checks whether a voice is still playing, whether it is being mixed or not.
+    @param handle The voice handle returned by mixerPlay.
+    @return Returns true if the voice is playing.
+*/
+ConsoleFunctionWithDocs(mixerIsPlaying, ConsoleBool, 2, 2, ( handle ))
+{
+    if ( SoftwareMixer == NULL )
+        return false;
+
+    return SoftwareMixer->isPlaying( dAtoi(argv[1]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the volume of a voice.
+    @param handle The voice handle returned by mixerPlay.
+    @param volume The voice volume.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(mixerSetVoiceVolume, ConsoleVoid, 3, 3, ( handle, volume ))
+{
+    if ( SoftwareMixer != NULL )
+        SoftwareMixer->setVoiceVolume( dAtoi(argv[1]), dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the priority of a voice.
+    @param handle The voice handle returned by mixerPlay.
+    @param priority The voice priority.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(mixerSetVoicePriority, ConsoleVoid, 3, 3, ( handle, priority ))
+{
+    if ( SoftwareMixer != NULL )
+        SoftwareMixer->setVoicePriority( dAtoi(argv[1]), dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Places a voice in the world, making it positional.
+    @param handle The voice handle returned by mixerPlay.
+    @param position The voice position as "x y [z]".
+    @param referenceDistance The distance at which attenuation starts. Defaults to 1.
+    @param maxDistance The distance at which the voice is silent. Defaults to 100.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(mixerSetVoicePosition, ConsoleVoid, 3, 5, ( handle, position, [referenceDistance], [maxDistance] ))
+{
+    if ( SoftwareMixer == NULL )
+        return;
+
+    Point3F position( 0.0f, 0.0f, 0.0f );
+    dSscanf( argv[2], "%g %g %g", &position.x, &position.y, &position.z );
+
+    const F32 referenceDistance = argc > 3 ? dAtof(argv[3]) : 1.0f;
+    const F32 maxDistance = argc > 4 ? dAtof(argv[4]) : 100.0f;
+
+    SoftwareMixer->setVoicePosition( dAtoi(argv[1]), position, referenceDistance, maxDistance );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the listener position used to attenuate positional voices.
+    @param position The listener position as "x y [z]".
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(mixerSetListenerPosition, ConsoleVoid, 2, 2, ( position ))
+{
+    if ( SoftwareMixer == NULL )
+        return;
+
+    Point3F position( 0.0f, 0.0f, 0.0f );
+    dSscanf( argv[1], "%g %g %g", &position.x, &position.y, &position.z );
+
+    SoftwareMixer->setListenerPosition( position );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the master volume of the software mixer.
+    @param volume The master volume.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(mixerSetMasterVolume, ConsoleVoid, 2, 2, ( volume ))
+{
+    if ( SoftwareMixer != NULL )
+        SoftwareMixer->setMasterVolume( dAtof(argv[1]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the volume of a mixer volume channel.
+    @param channel The volume channel.
+    @param volume The channel volume.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(mixerSetChannelVolume, ConsoleVoid, 3, 3, ( channel, volume ))
+{
+    if ( SoftwareMixer != NULL )
+        SoftwareMixer->setChannelVolume( dAtoi(argv[1]), dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets how many voices are mixed each block. Quieter, lower priority voices beyond the limit keep their position but are not mixed.
+    @param limit The maximum number of mixed voices.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(mixerSetMixedVoiceLimit, ConsoleVoid, 2, 2, ( limit ))
+{
+    if ( SoftwareMixer != NULL )
+        SoftwareMixer->setMixedVoiceLimit( dAtoi(argv[1]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the software mixer statistics.
+    @return Returns "activeVoices mixedVoices virtualVoices blocksMixed samplesLoaded sampleBytes realTimeFactor simd".
+*/
+ConsoleFunctionWithDocs(mixerGetStats, ConsoleString, 1, 1, ())
+{
+    if ( SoftwareMixer == NULL )
+        return StringTable->EmptyString;
+
+    AudioMixer::Stats stats;
+    SoftwareMixer->getStats( stats );
+
+    char* pBuffer = Con::getReturnBuffer( 128 );
+    dSprintf( pBuffer, 128, "%d %d %d %d %d %d %g %d",
+        stats.mActiveVoices, stats.mMixedVoices, stats.mVirtualVoices, stats.mBlocksMixed,
+        stats.mSamplesLoaded, stats.mSampleBytes, stats.mRealTimeFactor, stats.mSimd );
+
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Frees cached samples that no voice is playing.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(mixerPurgeSamples, ConsoleVoid, 1, 1, ())
+{
+    if ( SoftwareMixer != NULL )
+        SoftwareMixer->purgeSamples();
+}
+
+/*! @} */ // group AudioMixerFunctions
+
+ConsoleFunctionGroupEnd(AudioMixer);
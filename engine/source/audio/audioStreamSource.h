@@ -58,6 +58,9 @@ class AudioStreamSource
         virtual void freeStream() = 0;
       virtual F32 getElapsedTime() = 0;
       virtual F32 getTotalTime() = 0;
+      /// Memory held for decoding and queued in OpenAL
+      virtual U32 getResidentBytes() { return 0; }
+      const char* getFilename() const { return mFilename; }
         //void clear();
 
         AUDIOHANDLE             mHandle;
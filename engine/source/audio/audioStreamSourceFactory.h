@@ -47,6 +47,11 @@ class AudioStreamSourceFactory
 {
 	public:
 		static AudioStreamSource* getNewInstance(const char* filename);
+
+		/// Decode the start of a stream ahead of time. Only compressed streams can be primed.
+		static bool prime(const char* filename);
+		static void unprime(const char* filename);
+		static U32 getPrimedBytes(const char* filename);
 };
 
 #endif // _AUDIOSTREAMSOURCEFACTORY_H_
@@ -0,0 +1,117 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "audio/imaAdpcm.h"
+#include "math/mMathFn.h"
+
+static const S32 sStepTable[89] =
+{
+   7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+   19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+   50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+   130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+   337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+   876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+   2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+   5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+   15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const S32 sIndexTable[16] =
+{
+   -1, -1, -1, -1, 2, 4, 6, 8,
+   -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+struct ChannelState
+{
+   S32 mPredictor;
+   S32 mStepIndex;
+};
+
+static inline S16 decodeNibble(ChannelState &state, U32 nibble)
+{
+   const S32 step = sStepTable[state.mStepIndex];
+
+   S32 diff = step >> 3;
+   if(nibble & 1)
+      diff += step >> 2;
+   if(nibble & 2)
+      diff += step >> 1;
+   if(nibble & 4)
+      diff += step;
+   if(nibble & 8)
+      diff = -diff;
+
+   state.mPredictor = mClamp(state.mPredictor + diff, -32768, 32767);
+   state.mStepIndex = mClamp(state.mStepIndex + sIndexTable[nibble], 0, 88);
+
+   return (S16)state.mPredictor;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ImaAdpcm::getBlockFrames(U32 blockAlign, U32 channels)
+{
+   const U32 headerBytes = 4 * channels;
+   if(channels == 0 || blockAlign < headerBytes)
+      return 0;
+
+   // The header holds the first sample; the rest is 8 samples per 4 bytes per channel
+   return 1 + ((blockAlign - headerBytes) / (4 * channels)) * 8;
+}
+
+U32 ImaAdpcm::decodeBlock(const U8 *block, U32 blockBytes, U32 channels, S16 *out)
+{
+   const U32 frames = getBlockFrames(blockBytes, channels);
+   if(frames == 0 || channels > 2)
+      return 0;
+
+   ChannelState state[2];
+   for(U32 c = 0;c < channels;++c)
+   {
+      const U8 *header = block + c * 4;
+      state[c].mPredictor = (S16)(header[0] | (header[1] << 8));
+      state[c].mStepIndex = mClamp((S32)header[2], 0, 88);
+      out[c] = (S16)state[c].mPredictor;
+   }
+
+   // Each channel stores 4 bytes (8 samples) in turn
+   const U8 *data = block + channels * 4;
+   const U32 groups = (frames - 1) / 8;
+   for(U32 g = 0;g < groups;++g)
+   {
+      for(U32 c = 0;c < channels;++c)
+      {
+         S16 *dst = out + (1 + g * 8) * channels + c;
+         for(U32 i = 0;i < 4;++i)
+         {
+            const U8 byte = *data++;
+            dst[0] = decodeNibble(state[c], byte & 0x0f);
+            dst[channels] = decodeNibble(state[c], byte >> 4);
+            dst += channels * 2;
+         }
+      }
+   }
+
+   return frames;
+}
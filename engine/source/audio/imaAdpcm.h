@@ -0,0 +1,51 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _IMAADPCM_H_
+#define _IMAADPCM_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+/// Decoder for IMA ADPCM as stored in WAV files (format tag 0x0011).
+///
+/// The data is a series of independent blocks, each starting with a
+/// predictor and step index per channel, so decoding can begin at any block.
+/// Every sample takes 4 bits, a quarter of the size of 16-bit PCM.
+namespace ImaAdpcm
+{
+   enum
+   {
+      WAVFormatTag = 0x0011
+   };
+
+   /// Frames in a complete block of the given size
+   U32 getBlockFrames(U32 blockAlign, U32 channels);
+
+   /// Decode one block into interleaved S16. blockBytes may be less than the
+   /// block size for the last block in a file. out must hold
+   /// getBlockFrames(blockBytes, channels) frames. Returns the frames decoded.
+   U32 decodeBlock(const U8 *block, U32 blockBytes, U32 channels, S16 *out);
+}
+
+#endif // _IMAADPCM_H_
@@ -350,3 +350,8 @@ F32 WavStreamSource::getTotalTime()
    Con::warnf( "GetTotalTime not implemented in WaveStreams yet" );
    return -1.f;
 }
+
+U32 WavStreamSource::getResidentBytes()
+{
+   return bBuffersAllocated ? NUMBUFFERS * BUFFERSIZE : 0;
+}
@@ -0,0 +1,230 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _INLINE_VECTOR_H_
+#define _INLINE_VECTOR_H_
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+/// A dynamic array that keeps its first <i>N</i> elements inline.
+///
+/// Intended for short-lived temporaries that usually stay small: no heap
+/// allocation happens until the element count exceeds <i>N</i>, after which
+/// the elements move to the heap and grow geometrically like Vector.
+///
+/// <b>***WARNING***</b>
+///
+/// Like Vector, this template does not construct or destruct its elements
+/// and moves them with dMemcpy.  Only use it for simple structures.
+template<class T, U32 N>
+class InlineVector
+{
+  protected:
+   U32 mElementCount;
+   U32 mArraySize;
+   T*  mArray;
+
+   /// Inline storage, aligned for any of the engine's simple element types.
+   union
+   {
+      U8  mInlineBytes[N * sizeof(T)];
+      F64 mInlineAlignF64;
+      void* mInlineAlignPtr;
+   };
+
+   T* inlineArray() const { return (T*)mInlineBytes; }
+   void grow(U32 ecount);
+
+   /// @deprecated Disallowed.
+   InlineVector(const InlineVector&);
+   InlineVector& operator=(const InlineVector&);
+
+  public:
+   InlineVector();
+   ~InlineVector();
+
+   typedef T        value_type;
+   typedef T*       iterator;
+   typedef const T* const_iterator;
+
+   iterator       begin()       { return mArray; }
+   const_iterator begin() const { return mArray; }
+   iterator       end()         { return mArray + mElementCount; }
+   const_iterator end() const   { return mArray + mElementCount; }
+
+   S32  size() const      { return (S32)mElementCount; }
+   bool empty() const     { return mElementCount == 0; }
+   U32  capacity() const  { return mArraySize; }
+   T*   address() const   { return mArray; }
+
+   /// Whether the elements still live in the inline storage.
+   bool isInline() const  { return mArray == inlineArray(); }
+
+   T&       operator[](U32 index)       { AssertFatal(index < mElementCount, "InlineVector<T,N>::operator[] - out of bounds array access!"); return mArray[index]; }
+   const T& operator[](U32 index) const { AssertFatal(index < mElementCount, "InlineVector<T,N>::operator[] - out of bounds array access!"); return mArray[index]; }
+   T&       operator[](S32 index)       { return operator[](U32(index)); }
+   const T& operator[](S32 index) const { return operator[](U32(index)); }
+
+   T&       first()       { AssertFatal(mElementCount != 0, "InlineVector<T,N>::first - Error, no first element of a zero sized array!"); return mArray[0]; }
+   const T& first() const { AssertFatal(mElementCount != 0, "InlineVector<T,N>::first - Error, no first element of a zero sized array!"); return mArray[0]; }
+   T&       last()        { AssertFatal(mElementCount != 0, "InlineVector<T,N>::last - Error, no last element of a zero sized array!"); return mArray[mElementCount - 1]; }
+   const T& last() const  { AssertFatal(mElementCount != 0, "InlineVector<T,N>::last - Error, no last element of a zero sized array!"); return mArray[mElementCount - 1]; }
+
+   void push_back(const T& x);
+   void pop_back();
+   void increment(U32 delta = 1);
+   void decrement(U32 delta = 1);
+   U32  setSize(U32 size);
+   void reserve(U32 size);
+   void insert(U32 index);
+   void erase(U32 index);
+   void erase_fast(U32 index);
+   void clear() { mElementCount = 0; }
+
+   /// Releases any heap storage and returns to the inline storage.
+   void reset();
+
+   /// Copies the elements into a regular vector.
+   void copyTo(Vector<T>& vector) const;
+};
+
+//-----------------------------------------------------------------------------
+
+template<class T, U32 N> inline InlineVector<T,N>::InlineVector()
+{
+   mElementCount = 0;
+   mArraySize    = N;
+   mArray        = inlineArray();
+}
+
+template<class T, U32 N> inline InlineVector<T,N>::~InlineVector()
+{
+   if (!isInline())
+      dFree(mArray);
+}
+
+template<class T, U32 N> inline void InlineVector<T,N>::grow(U32 ecount)
+{
+   if (ecount <= mArraySize)
+      return;
+
+   U32 target = mArraySize + (mArraySize >> 1);
+   if (target < ecount)
+      target = ecount;
+
+   if (isInline())
+   {
+      T* pArray = (T*)dMalloc(target * sizeof(T));
+      if (mElementCount)
+         dMemcpy(pArray, mArray, mElementCount * sizeof(T));
+      mArray = pArray;
+   }
+   else
+   {
+      mArray = (T*)dRealloc(mArray, target * sizeof(T));
+   }
+
+   mArraySize = target;
+}
+
+template<class T, U32 N> inline void InlineVector<T,N>::push_back(const T& x)
+{
+   if (mElementCount == mArraySize)
+      grow(mElementCount + 1);
+   dMemcpy(&mArray[mElementCount++], &x, sizeof(T));
+}
+
+template<class T, U32 N> inline void InlineVector<T,N>::pop_back()
+{
+   AssertFatal(mElementCount != 0, "InlineVector<T,N>::pop_back - cannot pop the back of a zero-length vector.");
+   mElementCount--;
+}
+
+template<class T, U32 N> inline void InlineVector<T,N>::increment(U32 delta)
+{
+   grow(mElementCount + delta);
+   mElementCount += delta;
+}
+
+template<class T, U32 N> inline void InlineVector<T,N>::decrement(U32 delta)
+{
+   mElementCount = mElementCount > delta ? mElementCount - delta : 0;
+}
+
+template<class T, U32 N> inline U32 InlineVector<T,N>::setSize(U32 size)
+{
+   grow(size);
+   mElementCount = size;
+   return mElementCount;
+}
+
+template<class T, U32 N> inline void InlineVector<T,N>::reserve(U32 size)
+{
+   grow(size);
+}
+
+template<class T, U32 N> inline void InlineVector<T,N>::insert(U32 index)
+{
+   AssertFatal(index <= mElementCount, "InlineVector<T,N>::insert - out of bounds index!");
+   increment();
+   dMemmove(&mArray[index + 1], &mArray[index], (mElementCount - index - 1) * sizeof(T));
+}
+
+template<class T, U32 N> inline void InlineVector<T,N>::erase(U32 index)
+{
+   AssertFatal(index < mElementCount, "InlineVector<T,N>::erase - out of bounds index!");
+   if (index < (mElementCount - 1))
+      dMemmove(&mArray[index], &mArray[index + 1], (mElementCount - index - 1) * sizeof(T));
+   mElementCount--;
+}
+
+template<class T, U32 N> inline void InlineVector<T,N>::erase_fast(U32 index)
+{
+   AssertFatal(index < mElementCount, "InlineVector<T,N>::erase_fast - out of bounds index.");
+
+   // CAUTION: this does NOT maintain list order.
+   if (index < (mElementCount - 1))
+      dMemcpy(&mArray[index], &mArray[mElementCount - 1], sizeof(T));
+   mElementCount--;
+}
+
+template<class T, U32 N> inline void InlineVector<T,N>::reset()
+{
+   if (!isInline())
+      dFree(mArray);
+
+   mElementCount = 0;
+   mArraySize    = N;
+   mArray        = inlineArray();
+}
+
+template<class T, U32 N> inline void InlineVector<T,N>::copyTo(Vector<T>& vector) const
+{
+   vector.setSize(mElementCount);
+   if (mElementCount)
+      dMemcpy(vector.address(), mArray, mElementCount * sizeof(T));
+}
+
+#endif // _INLINE_VECTOR_H_
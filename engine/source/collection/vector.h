@@ -33,6 +33,15 @@
 /// Size of memory blocks to allocate at a time for vectors.
 const static S32 VectorBlockSize = 16;
 
+/// How a vector grows its capacity when an append overflows it.
+enum VectorGrowthPolicy
+{
+   /// Grow to the next VectorBlockSize boundary only.
+   VectorGrowLinear,
+   /// Grow by half the current capacity (at least to the next block boundary).
+   VectorGrowGeometric
+};
+
 #ifdef TORQUE_DEBUG
 extern bool VectorResize(U32 *aSize, U32 *aCount, void **arrayPtr, U32 newCount, U32 elemSize,
                          const char* fileName,
@@ -73,6 +82,7 @@ class Vector
    U32 mElementCount;
    U32 mArraySize;
    T*  mArray;
+   VectorGrowthPolicy mGrowthPolicy;
 
 #ifdef TORQUE_DEBUG
    const char* mFileAssociation;
@@ -80,6 +90,7 @@ class Vector
 #endif
 
    bool  resize(U32); // resizes, but does no construction/destruction
+   void  grow(U32);   ///< Sets the element count, growing the capacity by the growth policy.
    void  destroy(U32 start, U32 end);   ///< Destructs elements from <i>start</i> to <i>end-1</i>
    void  construct(U32 start, U32 end); ///< Constructs elements from <i>start</i> to <i>end-1</i>
    void  construct(U32 start, U32 end, const T* array);
@@ -147,6 +158,9 @@ class Vector
    void reserve(U32);
    U32 capacity() const;
 
+   void setGrowthPolicy(const VectorGrowthPolicy policy) { mGrowthPolicy = policy; }
+   VectorGrowthPolicy getGrowthPolicy() const            { return mGrowthPolicy; }
+
    /// @}
 
    /// @name Extended interface
@@ -192,6 +206,7 @@ template<class T> inline Vector<T>::Vector(const U32 initialSize)
    mArray        = 0;
    mElementCount = 0;
    mArraySize    = 0;
+   mGrowthPolicy = VectorGrowGeometric;
    if(initialSize)
       reserve(initialSize);
 }
@@ -213,6 +228,7 @@ template<class T> inline Vector<T>::Vector(const U32 initialSize,
    mArray        = 0;
    mElementCount = 0;
    mArraySize    = 0;
+   mGrowthPolicy = VectorGrowGeometric;
    if(initialSize)
       reserve(initialSize);
 }
@@ -231,6 +247,7 @@ template<class T> inline Vector<T>::Vector(const char* fileName,
    mArray        = 0;
    mElementCount = 0;
    mArraySize    = 0;
+   mGrowthPolicy = VectorGrowGeometric;
 }
 
 template<class T> inline Vector<T>::Vector(const Vector& p)
@@ -241,6 +258,7 @@ template<class T> inline Vector<T>::Vector(const Vector& p)
 #endif
 
    mArray = 0;
+   mGrowthPolicy = p.mGrowthPolicy;
    resize(p.mElementCount);
    if (p.mElementCount)
       dMemcpy(mArray,p.mArray,mElementCount * sizeof(value_type));
@@ -306,7 +324,7 @@ template<class T> inline void Vector<T>::increment( U32 delta)
 {
     U32 count = mElementCount;
     if ((mElementCount += delta) > mArraySize)
-        resize(mElementCount);
+        grow(mElementCount);
     construct(count, mElementCount);
 }
 
@@ -314,7 +332,7 @@ template<class T> inline void Vector<T>::increment(const T* array, U32 delta)
 {
    U32 count = mElementCount;
    if ((mElementCount += delta) > mArraySize)
-      resize(mElementCount);
+      grow(mElementCount);
     construct(count, mElementCount, array);
 }
 
@@ -624,13 +642,35 @@ template<class T> inline bool Vector<T>::resize(U32 ecount)
 #endif
 }
 
+template<class T> inline void Vector<T>::grow(U32 ecount)
+{
+   if (ecount <= mArraySize)
+   {
+      mElementCount = ecount;
+      return;
+   }
+
+   // Linear growth leaves the block rounding to VectorResize; geometric growth
+   // keeps repeated appends amortized O(1) instead of copying every block.
+   U32 target = ecount;
+   if (mGrowthPolicy == VectorGrowGeometric)
+   {
+      const U32 geometric = mArraySize + (mArraySize >> 1);
+      if (geometric > target)
+         target = geometric;
+   }
+
+   if (resize(target))
+      mElementCount = ecount;
+}
+
 template<class T> inline void Vector<T>::merge(const Vector& p)
 {
    if (!p.size())
       return;
 
    const S32 oldsize = size();
-   resize(oldsize + p.size());
+   grow(oldsize + p.size());
    dMemcpy( &mArray[oldsize], p.address(), p.size() * sizeof(T) );
 }
 
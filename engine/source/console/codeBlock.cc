@@ -24,6 +24,7 @@
 #include "console/codeBlock.h"
 #include "io/resource/resourceManager.h"
 #include "math/mMath.h"
+#include "algorithm/crc.h"
 
 #include "debug/telnetDebugger.h"
 
@@ -348,6 +349,87 @@ void CodeBlock::calcBreakList()
        pRemoteDebugger->addCodeBlock( this );
 }
 
+// Decodes compiled data from memory.
+// Any read past the end of the data fails the reader rather than the process.
+struct CodeReader
+{
+   const U8* mpRead;
+   const U8* mpEnd;
+   bool      mValid;
+
+   CodeReader(const U8* pData, const U32 dataSize) : mpRead(pData), mpEnd(pData + dataSize), mValid(true) {}
+
+   inline U32 getRemaining() const { return (U32)(mpEnd - mpRead); }
+
+   inline bool canRead(const U32 bytes)
+   {
+      if(mValid && bytes <= getRemaining())
+         return true;
+
+      mValid = false;
+      return false;
+   }
+
+   inline U8 readU8()
+   {
+      if(!canRead(1))
+         return 0;
+
+      return *mpRead++;
+   }
+
+   inline U32 readU32()
+   {
+      U32 value = 0;
+      if(canRead(sizeof(value)))
+      {
+         dMemcpy(&value, mpRead, sizeof(value));
+         mpRead += sizeof(value);
+      }
+      return convertLEndianToHost(value);
+   }
+
+   inline F64 readF64()
+   {
+      F64 value = 0.0;
+      if(canRead(sizeof(value)))
+      {
+         dMemcpy(&value, mpRead, sizeof(value));
+         mpRead += sizeof(value);
+      }
+      return convertLEndianToHost(value);
+   }
+
+   // Reads a string table, forcing it to be terminated.
+   char* readStrings(const U32 size)
+   {
+      if(size == 0 || !canRead(size))
+         return NULL;
+
+      char* pStrings = new char[size];
+      dMemcpy(pStrings, mpRead, size);
+      pStrings[size - 1] = 0;
+      mpRead += size;
+      return pStrings;
+   }
+
+   // Reads a float table.
+   F64* readFloats(const U32 count)
+   {
+      if(count == 0 || count > getRemaining() / sizeof(F64))
+      {
+         if(count != 0)
+            mValid = false;
+         return NULL;
+      }
+
+      F64* pFloats = new F64[count];
+      for(U32 i = 0; i < count; i++)
+         pFloats[i] = readF64();
+      return pFloats;
+   }
+};
+
 bool CodeBlock::read(StringTableEntry fileName, Stream &st)
 {
    const StringTableEntry exePath = Platform::getMainDotCsDir();
@@ -391,75 +473,81 @@ bool CodeBlock::read(StringTableEntry fileName, Stream &st)
    //
    addToCodeList();
 
-   U32 globalSize,size,i;
-   st.read(&size);
-   if(size)
+   // Read the remainder of the stream in a single block and decode from memory.
+   const U32 dataSize = st.getStreamSize() - st.getPosition();
+   U8* pData = new U8[dataSize];
+   if(!st.read(dataSize, pData))
    {
-      globalSize = size;
-      globalStrings = new char[size];
-      st.read(size, globalStrings);
-   }
-   st.read(&size);
-   if(size)
-   {
-      functionStrings = new char[size];
-      st.read(size, functionStrings);
-   }
-   st.read(&size);
-   if(size)
-   {
-      globalFloats = new F64[size];
-      for(U32 i = 0; i < size; i++)
-         st.read(&globalFloats[i]);
-   }
-   st.read(&size);
-   if(size)
-   {
-      functionFloats = new F64[size];
-      for(U32 i = 0; i < size; i++)
-         st.read(&functionFloats[i]);
+      delete [] pData;
+      return false;
    }
-   U32 codeSize;
-   st.read(&codeSize);
-   st.read(&lineBreakPairCount);
 
-   U32 totSize = codeSize + lineBreakPairCount * 2;
-   code = new U32[totSize];
+   CodeReader reader(pData, dataSize);
 
-   for(i = 0; i < codeSize; i++)
+   U32 globalSize = 0,size,i;
+   size = reader.readU32();
+   globalStrings = reader.readStrings(size);
+   if(globalStrings)
+      globalSize = size;
+   functionStrings = reader.readStrings(reader.readU32());
+   globalFloats = reader.readFloats(reader.readU32());
+   functionFloats = reader.readFloats(reader.readU32());
+   U32 codeSize = reader.readU32();
+   lineBreakPairCount = reader.readU32();
+
+   // Every code word takes at least one byte and every line break pair eight.
+   // NOTE: This bounds the allocation before anything is decoded.
+   if(codeSize > reader.getRemaining() || lineBreakPairCount > (reader.getRemaining() - codeSize) / 8)
+      reader.mValid = false;
+
+   if(reader.mValid)
    {
-      U8 b;
-      st.read(&b);
-      if(b == 0xFF)
-         st.read(&code[i]);
-      else
-         code[i] = b;
-   }
+      U32 totSize = codeSize + lineBreakPairCount * 2;
+      code = new U32[totSize];
 
-   for(i = codeSize; i < totSize; i++)
-      st.read(&code[i]);
+      for(i = 0; i < codeSize && reader.mValid; i++)
+      {
+         const U8 b = reader.readU8();
+         if(b == 0xFF)
+            code[i] = reader.readU32();
+         else
+            code[i] = b;
+      }
 
-   lineBreakPairs = code + codeSize;
+      for(i = codeSize; i < totSize && reader.mValid; i++)
+         code[i] = reader.readU32();
+
+      lineBreakPairs = code + codeSize;
+   }
 
    // StringTable-ize our identifiers.
-   U32 identCount;
-   st.read(&identCount);
-   while(identCount--)
+#ifdef TORQUE_64
+   const U32 identWords = 2;
+#else
+   const U32 identWords = 1;
+#endif
+   U32 identCount = reader.readU32();
+   while(identCount-- && reader.mValid)
    {
-      U32 offset;
-      st.read(&offset);
+      U32 offset = reader.readU32();
       StringTableEntry ste;
       if(offset < globalSize)
          ste = StringTable->insert(globalStrings + offset);
       else
          ste = StringTable->EmptyString;
       
-      U32 count;
-      st.read(&count);
-      while(count--)
+      U32 count = reader.readU32();
+      while(count-- && reader.mValid)
       {
-         U32 ip;
-         st.read(&ip);
+         U32 ip = reader.readU32();
+
+         // Fail if the fixup lies outside of the code.
+         if(ip > codeSize || codeSize - ip < identWords)
+         {
+            reader.mValid = false;
+            break;
+         }
+
 #ifdef TORQUE_64
          *(U64*)(code+ip) = (U64)ste;
 #else
@@ -468,6 +556,17 @@ bool CodeBlock::read(StringTableEntry fileName, Stream &st)
       }
    }
 
+   delete [] pData;
+
+   // Fail cleanly if the compiled data was truncated or corrupt.
+   if(!reader.mValid)
+   {
+      Con::errorf("CodeBlock::read - '%s' is truncated or corrupt.", fileName ? fileName : "<unnamed>");
+      lineBreakPairCount = 0;
+      lineBreakPairs = NULL;
+      return false;
+   }
+
    if(lineBreakPairCount)
       calcBreakList();
 
@@ -505,6 +604,11 @@ bool CodeBlock::compile(const char *codeFileName, StringTableEntry fileName, con
       return false;
    st.write(DSO_VERSION);
 
+   // Write the source size and content hash used to detect stale DSOs.
+   const U32 scriptSize = dStrlen(script);
+   st.write(scriptSize);
+   st.write(calculateCRC(script, scriptSize));
+
    // Reset all our value tables...
    resetTables();
 
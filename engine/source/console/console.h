@@ -202,7 +202,9 @@ namespace Con
       //  02/16/07 - PAUP - 41->42 DSOs are read with a pointer before every string(ASTnodes changed). Namespace and HashTable revamped
       //  05/17/10 - Luma - 42-43 Adding proper sceneObject physics flags, fixes in general
       //  02/07/13 - JU   - 43->44 Expanded the width of stringtable entries to  64bits 
-      DSOVersion = 44,
+      //  10/19/26 - 44->45 Added the source content hash to the DSO header
+      //  10/19/26 - 45->46 Added the source size to the DSO header
+      DSOVersion = 46,
       MaxLineLength = 512,  ///< Maximum length of a line of console input.
       MaxDataTypes = 256    ///< Maximum number of registered data types.
    };
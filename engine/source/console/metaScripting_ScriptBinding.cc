@@ -27,6 +27,7 @@
 #include "io/resource/resourceManager.h"
 #include "io/fileStream.h"
 #include "console/compiler.h"
+#include "algorithm/crc.h"
 
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_OSX)
 #include <ifaddrs.h>
@@ -394,7 +395,6 @@ ConsoleFunctionWithDocs(exec, ConsoleBool, 2, 4, ( fileName, [nocalls]?, [journa
    U32 version;
 
    Stream *compiledStream = NULL;
-   FileTime comModifyTime, scrModifyTime;
 
    // Check here for .edso
    //bool edso = false;
@@ -426,11 +426,6 @@ ConsoleFunctionWithDocs(exec, ConsoleBool, 2, 4, ( fileName, [nocalls]?, [journa
          dStrcpyl(nameBuffer, sizeof(nameBuffer), pathAndFilename, ".dso", NULL);
 
       rCom = ResourceManager->find(nameBuffer);
-
-      if(rCom)
-         rCom->getFileTimes(NULL, &comModifyTime);
-      if(rScr)
-         rScr->getFileTimes(NULL, &scrModifyTime);
    }
 
    // Let's do a sanity check to complain about DSOs in the future.
@@ -444,7 +439,9 @@ ConsoleFunctionWithDocs(exec, ConsoleBool, 2, 4, ( fileName, [nocalls]?, [journa
    //}
 
     // If we had a DSO, let's check to see if we should be reading from it.
-    if((compiled && rCom) && (!rScr || Platform::compareFileTimes(comModifyTime, scrModifyTime) >= 0))
+    // NOTE: A DSO that is newer than the source and matches its size is used as is.
+    //       Otherwise the DSO is validated against the content hash of the source so touched but unchanged sources are not recompiled.
+    if(compiled && rCom)
     {
       compiledStream = ResourceManager->openStream(nameBuffer);
       if (compiledStream)
@@ -457,6 +454,41 @@ ConsoleFunctionWithDocs(exec, ConsoleBool, 2, 4, ( fileName, [nocalls]?, [journa
             ResourceManager->closeStream(compiledStream);
             compiledStream = NULL;
          }
+         else
+         {
+            // Read the source size and content hash.
+            U32 sourceSize, sourceCRC;
+            compiledStream->read(&sourceSize);
+            compiledStream->read(&sourceCRC);
+
+            // Is the source available and possibly changed since the DSO was compiled?
+            FileTime comModifyTime, scrModifyTime;
+            if(rScr)
+            {
+               rCom->getFileTimes(NULL, &comModifyTime);
+               rScr->getFileTimes(NULL, &scrModifyTime);
+            }
+            if(rScr && ((U32)rScr->fileSize != sourceSize || Platform::compareFileTimes(comModifyTime, scrModifyTime) < 0))
+            {
+               // Yes, so read it.
+               Stream *s = ResourceManager->openStream(scriptFileName);
+               if(s)
+               {
+                  scriptSize = ResourceManager->getSize(scriptFileName);
+                  script = new char [scriptSize+1];
+                  s->read(scriptSize, script);
+                  ResourceManager->closeStream(s);
+                  script[scriptSize] = 0;
+               }
+
+               // Ignore the DSO if the source has changed.
+               if(script == NULL || (U32)rScr->fileSize != sourceSize || calculateCRC(script, dStrlen(script)) != sourceCRC)
+               {
+                  ResourceManager->closeStream(compiledStream);
+                  compiledStream = NULL;
+               }
+            }
+         }
       }
     }
 
@@ -472,30 +504,33 @@ ConsoleFunctionWithDocs(exec, ConsoleBool, 2, 4, ( fileName, [nocalls]?, [journa
       // (and journal as we do so, if that's required).
 
        //Con::errorf( "No DSO found! : %s", scriptFileName );
-       
-      Stream *s = ResourceManager->openStream(scriptFileName);
-       
-#ifdef	TORQUE_ALLOW_JOURNALING
-      if(journal && Game->isJournalWriting())
-         Game->getJournalStream()->write(bool(s != NULL));
-#endif	//TORQUE_ALLOW_JOURNALING
 
-      if(s)
+      // Read the source if the DSO check didn't already.
+      if(script == NULL)
       {
-         scriptSize = ResourceManager->getSize(scriptFileName);
-         script = new char [scriptSize+1];
-         s->read(scriptSize, script);
+         Stream *s = ResourceManager->openStream(scriptFileName);
+
+         if(s)
+         {
+            scriptSize = ResourceManager->getSize(scriptFileName);
+            script = new char [scriptSize+1];
+            s->read(scriptSize, script);
+            ResourceManager->closeStream(s);
+            script[scriptSize] = 0;
+         }
+      }
 
 #ifdef	TORQUE_ALLOW_JOURNALING
-         if(journal && Game->isJournalWriting())
+      if(journal && Game->isJournalWriting())
+      {
+         Game->getJournalStream()->write(bool(script != NULL));
+         if(script != NULL)
          {
             Game->journalWrite(scriptSize);
             Game->journalWrite(scriptSize, script);
          }
-#endif	//TORQUE_ALLOW_JOURNALING
-         ResourceManager->closeStream(s);
-         script[scriptSize] = 0;
       }
+#endif	//TORQUE_ALLOW_JOURNALING
 
       if (!scriptSize || !script)
       {
@@ -528,7 +563,10 @@ ConsoleFunctionWithDocs(exec, ConsoleBool, 2, 4, ( fileName, [nocalls]?, [journa
          compiledStream = ResourceManager->openStream(nameBuffer);
          if(compiledStream)
          {
+            U32 sourceSize, sourceCRC;
             compiledStream->read(&version);
+            compiledStream->read(&sourceSize);
+            compiledStream->read(&sourceCRC);
          }
          else
          {
@@ -561,8 +599,18 @@ ConsoleFunctionWithDocs(exec, ConsoleBool, 2, 4, ( fileName, [nocalls]?, [journa
       F32 st1 = (F32)Platform::getRealMilliseconds();
 
       CodeBlock *code = new CodeBlock;
-      code->read(scriptFileName, *compiledStream);
+      const bool codeRead = code->read(scriptFileName, *compiledStream);
       ResourceManager->closeStream(compiledStream);
+
+      // Fail if the DSO could not be decoded.
+      if(!codeRead)
+      {
+         delete code;
+         Con::errorf(ConsoleLogEntry::Script, "exec: invalid compiled script %s.", nameBuffer);
+         execDepth--;
+         return false;
+      }
+
       code->exec(0, scriptFileName, NULL, 0, NULL, noCalls, NULL, 0);
 
         F32 et1 = (F32)Platform::getRealMilliseconds();
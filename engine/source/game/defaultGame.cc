@@ -33,6 +33,7 @@
 #include "math/mMath.h"
 #include "graphics/dgl.h"
 #include "graphics/gBitmap.h"
+#include "graphics/gFont.h"
 #include "io/resource/resourceManager.h"
 #include "io/fileStream.h"
 #include "graphics/TextureManager.h"
@@ -44,6 +45,8 @@
 #include "io/bitStream.h"
 #include "network/telnetConsole.h"
 #include "debug/telnetDebugger.h"
+#include "io/asyncFileIO.h"
+#include "audio/audioMixer.h"
 #include "console/consoleTypes.h"
 #include "math/mathTypes.h"
 #include "graphics/TextureManager.h"
@@ -58,6 +61,8 @@
 #include "platform/nativeDialogs/msgBox.h"
 #include "platform/nativeDialogs/fileDialog.h"
 #include "memory/safeDelete.h"
+#include "io/zip/zipParallelWriter.h"
+#include "testing/benchmark.h"
 
 #include <stdio.h>
 
@@ -156,6 +161,8 @@ bool initializeLibraries()
    
     TelnetConsole::create();
     TelnetDebugger::create();
+    AsyncFileIO::create();
+    AudioMixer::create();
 
     Processor::init();
     Math::init();
@@ -182,6 +189,8 @@ void shutdownLibraries()
 
     TelnetDebugger::destroy();
     TelnetConsole::destroy();
+    AsyncFileIO::destroy();
+    AudioMixer::destroy();
 
     Sim::shutdown();
     Platform::shutdown();
@@ -190,6 +199,7 @@ void shutdownLibraries()
     Con::shutdown();
 
     ResManager::destroy();
+    GFont::destroyGlyphAtlas();
     TextureManager::destroy();
 
     // Destroy the stock colors.
@@ -248,6 +258,15 @@ bool initializeGame(int argc, const char **argv)
         argc -= 2;
     }
 
+    // Build module zips and quit without running any script.
+    if(argc > 3 && dStricmp(argv[1], "-packModules") == 0)
+    {
+        const U32 written = Zip::ZipParallelWriter::packModules(argv[2], argv[3], argc > 4 ? dAtoi(argv[4]) : 4);
+        Con::printf("Packed %d module(s) from %s to %s.", written, argv[2], argv[3]);
+        Platform::postQuitMessage(written ? 0 : 1);
+        return true;
+    }
+
     // Scan executable location and all sub-directories.
     ResourceManager->setWriteablePath(Platform::getCurrentDirectory());
     ResourceManager->addPath( Platform::getCurrentDirectory() );
@@ -316,6 +335,23 @@ bool initializeGame(int argc, const char **argv)
         return false;
     }
 
+#if !defined(TORQUE_SHIPPING) && !defined(TORQUE_OS_IOS) && !defined(TORQUE_OS_ANDROID)
+    // Run the benchmarks once the root script has loaded its modules and quit.
+    if(argc > 1 && dStricmp(argv[1], "-benchmark") == 0)
+    {
+        BenchmarkRunner runner;
+        runner.setFilter(argc > 2 ? argv[2] : NULL);
+        const U32 count = runner.run();
+        if(argc > 3)
+        {
+            char jsonPath[1024];
+            Platform::makeFullPathName(argv[3], jsonPath, sizeof(jsonPath));
+            runner.writeJson(jsonPath);
+        }
+        Platform::postQuitMessage(count && runner.getFailureCount() == 0 ? 0 : 1);
+    }
+#endif
+
     return true;
 }
 
@@ -342,8 +378,24 @@ void shutdownGame()
 
 bool DefaultGame::mainInitialize(int argc, const char **argv)
 {
+#ifdef DEDICATED
+    // Dedicated builds have no renderer to fall back on.
+    setHeadless( true );
+#endif
+
+    // Headless must be known before the libraries start loading anything.
+    for (S32 i = 1; i < argc; i++)
+    {
+        if (dStricmp(argv[i], "-headless") == 0)
+            setHeadless( true );
+    }
+
     if(!initializeLibraries())
         return false;
+
+    // Nothing is rendered when headless so never create GL textures.
+    if ( isHeadless() )
+        TextureManager::mDGLRender = false;
     
 #ifdef TORQUE_OS_EMSCRIPTEN
     // temp hack
@@ -475,6 +527,9 @@ void DefaultGame::mainLoop( void )
          PROFILE_END();
          PROFILE_START(TelDebuggerProcessMain);
    TelDebugger->process();
+         PROFILE_END();
+         PROFILE_START(AsyncIOProcessMain);
+   AsyncIO->process();  // deliver finished background reads
          PROFILE_END();
          PROFILE_START(TimeManagerProcessMain);
    TimeManager::process(); // guaranteed to produce an event
@@ -524,7 +579,7 @@ void DefaultGame::gameReactivate( void )
    if ( !Input::isActive() )
       Input::reactivate();
 
-   TextureManager::mDGLRender = true;
+   TextureManager::mDGLRender = !isHeadless();
    if ( Canvas )
       Canvas->resetUpdateRegions();
 }
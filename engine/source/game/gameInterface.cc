@@ -54,6 +54,7 @@ GameInterface::GameInterface()
    mJournalMode = JournalOff;
    mRunning = true;
    mRequiresRestart = false;
+   mHeadless = false;
    if(!gGameEventQueueMutex)
       gGameEventQueueMutex = Mutex::createMutex();
    eventQueue = &eventQueue1;
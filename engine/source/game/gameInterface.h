@@ -40,6 +40,7 @@ private:
    bool mRunning;
    bool mJournalBreak;
    bool mRequiresRestart;
+   bool mHeadless;
 
    /// Events are stored here by any thread, for processing by the main thread.
    Vector<Event*> eventQueue1, eventQueue2, *eventQueue;
@@ -97,6 +98,18 @@ public:
    inline bool requiresRestart( void ) const { return mRequiresRestart; }
    /// @}
 
+   /// @name Headless
+   ///
+   /// A headless game runs the simulation without a window, GL context or
+   /// audio device.  Scenes, physics, world queries and script all run but
+   /// bitmap textures are registered with only their dimensions, fonts keep
+   /// only their glyph metrics and audio is never decoded.  Set with the
+   /// "-headless" command argument before the libraries are initialized.
+   /// @{
+   inline void setHeadless( const bool headless ) { mHeadless = headless; }
+   inline bool isHeadless( void ) const { return mHeadless; }
+   /// @}
+
    /// @name Journaling
    ///
    /// Journaling is used in order to make a "demo" of the actual game.  It logs
@@ -46,3 +46,12 @@ ConsoleFunctionWithDocs( playJournal, ConsoleVoid, 2, 3, ( namedFile , doBreak )
 }
 
 #endif //TORQUE_ALLOW_JOURNALING
+
+/*! Use the isHeadless function to check whether the game is running without a window, GL context or audio device.
+    Headless games are started with the -headless command argument and are intended for dedicated simulation servers.
+    @return Returns true if the game is headless, false otherwise.
+*/
+ConsoleFunctionWithDocs( isHeadless, ConsoleBool, 1, 1, ())
+{
+   return Game->isHeadless();
+}
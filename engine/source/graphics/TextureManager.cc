@@ -33,6 +33,7 @@
 #include "console/consoleTypes.h"
 #include "memory/safeDelete.h"
 #include "math/mMath.h"
+#include "game/gameInterface.h"
 
 #include "TextureManager_ScriptBinding.h"
 
@@ -723,6 +724,15 @@ void TextureManager::refresh( const char *textureName )
     if ( pTextureObject->getHandleType() == TextureHandle::BitmapKeepTexture )
         return;
 
+    // Metadata-only textures just re-read their dimensions.
+    if ( pTextureObject->mGLTextureName == 0 && pTextureObject->mpBitmap == NULL && Game->isHeadless() )
+    {
+        U32 width, height;
+        if ( loadBitmapSize( pTextureObject->mTextureKey, width, height ) )
+            registerTextureSize( pTextureObject->mTextureKey, width, height, pTextureObject->mHandleType, pTextureObject->mClamp );
+        return;
+    }
+
     // Load the bitmap.
     GBitmap* pBitmap = loadBitmap( pTextureObject->mTextureKey );
 
@@ -869,6 +879,15 @@ TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandl
 
     TextureObject *ret = TextureDictionary::find(textureKey, type, clampToEdge);
 
+    // Headless simulations only need the dimensions of a bitmap texture so read
+    // them from the image header and leave the pixels on disk.
+    if ( ret == NULL && type == TextureHandle::BitmapTexture && Game->isHeadless() )
+    {
+        U32 width, height;
+        if ( loadBitmapSize( textureKey, width, height ) )
+            return registerTextureSize( textureKey, width, height, type, clampToEdge );
+    }
+
     GBitmap *bmp = NULL;
 
     if( ret == NULL )
@@ -940,12 +959,90 @@ GBitmap *TextureManager::loadBitmap( const char* pTextureKey, bool recurse, bool
 
 //--------------------------------------------------------------------------------------------------------------------
 
+bool TextureManager::loadBitmapSize( const char* pTextureKey, U32& outWidth, U32& outHeight )
+{
+    char fileNameBuffer[512];
+    Con::expandPath( fileNameBuffer, sizeof(fileNameBuffer), pTextureKey );
+
+    // Loop through the supported extensions to find the file.
+    const U32 len = dStrlen(fileNameBuffer);
+    for (U32 i = 0; i < EXT_ARRAY_SIZE; i++)
+    {
+        dStrcpy(fileNameBuffer + len, extArray[i]);
+
+        // Only formats with a header reader can be sized without decoding.
+        const char* pExtension = dStrrchr( fileNameBuffer, '.' );
+        if ( pExtension == NULL )
+            continue;
+
+        const bool isPNG = dStricmp( pExtension, ".png" ) == 0;
+        const bool isJPEG = dStricmp( pExtension, ".jpg" ) == 0 || dStricmp( pExtension, ".jpeg" ) == 0;
+        if ( !isPNG && !isJPEG )
+            continue;
+
+        Stream* pStream = ResourceManager->openStream( fileNameBuffer );
+        if ( pStream == NULL )
+            continue;
+
+        const bool sized = isPNG ? GBitmap::readPNGSize( *pStream, outWidth, outHeight ) : GBitmap::readJPEGSize( *pStream, outWidth, outHeight );
+        ResourceManager->closeStream( pStream );
+
+        if ( !sized )
+            return false;
+
+        if ( outWidth > MaximumProductSupportedTextureWidth || outHeight > MaximumProductSupportedTextureHeight )
+        {
+            Con::warnf( "TextureManager::loadBitmapSize() - Cannot load bitmap '%s' as its dimensions exceed the maximum product-supported texture dimension.", fileNameBuffer );
+            return false;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+TextureObject* TextureManager::registerTextureSize( const char* pTextureKey, const U32 width, const U32 height, TextureHandle::TextureHandleType type, bool clampToEdge )
+{
+    // Sanity!
+    AssertISV( type == TextureHandle::BitmapTexture, "Only bitmap textures can be registered without a bitmap." );
+
+    // Fetch texture key.
+    StringTableEntry textureKey = StringTable->insert(pTextureKey);
+
+    TextureObject* pTextureObject = TextureDictionary::find(textureKey, type, clampToEdge);
+
+    if ( pTextureObject == NULL )
+    {
+        // Create new texture object.
+        pTextureObject = new TextureObject();
+        pTextureObject->mTextureKey = textureKey;
+        pTextureObject->mHandleType = type;
+
+        TextureDictionary::insert(pTextureObject);
+    }
+
+    // No bitmap or GL texture is held, only the dimensions.
+    pTextureObject->mBitmapWidth       = width;
+    pTextureObject->mBitmapHeight      = height;
+    pTextureObject->mTextureWidth      = getNextPow2(width);
+    pTextureObject->mTextureHeight     = getNextPow2(height);
+    pTextureObject->mClamp             = clampToEdge;
+
+    return pTextureObject;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
 void TextureManager::dumpMetrics( void )
 {
     S32 textureResidentCount = 0;
     S32 textureResidentSize = 0;
     S32 textureResidentWasteSize = 0;
     S32 bitmapResidentSize = 0;
+    S32 sizeOnlyCount = 0;
 
     Con::printSeparator();
     Con::printBlankLine();
@@ -960,6 +1057,11 @@ void TextureManager::dumpMetrics( void )
             textureResidentCount++;
             glAreTexturesResident( 1, &pProbe->mGLTextureName, &isTextureResident );
         }
+        else if ( pProbe->mpBitmap == NULL )
+        {
+            // Headless textures hold only their dimensions.
+            sizeOnlyCount++;
+        }
 
         textureResidentSize += pProbe->mTextureResidentSize;
         bitmapResidentSize += pProbe->mBitmapResidentSize;
@@ -989,11 +1091,12 @@ void TextureManager::dumpMetrics( void )
 
     // Info.
     Con::printf( "Metrics Totals:" );
-    Con::printf( "TextureCount: %d, TextureSize: %d, TextureWasteSize: %d, BitmapSize: %d, ResidentFraction: %g",
+    Con::printf( "TextureCount: %d, TextureSize: %d, TextureWasteSize: %d, BitmapSize: %d, SizeOnlyCount: %d, ResidentFraction: %g",
         mTextureResidentCount,
         mTextureResidentSize,
         mTextureResidentWasteSize,
         mBitmapResidentSize,
+        sizeOnlyCount,
         getResidentFraction() );
 
     Con::printBlankLine();
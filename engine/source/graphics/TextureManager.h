@@ -116,6 +116,8 @@ private:
     static void refresh(TextureObject* pTextureObject);
 
     static GBitmap* loadBitmap(const char *textureName, bool recurse = true, bool nocompression = false);
+    static bool loadBitmapSize(const char *textureName, U32& outWidth, U32& outHeight);
+    static TextureObject* registerTextureSize(const char *textureName, const U32 width, const U32 height, TextureHandle::TextureHandleType type, bool clampToEdge);
     static GBitmap* createPowerOfTwoBitmap( GBitmap* pBitmap );
     static U16* create16BitBitmap( GBitmap *pDL, U8 *in_source8, GBitmap::BitmapFormat alpha_info, GLint *GLformat, GLint *GLdata_type, U32 width, U32 height );
     static void getSourceDestByteFormat(GBitmap *pBitmap, U32 *sourceFormat, U32 *destFormat, U32 *byteFormat, U32* texelSize);
@@ -148,6 +148,33 @@ bool GBitmap::readJPEG(Stream &stream)
 }
 
 
+//--------------------------------------------------------------------------
+// Reads the image dimensions from the frame header without decoding any
+// scanlines.
+bool GBitmap::readJPEGSize(Stream &stream, U32& outWidth, U32& outHeight)
+{
+   JFREAD  = jpegReadDataFn;
+   JFERROR = jpegErrorFn;
+
+   jpeg_decompress_struct cinfo;
+   jpeg_error_mgr jerr;
+
+   cinfo.err = jpeg_std_error(&jerr);
+   cinfo.client_data = (void*)&stream;
+
+   jpeg_create_decompress(&cinfo);
+   jpeg_stdio_src(&cinfo);
+   jpeg_read_header(&cinfo, true);
+
+   outWidth = cinfo.image_width;
+   outHeight = cinfo.image_height;
+
+   jpeg_destroy_decompress(&cinfo);
+
+   return outWidth != 0 && outHeight != 0;
+}
+
+
 //--------------------------------------------------------------------------
 bool GBitmap::writeJPEG(Stream& stream) const
 {
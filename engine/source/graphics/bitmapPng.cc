@@ -307,6 +307,56 @@ bool GBitmap::readPNG(Stream& io_rStream)
 }
 
 
+//--------------------------------------------------------------------------
+// Reads the image dimensions from the IHDR chunk without decompressing
+// any image data.
+bool GBitmap::readPNGSize(Stream& io_rStream, U32& outWidth, U32& outHeight)
+{
+   static const U32 cs_headerBytesChecked = 8;
+
+   U8 header[cs_headerBytesChecked];
+   if (!io_rStream.read(cs_headerBytesChecked, header) || png_check_sig(header, cs_headerBytesChecked) == 0)
+      return false;
+
+   // The IHDR chunk is always first: length, type, width, height (big-endian).
+   U8 ihdr[16];
+   if (!io_rStream.read(sizeof(ihdr), ihdr) || dStrncmp((const char*)ihdr + 4, "IHDR", 4) != 0)
+      return false;
+
+   outWidth  = (U32(ihdr[8])  << 24) | (U32(ihdr[9])  << 16) | (U32(ihdr[10]) << 8) | U32(ihdr[11]);
+   outHeight = (U32(ihdr[12]) << 24) | (U32(ihdr[13]) << 16) | (U32(ihdr[14]) << 8) | U32(ihdr[15]);
+
+   return outWidth != 0 && outHeight != 0;
+}
+
+
+//--------------------------------------------------------------------------
+// Moves the stream past an embedded PNG by walking its chunks to IEND.
+bool GBitmap::skipPNG(Stream& io_rStream)
+{
+   static const U32 cs_headerBytesChecked = 8;
+
+   U8 header[cs_headerBytesChecked];
+   if (!io_rStream.read(cs_headerBytesChecked, header) || png_check_sig(header, cs_headerBytesChecked) == 0)
+      return false;
+
+   U8 chunk[8];
+   while (io_rStream.read(sizeof(chunk), chunk))
+   {
+      const U32 length = (U32(chunk[0]) << 24) | (U32(chunk[1]) << 16) | (U32(chunk[2]) << 8) | U32(chunk[3]);
+
+      // Skip the chunk data and its CRC.
+      if (!io_rStream.setPosition(io_rStream.getPosition() + length + 4))
+         return false;
+
+      if (dStrncmp((const char*)chunk + 4, "IEND", 4) == 0)
+         return true;
+   }
+
+   return false;
+}
+
+
 //--------------------------------------------------------------------------
 bool GBitmap::_writePNG(Stream&   stream,
                         const U32 compressionLevel,
@@ -92,27 +92,6 @@ void dglDrawBitmapStretchSR(TextureObject* texture,
    AssertFatal(srcRect.isValidRect() == true,
                "GSurface::drawBitmapStretchSR: routines assume normal rects");
 
-   glDisable(GL_LIGHTING);
-
-   glEnable(GL_TEXTURE_2D);
-   glBindTexture(GL_TEXTURE_2D, texture->getGLTextureName());
-   //glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-
-   if (bSilhouette)
-   {
-      glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_BLEND);
-   
-      ColorF kModulationColor;
-      dglGetBitmapModulation(&kModulationColor);
-      glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, kModulationColor.address());
-   }
-   else
-   {
-      glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-   }
-   glEnable(GL_BLEND);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
    F32 texLeft   = F32(srcRect.point.x)                    / F32(texture->getTextureWidth());
    F32 texRight  = F32(srcRect.point.x + srcRect.extent.x) / F32(texture->getTextureWidth());
    F32 texTop    = F32(srcRect.point.y)                    / F32(texture->getTextureHeight());
@@ -170,11 +149,48 @@ void dglDrawBitmapStretchSR(TextureObject* texture,
       texBottom = temp;
    }
 
+   if (dglGetBatchEnabled())
+   {
+      // Silhouettes need their own texture environment so cannot be batched.
+      if (!bSilhouette)
+      {
+         const Point2F quadPoints[4] = { scrPoints[0], scrPoints[1], scrPoints[3], scrPoints[2] };
+         const Point2F quadTexCoords[4] = { Point2F(texLeft, texTop), Point2F(texRight, texTop), Point2F(texRight, texBottom), Point2F(texLeft, texBottom) };
+         dglBatchQuad(texture->getGLTextureName(), quadPoints, quadTexCoords, sg_bitmapModulation);
+         return;
+      }
+
+      dglFlushBatch();
+   }
+
+   glDisable(GL_LIGHTING);
+
+   glEnable(GL_TEXTURE_2D);
+   glBindTexture(GL_TEXTURE_2D, texture->getGLTextureName());
+   //glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+
+   if (bSilhouette)
+   {
+      glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_BLEND);
+
+      ColorF kModulationColor;
+      dglGetBitmapModulation(&kModulationColor);
+      glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, kModulationColor.address());
+   }
+   else
+   {
+      glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+   }
+   glEnable(GL_BLEND);
+   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
    glColor4ub(sg_bitmapModulation.red,
              sg_bitmapModulation.green,
              sg_bitmapModulation.blue,
              sg_bitmapModulation.alpha);
 
+   dglCountDrawCall();
+
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
 
     GLfloat verts[] = {
@@ -349,6 +365,22 @@ U32 dglDrawTextN(GFont*          font,
 //-----------------------------------------------------------------------------
 
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
+
+/// Maximum number of glyphs drawn by a single text draw call.
+#define DGL_TEXT_MAXQUADS  (16383)
+
+static void dglDrawTextQuads(TextureObject* texture, const U16* indices, S32& vertexCount)
+{
+   // Upload any glyphs rasterized while building the quads.
+   GFont::flushGlyphAtlas();
+
+   // Quads are stored as strips so each needs two triangles.
+   glBindTexture(GL_TEXTURE_2D, texture->getGLTextureName());
+   glDrawElements(GL_TRIANGLES, (vertexCount / 4) * 6, GL_UNSIGNED_SHORT, indices);
+   dglCountDrawCall();
+   vertexCount = 0;
+}
+
 U32 dglDrawTextN(GFont*          font,
                  const Point2I&  ptDraw,
                  const UTF16*    in_string,
@@ -380,22 +412,43 @@ U32 dglDrawTextN(GFont*          font,
 
    currentColor      = sg_bitmapModulation;
 
-   FrameTemp<TextVertex> vert(4*n);
+   // Glyphs are appended to the batch instead of drawn directly when batching.
+   const bool batched = dglGetBatchEnabled();
 
-   glDisable(GL_LIGHTING);
+   const U32 maxQuads = getMin(n, (U32)DGL_TEXT_MAXQUADS);
+   FrameTemp<TextVertex> vert(batched ? 1 : 4*maxQuads);
+   FrameTemp<U16> indices(batched ? 1 : 6*maxQuads);
 
-   glEnable(GL_TEXTURE_2D);
-   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glEnable(GL_BLEND);
+   if (!batched)
+   {
+      // Build the indices for every quad up front so each texture is a single draw call.
+      for (U32 quad = 0; quad < maxQuads; quad++)
+      {
+         const U16 vertexStart = (U16)(quad * 4);
+         U16* pIndex = ~indices + quad * 6;
+         pIndex[0] = vertexStart;
+         pIndex[1] = vertexStart + 1;
+         pIndex[2] = vertexStart + 2;
+         pIndex[3] = vertexStart + 2;
+         pIndex[4] = vertexStart + 1;
+         pIndex[5] = vertexStart + 3;
+      }
 
-   //Luma: Optimise by setting states once before inner loop
-   glEnableClientState ( GL_VERTEX_ARRAY );
-   glEnableClientState ( GL_COLOR_ARRAY );
-   glEnableClientState ( GL_TEXTURE_COORD_ARRAY );
-   glVertexPointer     ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].p) );
-   glColorPointer      ( 4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &(vert[0].c) );
-   glTexCoordPointer   ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].t) );
+      glDisable(GL_LIGHTING);
+
+      glEnable(GL_TEXTURE_2D);
+      glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+      glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+      glEnable(GL_BLEND);
+
+      //Luma: Optimise by setting states once before inner loop
+      glEnableClientState ( GL_VERTEX_ARRAY );
+      glEnableClientState ( GL_COLOR_ARRAY );
+      glEnableClientState ( GL_TEXTURE_COORD_ARRAY );
+      glVertexPointer     ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].p) );
+      glColorPointer      ( 4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &(vert[0].c) );
+      glTexCoordPointer   ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].t) );
+   }
 
    // first build the point, color, and coord arrays
    U32 i;
@@ -491,16 +544,8 @@ U32 dglDrawTextN(GFont*          font,
       if(newObj != lastTexture)
       {
          if(currentPt)
-         {
-            glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
+            dglDrawTextQuads(lastTexture, ~indices, currentPt);
 
-            //Luma:	More optimal rendering
-            for (S32 i=0; i<currentPt; i+=4) 
-            {
-                glDrawArrays(GL_TRIANGLE_STRIP, i, 4);
-            }
-            currentPt = 0;
-         }
          lastTexture = newObj;
       }
       if(ci.width != 0 && ci.height != 0)
@@ -528,31 +573,39 @@ U32 dglDrawTextN(GFont*          font,
             rotMatrix.mulP( points[i] );
             points[i] += offset;
          }
-         vert[currentPt++].set(points[0].x, points[0].y, texLeft, texTop, currentColor);
-         vert[currentPt++].set(points[1].x, points[1].y, texRight, texTop, currentColor);
-         vert[currentPt++].set(points[2].x, points[2].y, texLeft, texBottom, currentColor);
-         vert[currentPt++].set(points[3].x, points[3].y, texRight, texBottom, currentColor);
+         if (batched)
+         {
+            const Point2F quadPoints[4] = { Point2F(points[0].x, points[0].y), Point2F(points[1].x, points[1].y), Point2F(points[3].x, points[3].y), Point2F(points[2].x, points[2].y) };
+            const Point2F quadTexCoords[4] = { Point2F(texLeft, texTop), Point2F(texRight, texTop), Point2F(texRight, texBottom), Point2F(texLeft, texBottom) };
+            dglBatchQuad(lastTexture->getGLTextureName(), quadPoints, quadTexCoords, currentColor);
+         }
+         else
+         {
+            if(currentPt == (S32)(maxQuads * 4))
+               dglDrawTextQuads(lastTexture, ~indices, currentPt);
+
+            vert[currentPt++].set(points[0].x, points[0].y, texLeft, texTop, currentColor);
+            vert[currentPt++].set(points[1].x, points[1].y, texRight, texTop, currentColor);
+            vert[currentPt++].set(points[2].x, points[2].y, texLeft, texBottom, currentColor);
+            vert[currentPt++].set(points[3].x, points[3].y, texRight, texBottom, currentColor);
+         }
          pt.x += ci.xIncrement - ci.xOrigin;
       }
       else
          pt.x += ci.xIncrement;
    }
    if(currentPt)
-   {
-       //Luma:	More optimal rendering
-       glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
-       for (S32 i=0; i<currentPt; i+=4) 
-       {
-            glDrawArrays(GL_TRIANGLE_STRIP, i, 4);
-       }
-   }
+      dglDrawTextQuads(lastTexture, ~indices, currentPt);
 
-   glDisableClientState ( GL_VERTEX_ARRAY );
-   glDisableClientState ( GL_COLOR_ARRAY );
-   glDisableClientState ( GL_TEXTURE_COORD_ARRAY );
+   if (!batched)
+   {
+      glDisableClientState ( GL_VERTEX_ARRAY );
+      glDisableClientState ( GL_COLOR_ARRAY );
+      glDisableClientState ( GL_TEXTURE_COORD_ARRAY );
 
-   glDisable(GL_BLEND);
-   glDisable(GL_TEXTURE_2D);
+      glDisable(GL_BLEND);
+      glDisable(GL_TEXTURE_2D);
+   }
 
    pt.x += ptDraw.x; // DAW: Account for the fact that we removed the drawing point from the text start at the beginning.
 
@@ -594,23 +647,29 @@ U32 dglDrawTextN(GFont*          font,
 
    currentColor      = sg_bitmapModulation;
 
-   FrameTemp<TextVertex> vert(4*n);
+   // Glyphs are appended to the batch instead of drawn directly when batching.
+   const bool batched = dglGetBatchEnabled();
 
-   glDisable(GL_LIGHTING);
+   FrameTemp<TextVertex> vert(batched ? 1 : 4*n);
 
-   glEnable(GL_TEXTURE_2D);
-   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glEnable(GL_BLEND);
+   if (!batched)
+   {
+      glDisable(GL_LIGHTING);
+
+      glEnable(GL_TEXTURE_2D);
+      glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+      glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+      glEnable(GL_BLEND);
 
-   glEnableClientState ( GL_VERTEX_ARRAY );
-   glVertexPointer     ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].p) );
+      glEnableClientState ( GL_VERTEX_ARRAY );
+      glVertexPointer     ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].p) );
 
-   glEnableClientState ( GL_COLOR_ARRAY );
-   glColorPointer      ( 4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &(vert[0].c) );
+      glEnableClientState ( GL_COLOR_ARRAY );
+      glColorPointer      ( 4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &(vert[0].c) );
 
-   glEnableClientState ( GL_TEXTURE_COORD_ARRAY );
-   glTexCoordPointer   ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].t) );
+      glEnableClientState ( GL_TEXTURE_COORD_ARRAY );
+      glTexCoordPointer   ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].t) );
+   }
 
    // first build the point, color, and coord arrays
    U32 i;
@@ -707,8 +766,10 @@ U32 dglDrawTextN(GFont*          font,
       {
          if(currentPt)
          {
+            GFont::flushGlyphAtlas();
             glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
             glDrawArrays( GL_QUADS, 0, currentPt );
+            dglCountDrawCall();
             currentPt = 0;
          }
          lastTexture = newObj;
@@ -739,10 +800,19 @@ U32 dglDrawTextN(GFont*          font,
             points[i] += offset;
          }
 
-         vert[currentPt++].set(points[0].x, points[0].y, texLeft, texBottom, currentColor);
-         vert[currentPt++].set(points[1].x, points[1].y, texRight, texBottom, currentColor);
-         vert[currentPt++].set(points[2].x, points[2].y, texRight, texTop, currentColor);
-         vert[currentPt++].set(points[3].x, points[3].y, texLeft, texTop, currentColor);
+         if (batched)
+         {
+            const Point2F quadPoints[4] = { Point2F(points[0].x, points[0].y), Point2F(points[1].x, points[1].y), Point2F(points[2].x, points[2].y), Point2F(points[3].x, points[3].y) };
+            const Point2F quadTexCoords[4] = { Point2F(texLeft, texBottom), Point2F(texRight, texBottom), Point2F(texRight, texTop), Point2F(texLeft, texTop) };
+            dglBatchQuad(lastTexture->getGLTextureName(), quadPoints, quadTexCoords, currentColor);
+         }
+         else
+         {
+            vert[currentPt++].set(points[0].x, points[0].y, texLeft, texBottom, currentColor);
+            vert[currentPt++].set(points[1].x, points[1].y, texRight, texBottom, currentColor);
+            vert[currentPt++].set(points[2].x, points[2].y, texRight, texTop, currentColor);
+            vert[currentPt++].set(points[3].x, points[3].y, texLeft, texTop, currentColor);
+         }
          pt.x += ci.xIncrement - ci.xOrigin;
       }
       else
@@ -750,16 +820,21 @@ U32 dglDrawTextN(GFont*          font,
    }
    if(currentPt)
    {
+      GFont::flushGlyphAtlas();
       glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
       glDrawArrays( GL_QUADS, 0, currentPt );
+      dglCountDrawCall();
    }
 
-   glDisableClientState ( GL_VERTEX_ARRAY );
-   glDisableClientState ( GL_COLOR_ARRAY );
-   glDisableClientState ( GL_TEXTURE_COORD_ARRAY );
+   if (!batched)
+   {
+      glDisableClientState ( GL_VERTEX_ARRAY );
+      glDisableClientState ( GL_COLOR_ARRAY );
+      glDisableClientState ( GL_TEXTURE_COORD_ARRAY );
 
-   glDisable(GL_BLEND);
-   glDisable(GL_TEXTURE_2D);
+      glDisable(GL_BLEND);
+      glDisable(GL_TEXTURE_2D);
+   }
 
    pt.x += ptDraw.x; // DAW: Account for the fact that we removed the drawing point from the text start at the beginning.
 
@@ -775,6 +850,15 @@ U32 dglDrawTextN(GFont*          font,
 
 void dglDrawLine(S32 x1, S32 y1, S32 x2, S32 y2, const ColorI &color)
 {
+   if (dglGetBatchEnabled())
+   {
+      const Point2F linePoints[2] = { Point2F((F32)x1 + 0.5f, (F32)y1 + 0.5f), Point2F((F32)x2 + 0.5f, (F32)y2 + 0.5f) };
+      dglBatchLines(linePoints, 2, color);
+      return;
+   }
+
+   dglCountDrawCall();
+
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -807,6 +891,20 @@ void dglDrawLine(const Point2I &startPt, const Point2I &endPt, const ColorI &col
 
 void dglDrawRect(const Point2I &upperL, const Point2I &lowerR, const ColorI &color, const float &lineWidth)
 {
+   if (dglGetBatchEnabled())
+   {
+      // Batched lines are independent segments so the loop is expanded into its four edges.
+      const Point2F topLeft((F32)upperL.x + 0.5f, (F32)upperL.y + 0.5f);
+      const Point2F topRight((F32)lowerR.x + 0.5f, (F32)upperL.y + 0.5f);
+      const Point2F bottomRight((F32)lowerR.x + 0.5f, (F32)lowerR.y + 0.5f);
+      const Point2F bottomLeft((F32)upperL.x + 0.5f, (F32)lowerR.y + 0.5f);
+      const Point2F linePoints[8] = { topLeft, topRight, topRight, bottomRight, bottomRight, bottomLeft, bottomLeft, topLeft };
+      dglBatchLines(linePoints, 8, color, lineWidth);
+      return;
+   }
+
+   dglCountDrawCall();
+
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -848,6 +946,15 @@ void dglDrawRect(const RectI &rect, const ColorI &color, const float &lineWidth)
 
 void dglDrawRectFill(const Point2I &upperL, const Point2I &lowerR, const ColorI &color)
 {
+   if (dglGetBatchEnabled())
+   {
+      const Point2F quadPoints[4] = { Point2F((F32)upperL.x, (F32)upperL.y), Point2F((F32)lowerR.x, (F32)upperL.y), Point2F((F32)lowerR.x, (F32)lowerR.y), Point2F((F32)upperL.x, (F32)lowerR.y) };
+      dglBatchQuad(0, quadPoints, NULL, color);
+      return;
+   }
+
+   dglCountDrawCall();
+
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -877,6 +984,9 @@ void dglDrawRectFill(const RectI &rect, const ColorI &color)
 
 void dglDraw2DSquare( const Point2F &screenPoint, F32 width, F32 spinAngle )
 {
+   dglFlushBatch();
+   dglCountDrawCall();
+
    width *= 0.5;
 
    MatrixF rotMatrix( EulerF( 0.0, 0.0, spinAngle ) );
@@ -937,6 +1047,9 @@ void dglDraw2DSquare( const Point2F &screenPoint, F32 width, F32 spinAngle )
 
 void dglDrawBillboard( const Point3F &position, F32 width, F32 spinAngle )
 {
+   dglFlushBatch();
+   dglCountDrawCall();
+
    MatrixF modelview;
    dglGetModelview( &modelview );
    modelview.transpose();
@@ -1014,6 +1127,8 @@ void dglWireCube(const Point3F & extent, const Point3F & center)
       { 3, 2, 6, 7 }, { 7, 6, 4, 5 }, { 3, 7, 5, 1 }
    };
 
+   dglFlushBatch();
+
    glDisable(GL_CULL_FACE);
 
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
@@ -1039,6 +1154,7 @@ void dglWireCube(const Point3F & extent, const Point3F & center)
       }
        glVertexPointer(3, GL_FLOAT, 0, verts);
        glDrawArrays(GL_LINE_LOOP, 0, 4);
+       dglCountDrawCall();
    }
 #else
    for (S32 i = 0; i < 6; i++)
@@ -1052,6 +1168,7 @@ void dglWireCube(const Point3F & extent, const Point3F & center)
             cubePoints[idx].z * extent.z + center.z);
       }
       glEnd();
+      dglCountDrawCall();
    }
 #endif
 }
@@ -1071,6 +1188,8 @@ void dglSolidCube(const Point3F & extent, const Point3F & center)
       { 3, 2, 6, 7 }, { 7, 6, 4, 5 }, { 3, 7, 5, 1 }
    };
 
+   dglFlushBatch();
+
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
 //PUAP -Mat untested
    for (S32 i = 0; i < 6; i++)
@@ -1094,6 +1213,7 @@ void dglSolidCube(const Point3F & extent, const Point3F & center)
       }
        glVertexPointer(3, GL_FLOAT, 0, verts);
        glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+       dglCountDrawCall();
    }
 #else
    for (S32 i = 0; i < 6; i++)
@@ -1107,12 +1227,16 @@ void dglSolidCube(const Point3F & extent, const Point3F & center)
             cubePoints[idx].z * extent.z + center.z);
       }
       glEnd();
+      dglCountDrawCall();
    }
 #endif
 }
 
 void dglSetClipRect(const RectI &clipRect)
 {
+   // Pending primitives were submitted against the previous clip rectangle.
+   dglFlushBatch();
+
    glMatrixMode(GL_PROJECTION);
    glLoadIdentity();
 
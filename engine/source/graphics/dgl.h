@@ -194,6 +194,43 @@ void dglWireCube(const Point3F &extent, const Point3F &center);
 /// Draws a solid cube around "center" with size "extent"
 void dglSolidCube(const Point3F &extent, const Point3F & enter);
 /// @}
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
+// Batching
+
+/// @defgroup dgl_batch Primitive Batching
+/// @ingroup dgl
+/// When batching is enabled the bitmap, text, line and rectangle functions above append their
+/// geometry into a shared vertex buffer instead of drawing immediately.  Primitives with the same
+/// texture and primitive type are merged into a single draw call as long as doing so cannot change
+/// the visible result (a primitive is only moved ahead of later primitives it does not overlap).
+/// The batch is flushed automatically whenever the clip rect, viewport or matrices change through
+/// dgl.  Code that issues OpenGL calls directly must call dglFlushBatch() first.
+/// @{
+
+/// Enables or disables batching.  Disabling batching flushes any pending primitives.
+void dglSetBatchEnabled(const bool enabled);
+/// Returns whether batching is currently enabled.
+bool dglGetBatchEnabled();
+/// Renders and clears any pending batched primitives.
+void dglFlushBatch();
+/// Appends a quad to the batch.  Points and texture coordinates are given in order around the quad.
+/// A texture name of zero renders the quad untextured.
+void dglBatchQuad(const U32 textureName, const Point2F* pPoints, const Point2F* pTexCoords, const ColorI& color);
+/// Appends line segments (pairs of points) to the batch.
+void dglBatchLines(const Point2F* pPoints, const U32 pointCount, const ColorI& color, const F32 lineWidth = 1.0f);
+
+/// Counts a draw call issued outside of the batch.
+void dglCountDrawCall();
+/// Starts a new frame of draw-call statistics.
+void dglBeginFrameStats();
+/// Returns the number of draw calls issued during the last complete frame.
+U32 dglGetFrameDrawCalls();
+/// Returns the number of primitives that went through the batch during the last complete frame.
+U32 dglGetFrameBatchedPrimitives();
+/// Returns the number of batch flushes during the last complete frame.
+U32 dglGetFrameBatchFlushes();
+/// @}
+
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
 // Matrix functions
 
@@ -0,0 +1,372 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "graphics/dgl.h"
+#include "graphics/color.h"
+#include "graphics/gFont.h"
+#include "math/mPoint.h"
+#include "collection/vector.h"
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+/// Maximum number of vertices addressable by the 16-bit index buffer.
+#define DGL_BATCH_MAXVERTICES    (65535)
+
+/// How many runs back a primitive may be merged into.
+#define DGL_BATCH_RUNLOOKBACK    (8)
+
+namespace {
+
+struct BatchVertex
+{
+   Point2F  mPosition;
+   Point2F  mTexCoord;
+   ColorI   mColor;
+};
+
+/// A run is a set of primitives sharing the same render state.
+/// Runs are drawn in the order they were created.
+struct BatchRun
+{
+   U32      mTextureName;
+   GLenum   mPrimitive;
+   F32      mLineWidth;
+   Point2F  mBoundsMin;
+   Point2F  mBoundsMax;
+   U32      mIndexStart;
+   U32      mIndexCount;
+};
+
+/// A primitive references its indices in the submission index buffer.
+struct BatchPrimitive
+{
+   U32      mRun;
+   U32      mIndexStart;
+   U32      mIndexCount;
+};
+
+bool                    sgBatchEnabled = false;
+
+Vector<BatchVertex>     sgBatchVertices;
+Vector<U16>             sgBatchIndices;
+Vector<U16>             sgBatchSortedIndices;
+Vector<BatchPrimitive>  sgBatchPrimitives;
+Vector<BatchRun>        sgBatchRuns;
+
+U32                     sgDrawCalls = 0;
+U32                     sgBatchedPrimitives = 0;
+U32                     sgBatchFlushes = 0;
+U32                     sgLastFrameDrawCalls = 0;
+U32                     sgLastFrameBatchedPrimitives = 0;
+U32                     sgLastFrameBatchFlushes = 0;
+
+//-----------------------------------------------------------------------------
+
+inline bool boundsOverlap( const BatchRun& run, const Point2F& boundsMin, const Point2F& boundsMax )
+{
+   return !( boundsMax.x < run.mBoundsMin.x || boundsMin.x > run.mBoundsMax.x ||
+             boundsMax.y < run.mBoundsMin.y || boundsMin.y > run.mBoundsMax.y );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 findBatchRun( const U32 textureName, const GLenum primitive, const F32 lineWidth, const Point2F& boundsMin, const Point2F& boundsMax )
+{
+   // Search the most recent runs for one with the same state.  We can only move a
+   // primitive back into an earlier run if it does not overlap anything drawn after it.
+   const S32 runCount = sgBatchRuns.size();
+   const S32 firstRun = getMax( runCount - DGL_BATCH_RUNLOOKBACK, 0 );
+   for ( S32 runIndex = runCount - 1; runIndex >= firstRun; --runIndex )
+   {
+      BatchRun& run = sgBatchRuns[runIndex];
+
+      if ( run.mTextureName == textureName && run.mPrimitive == primitive && run.mLineWidth == lineWidth )
+      {
+         run.mBoundsMin.setMin( boundsMin );
+         run.mBoundsMax.setMax( boundsMax );
+         return runIndex;
+      }
+
+      if ( boundsOverlap( run, boundsMin, boundsMax ) )
+         break;
+   }
+
+   // No suitable run so start a new one.
+   BatchRun run;
+   run.mTextureName = textureName;
+   run.mPrimitive = primitive;
+   run.mLineWidth = lineWidth;
+   run.mBoundsMin = boundsMin;
+   run.mBoundsMax = boundsMax;
+   run.mIndexStart = 0;
+   run.mIndexCount = 0;
+   sgBatchRuns.push_back( run );
+
+   return runCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void addBatchPrimitive( const U32 run, const U32 indexStart )
+{
+   BatchPrimitive primitive;
+   primitive.mRun = run;
+   primitive.mIndexStart = indexStart;
+   primitive.mIndexCount = sgBatchIndices.size() - indexStart;
+   sgBatchPrimitives.push_back( primitive );
+
+   sgBatchRuns[run].mIndexCount += primitive.mIndexCount;
+
+   sgBatchedPrimitives++;
+}
+
+} // namespace {}
+
+//-----------------------------------------------------------------------------
+
+void dglSetBatchEnabled( const bool enabled )
+{
+   // Ignore no change.
+   if ( sgBatchEnabled == enabled )
+      return;
+
+   // Flush anything pending before switching mode.
+   dglFlushBatch();
+
+   sgBatchEnabled = enabled;
+}
+
+//-----------------------------------------------------------------------------
+
+bool dglGetBatchEnabled()
+{
+   return sgBatchEnabled;
+}
+
+//-----------------------------------------------------------------------------
+
+void dglBatchQuad( const U32 textureName, const Point2F* pPoints, const Point2F* pTexCoords, const ColorI& color )
+{
+   AssertFatal( sgBatchEnabled, "dglBatchQuad() - Batching is not enabled." );
+
+   // Flush if the vertex buffer is full.
+   if ( sgBatchVertices.size() + 4 > DGL_BATCH_MAXVERTICES )
+      dglFlushBatch();
+
+   Point2F boundsMin = pPoints[0];
+   Point2F boundsMax = pPoints[0];
+   for ( U32 n = 1; n < 4; ++n )
+   {
+      boundsMin.setMin( pPoints[n] );
+      boundsMax.setMax( pPoints[n] );
+   }
+
+   const U32 run = findBatchRun( textureName, GL_TRIANGLES, 1.0f, boundsMin, boundsMax );
+
+   const U16 vertexStart = (U16)sgBatchVertices.size();
+   for ( U32 n = 0; n < 4; ++n )
+   {
+      BatchVertex vertex;
+      vertex.mPosition = pPoints[n];
+      vertex.mTexCoord = pTexCoords != NULL ? pTexCoords[n] : Point2F( 0.0f, 0.0f );
+      vertex.mColor = color;
+      sgBatchVertices.push_back( vertex );
+   }
+
+   const U32 indexStart = sgBatchIndices.size();
+   sgBatchIndices.push_back( vertexStart );
+   sgBatchIndices.push_back( vertexStart + 1 );
+   sgBatchIndices.push_back( vertexStart + 2 );
+   sgBatchIndices.push_back( vertexStart );
+   sgBatchIndices.push_back( vertexStart + 2 );
+   sgBatchIndices.push_back( vertexStart + 3 );
+
+   addBatchPrimitive( run, indexStart );
+}
+
+//-----------------------------------------------------------------------------
+
+void dglBatchLines( const Point2F* pPoints, const U32 pointCount, const ColorI& color, const F32 lineWidth )
+{
+   AssertFatal( sgBatchEnabled, "dglBatchLines() - Batching is not enabled." );
+   AssertFatal( pointCount % 2 == 0, "dglBatchLines() - Lines must be specified as pairs of points." );
+   AssertFatal( pointCount <= DGL_BATCH_MAXVERTICES, "dglBatchLines() - Too many points." );
+
+   if ( pointCount == 0 )
+      return;
+
+   // Flush if the vertex buffer is full.
+   if ( sgBatchVertices.size() + pointCount > DGL_BATCH_MAXVERTICES )
+      dglFlushBatch();
+
+   // Lines cover the pixels around them so pad the bounds by the line width.
+   Point2F boundsMin = pPoints[0];
+   Point2F boundsMax = pPoints[0];
+   for ( U32 n = 1; n < pointCount; ++n )
+   {
+      boundsMin.setMin( pPoints[n] );
+      boundsMax.setMax( pPoints[n] );
+   }
+   boundsMin -= Point2F( lineWidth, lineWidth );
+   boundsMax += Point2F( lineWidth, lineWidth );
+
+   const U32 run = findBatchRun( 0, GL_LINES, lineWidth, boundsMin, boundsMax );
+
+   const U32 indexStart = sgBatchIndices.size();
+   for ( U32 n = 0; n < pointCount; ++n )
+   {
+      BatchVertex vertex;
+      vertex.mPosition = pPoints[n];
+      vertex.mTexCoord.set( 0.0f, 0.0f );
+      vertex.mColor = color;
+      sgBatchIndices.push_back( (U16)sgBatchVertices.size() );
+      sgBatchVertices.push_back( vertex );
+   }
+
+   addBatchPrimitive( run, indexStart );
+}
+
+//-----------------------------------------------------------------------------
+
+void dglFlushBatch()
+{
+   // Finish if nothing to flush.
+   if ( sgBatchPrimitives.size() == 0 )
+      return;
+
+   PROFILE_SCOPE(dglFlushBatch);
+
+   // Text quads may use glyphs that have not been uploaded yet.
+   GFont::flushGlyphAtlas();
+
+   // Allocate each run a contiguous range of the sorted index buffer.
+   U32 indexStart = 0;
+   for ( Vector<BatchRun>::iterator runItr = sgBatchRuns.begin(); runItr != sgBatchRuns.end(); ++runItr )
+   {
+      runItr->mIndexStart = indexStart;
+      indexStart += runItr->mIndexCount;
+      runItr->mIndexCount = 0;
+   }
+   sgBatchSortedIndices.setSize( indexStart );
+
+   // Gather the primitive indices into their runs, preserving submission order within a run.
+   for ( Vector<BatchPrimitive>::iterator primitiveItr = sgBatchPrimitives.begin(); primitiveItr != sgBatchPrimitives.end(); ++primitiveItr )
+   {
+      BatchRun& run = sgBatchRuns[primitiveItr->mRun];
+      dMemcpy( sgBatchSortedIndices.address() + run.mIndexStart + run.mIndexCount,
+               sgBatchIndices.address() + primitiveItr->mIndexStart,
+               primitiveItr->mIndexCount * sizeof(U16) );
+      run.mIndexCount += primitiveItr->mIndexCount;
+   }
+
+   // Set the common render state.
+   glDisable( GL_LIGHTING );
+   glEnable( GL_BLEND );
+   glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+   glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
+
+   const BatchVertex* pVertices = sgBatchVertices.address();
+   glEnableClientState( GL_VERTEX_ARRAY );
+   glVertexPointer( 2, GL_FLOAT, sizeof(BatchVertex), &pVertices->mPosition );
+   glEnableClientState( GL_COLOR_ARRAY );
+   glColorPointer( 4, GL_UNSIGNED_BYTE, sizeof(BatchVertex), &pVertices->mColor );
+   glTexCoordPointer( 2, GL_FLOAT, sizeof(BatchVertex), &pVertices->mTexCoord );
+
+   // Draw the runs.
+   for ( Vector<BatchRun>::iterator runItr = sgBatchRuns.begin(); runItr != sgBatchRuns.end(); ++runItr )
+   {
+      if ( runItr->mTextureName != 0 )
+      {
+         glEnable( GL_TEXTURE_2D );
+         glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+         glBindTexture( GL_TEXTURE_2D, runItr->mTextureName );
+      }
+      else
+      {
+         glDisable( GL_TEXTURE_2D );
+         glDisableClientState( GL_TEXTURE_COORD_ARRAY );
+      }
+
+      if ( runItr->mPrimitive == GL_LINES )
+         glLineWidth( runItr->mLineWidth );
+
+      glDrawElements( runItr->mPrimitive, runItr->mIndexCount, GL_UNSIGNED_SHORT, sgBatchSortedIndices.address() + runItr->mIndexStart );
+      sgDrawCalls++;
+   }
+
+   // Reset the render state.
+   glDisableClientState( GL_VERTEX_ARRAY );
+   glDisableClientState( GL_COLOR_ARRAY );
+   glDisableClientState( GL_TEXTURE_COORD_ARRAY );
+   glDisable( GL_BLEND );
+   glDisable( GL_TEXTURE_2D );
+
+   // Reset the batch.
+   sgBatchVertices.clear();
+   sgBatchIndices.clear();
+   sgBatchPrimitives.clear();
+   sgBatchRuns.clear();
+
+   sgBatchFlushes++;
+}
+
+//-----------------------------------------------------------------------------
+
+void dglCountDrawCall()
+{
+   sgDrawCalls++;
+}
+
+//-----------------------------------------------------------------------------
+
+void dglBeginFrameStats()
+{
+   sgLastFrameDrawCalls = sgDrawCalls;
+   sgLastFrameBatchedPrimitives = sgBatchedPrimitives;
+   sgLastFrameBatchFlushes = sgBatchFlushes;
+
+   sgDrawCalls = 0;
+   sgBatchedPrimitives = 0;
+   sgBatchFlushes = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 dglGetFrameDrawCalls()
+{
+   return sgLastFrameDrawCalls;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 dglGetFrameBatchedPrimitives()
+{
+   return sgLastFrameBatchedPrimitives;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 dglGetFrameBatchFlushes()
+{
+   return sgLastFrameBatchFlushes;
+}
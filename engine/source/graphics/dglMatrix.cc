@@ -26,6 +26,9 @@
 
 void dglLoadMatrix(const MatrixF *m)
 {
+   // Batched primitives are in the space of the current matrix.
+   dglFlushBatch();
+
    //F32 mat[16];
    //m->transposeTo(mat);
    const_cast<MatrixF*>(m)->transpose();
@@ -35,6 +38,9 @@ void dglLoadMatrix(const MatrixF *m)
 
 void dglMultMatrix(const MatrixF *m)
 {
+   // Batched primitives are in the space of the current matrix.
+   dglFlushBatch();
+
    //F32 mat[16];
    //m->transposeTo(mat);
 //   const F32* mp = *m;
@@ -90,6 +96,8 @@ void dglSetFrustum(F64 left, F64 right, F64 bottom, F64 top, F64 nearPlane, F64
                                      0, 1,  0, 0,
                                      0, 0,  0, 1 };
 
+   dglFlushBatch();
+
    frustLeft = left;
    frustRight = right;
    frustBottom = bottom;
@@ -131,6 +139,8 @@ bool dglIsOrtho()
 
 void dglSetViewport(const RectI &aViewPort)
 {
+   dglFlushBatch();
+
    viewPort = aViewPort;
    U32 screenHeight = Platform::getWindowSize().y;
    //glViewport(viewPort.point.x, viewPort.point.y + viewPort.extent.y,
@@ -152,9 +152,12 @@ class GBitmap: public ResourceInstance
    //-------------------------------------- Input/Output interface
   public:
    bool readJPEG(Stream& io_rStream);              // located in bitmapJpeg.cc
+   static bool readJPEGSize(Stream& io_rStream, U32& outWidth, U32& outHeight);
    bool writeJPEG(Stream& io_rStream) const;
 
    bool readPNG(Stream& io_rStream);               // located in bitmapPng.cc
+   static bool readPNGSize(Stream& io_rStream, U32& outWidth, U32& outHeight);
+   static bool skipPNG(Stream& io_rStream);
    bool writePNG(Stream& io_rStream, const bool compressHard = false) const;
    bool writePNGUncompressed(Stream& io_rStream) const;
 
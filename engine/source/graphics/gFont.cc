@@ -35,6 +35,7 @@
 #include "memory/safeDelete.h"
 #include "memory/frameAllocator.h"
 #include "string/unicode.h"
+#include "game/gameInterface.h"
 #include "zlib.h"
 #include "ctype.h"  // Needed for isupper and tolower
 
@@ -43,6 +44,13 @@
 S32 GFont::smSheetIdCount = 0;
 const U32 GFont::csm_fileVersion = 3;
 
+bool GFont::smGlyphAtlasEnabled = false;
+Vector<TextureHandle> GFont::smGlyphAtlasSheets;
+S32 GFont::smGlyphAtlasCurX = 0;
+S32 GFont::smGlyphAtlasCurY = 0;
+S32 GFont::smGlyphAtlasRowHeight = 0;
+bool GFont::smGlyphAtlasDirty = false;
+
 static PlatformFont* createSafePlatformFont(const char *name, U32 size, U32 charset = TGE_ANSI_CHARSET)
 {
    PlatformFont *platFont = createPlatformFont(name, size, charset);
@@ -128,7 +136,12 @@ Resource<GFont> GFont::create(const char *faceName, U32 size, const char *cacheD
     
    GFont *resFont = new GFont;
    resFont->mPlatformFont = platFont;
-   resFont->addSheet();
+
+   // Glyphs go into the shared atlas so no private sheet is needed.
+   // Headless games keep only the glyph metrics so need no sheet at all.
+   if (!smGlyphAtlasEnabled && !Game->isHeadless())
+      resFont->addSheet();
+
    resFont->mGFTFile = StringTable->insert(buf);
    resFont->mFaceName = StringTable->insert(faceName);
    resFont->mSize = size;
@@ -216,6 +229,7 @@ void GFont::dumpInfo()
    // Let's write out all the info we can on this font.
    Con::printf("   '%s' %dpt", mFaceName, mSize);
    Con::printf("      - %d texture sheets, %d mapped characters.", mTextureSheets.size(), mapCount);
+   Con::printf("      - %d cached string widths.", mStrWidthCache.size());
 
    if(mapCount)
       Con::printf("      - Codepoints range from 0x%x to 0x%x.", mapBegin, mapEnd);
@@ -235,8 +249,18 @@ bool GFont::loadCharInfo(const UTF16 ch)
     {
         Mutex::lockMutex(mMutex); // the CharInfo returned by mPlatformFont is static data, must protect from changes.
         PlatformFont::CharInfo &ci = mPlatformFont->getCharInfo(ch);
-        if(ci.bitmapData)
-            addBitmap(ci);
+        if(ci.bitmapData && Game->isHeadless())
+        {
+            // Only the metrics are needed when nothing is rendered.
+            SAFE_DELETE_ARRAY(ci.bitmapData);
+        }
+        else if(ci.bitmapData)
+        {
+            if(smGlyphAtlasEnabled)
+                addAtlasBitmap(ci);
+            else
+                addBitmap(ci);
+        }
 
         mCharInfoList.push_back(ci);
         mRemapTable[ch] = mCharInfoList.size() - 1;
@@ -355,6 +379,157 @@ void GFont::addSheet()
     mCurSheet = mTextureSheets.size() - 1;
 }
 
+void GFont::addAtlasBitmap(PlatformFont::CharInfo &charInfo)
+{
+   // Glyphs from every font are packed into shelves on the shared atlas sheets.
+   // Each shelf is as tall as the tallest glyph placed on it.
+   const S32 glyphWidth = getMin((S32)charInfo.width, GlyphAtlasSheetSize - GlyphAtlasPadding);
+   const S32 glyphHeight = getMin((S32)charInfo.height, GlyphAtlasSheetSize - GlyphAtlasPadding);
+
+   if (smGlyphAtlasSheets.size() == 0)
+      addAtlasSheet();
+
+   // Start a new shelf if the glyph does not fit on the current one.
+   if (smGlyphAtlasCurX + glyphWidth + GlyphAtlasPadding > GlyphAtlasSheetSize)
+   {
+      smGlyphAtlasCurX = 0;
+      smGlyphAtlasCurY += smGlyphAtlasRowHeight + GlyphAtlasPadding;
+      smGlyphAtlasRowHeight = 0;
+   }
+
+   // Start a new sheet if the glyph does not fit below the current shelf.
+   if (smGlyphAtlasCurY + glyphHeight + GlyphAtlasPadding > GlyphAtlasSheetSize)
+      addAtlasSheet();
+
+   TextureHandle& sheet = smGlyphAtlasSheets.last();
+
+   // Reference the sheet from this font so the glyph texture lives as long as the font does.
+   S32 sheetIndex = findTextureSheet(sheet);
+   if (sheetIndex == -1)
+   {
+      mTextureSheets.increment();
+      constructInPlace(&mTextureSheets.last());
+      mTextureSheets.last() = sheet;
+      sheetIndex = mTextureSheets.size() - 1;
+   }
+
+   charInfo.bitmapIndex = sheetIndex;
+   charInfo.xOffset = smGlyphAtlasCurX;
+   charInfo.yOffset = smGlyphAtlasCurY;
+
+   smGlyphAtlasCurX += glyphWidth + GlyphAtlasPadding;
+   smGlyphAtlasRowHeight = getMax(smGlyphAtlasRowHeight, glyphHeight);
+
+   GBitmap *bmp = sheet.getBitmap();
+
+   AssertFatal(bmp, "GFont::addAtlasBitmap - null atlas sheet bitmap!");
+
+   for( S32 y = 0; y < glyphHeight; y++ )
+   {
+      U8* pDest = bmp->getAddress( charInfo.xOffset, charInfo.yOffset + y );
+      dMemcpy( pDest, charInfo.bitmapData + y * charInfo.width, glyphWidth );
+   }
+
+   // Upload once before the next draw rather than once per glyph.
+   smGlyphAtlasDirty = true;
+}
+
+S32 GFont::findTextureSheet(const TextureHandle& handle)
+{
+   for (S32 i = mTextureSheets.size() - 1; i >= 0; i--)
+   {
+      if (mTextureSheets[i] == handle)
+         return i;
+   }
+
+   return -1;
+}
+
+void GFont::addAtlasSheet()
+{
+    // Only the last sheet is written to so upload it before moving on.
+    flushGlyphAtlas();
+
+    char buf[30];
+    dSprintf(buf, sizeof(buf), "fontatlas_%d", smSheetIdCount++);
+
+    GBitmap *bitmap = new GBitmap(GlyphAtlasSheetSize, GlyphAtlasSheetSize, false, GBitmap::Alpha);
+
+    // Set everything to transparent.
+    U8 *bits = bitmap->getWritableBits();
+    dMemset(bits, 0, sizeof(U8) *GlyphAtlasSheetSize*GlyphAtlasSheetSize);
+
+    TextureHandle handle = TextureHandle(buf, bitmap, TextureHandle::BitmapKeepTexture);
+    handle.setFilter(GL_NEAREST);
+
+    smGlyphAtlasSheets.increment();
+    constructInPlace(&smGlyphAtlasSheets.last());
+    smGlyphAtlasSheets.last() = handle;
+
+    smGlyphAtlasCurX = 0;
+    smGlyphAtlasCurY = 0;
+    smGlyphAtlasRowHeight = 0;
+}
+
+void GFont::refreshGlyphAtlas()
+{
+   smGlyphAtlasDirty = false;
+
+   if (smGlyphAtlasSheets.size() > 0)
+      smGlyphAtlasSheets.last().refresh();
+}
+
+void GFont::destroyGlyphAtlas()
+{
+   // Fonts keep their own references to the sheets they use.
+   for (S32 i = 0; i < smGlyphAtlasSheets.size(); i++)
+      destructInPlace(&smGlyphAtlasSheets[i]);
+
+   smGlyphAtlasSheets.clear();
+   smGlyphAtlasSheets.compact();
+   smGlyphAtlasDirty = false;
+
+   smGlyphAtlasCurX = 0;
+   smGlyphAtlasCurY = 0;
+   smGlyphAtlasRowHeight = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+U32 GFont::prewarm(const UTF8* string)
+{
+   AssertFatal(string != NULL, "GFont::prewarm - String is NULL");
+
+   const U32 length = dStrlen(string);
+   FrameTemp<UTF16> str16(length + 1);
+   convertUTF8toUTF16(string, str16, length + 1);
+
+   U32 generated = 0;
+   for (const UTF16* pChar = str16; *pChar != '\0'; pChar++)
+   {
+      if (mRemapTable[*pChar] == -1 && loadCharInfo(*pChar))
+         generated++;
+   }
+
+   flushGlyphAtlas();
+
+   return generated;
+}
+
+U32 GFont::prewarmRange(const U32 rangeStart, const U32 rangeEnd)
+{
+   U32 generated = 0;
+   for (U32 i = getMax(rangeStart, (U32)1); i < getMin(rangeEnd, (U32)0x10000); i++)
+   {
+      if (mRemapTable[i] == -1 && loadCharInfo((UTF16)i))
+         generated++;
+   }
+
+   flushGlyphAtlas();
+
+   return generated;
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 const PlatformFont::CharInfo &GFont::getCharInfo(const UTF16 in_charIndex)
@@ -398,6 +573,24 @@ U32 GFont::getStrWidth(const UTF8* in_pString)
    return getStrNWidth(in_pString, dStrlen(in_pString));
 }
 
+U32 GFont::getStrWidthCached(StringTableEntry string)
+{
+   AssertFatal(string != NULL, "GFont::getStrWidthCached: String is NULL, width is undefined");
+
+   // String table entries are unique so the pointer is the key.
+   typeStrWidthHash::iterator itr = mStrWidthCache.find(string);
+   if (itr != mStrWidthCache.end())
+      return itr->value;
+
+   // Keep the cache bounded for controls that churn through many strings.
+   if (mStrWidthCache.size() >= MaxStrWidthCacheSize)
+      mStrWidthCache.clear();
+
+   const U32 width = getStrWidth(string);
+   mStrWidthCache.insert(string, width);
+   return width;
+}
+
 U32 GFont::getStrWidthPrecise(const UTF8* in_pString)
 {
    AssertFatal(in_pString != NULL, "GFont::getStrWidth: String is NULL, height is undefined");
@@ -653,6 +846,15 @@ bool GFont::read(Stream& io_rStream)
    
    for(i = 0; i < numSheets; i++)
    {
+       // Headless games keep only the glyph metrics so step over the sheet.
+       if(Game->isHeadless())
+       {
+           if(!GBitmap::skipPNG(io_rStream))
+               return false;
+
+           continue;
+       }
+
        GBitmap *bmp = new GBitmap;
        if(!bmp->readPNG(io_rStream))
        {
@@ -886,6 +1088,7 @@ void GFont::importStrip(const char *fileName, U32 padding, U32 kerning)
 
    // Wipe our texture sheets.
    mCurSheet = mCurX = mCurY = 0;
+   mStrWidthCache.clear();
    mTextureSheets.clear();
 
    //  Now, load the font strip.
@@ -1210,6 +1413,10 @@ bool GFont::readBMFont(Stream& io_rStream)
         }
     }
     
+    // Headless games keep only the glyph metrics so the pages are not loaded.
+    if(Game->isHeadless())
+        numSheets = 0;
+
     for(U32 i = 0; i < numSheets; i++)
     {
         char buf[1024];
@@ -42,6 +42,9 @@
 #ifndef _RESMANAGER_H_
 #include "io/resource/resourceManager.h"
 #endif
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
 
 #include "graphics/TextureManager.h"
 
@@ -71,6 +74,9 @@ public:
    {
       TabWidthInSpaces = 3,
       TextureSheetSize = 256,
+      GlyphAtlasSheetSize = 1024,
+      GlyphAtlasPadding = 1,
+      MaxStrWidthCacheSize = 4096,
    };
 
 
@@ -98,6 +104,19 @@ private:
                                           //    be accessed through the getCharInfo(U32)
                                           //    function to account for remapping...
    S32             mRemapTable[65536];    // - Index remapping
+
+   /// String widths cached by string table entry.
+   typedef HashMap<const void*, U32> typeStrWidthHash;
+   typeStrWidthHash mStrWidthCache;
+
+   /// Glyph atlas shared by all fonts and sizes.
+   static bool smGlyphAtlasEnabled;
+   static Vector<TextureHandle> smGlyphAtlasSheets;
+   static S32 smGlyphAtlasCurX;
+   static S32 smGlyphAtlasCurY;
+   static S32 smGlyphAtlasRowHeight;
+   static bool smGlyphAtlasDirty;
+
 public:
    GFont();
    virtual ~GFont();
@@ -107,6 +126,10 @@ protected:
     void addBitmap(PlatformFont::CharInfo &charInfo);
     void addSheet(void);
     void assignSheet(S32 sheetNum, GBitmap *bmp);
+    void addAtlasBitmap(PlatformFont::CharInfo &charInfo);
+    S32 findTextureSheet(const TextureHandle& handle);
+    static void addAtlasSheet(void);
+    static void refreshGlyphAtlas(void);
 
     void *mMutex;
 
@@ -144,6 +167,22 @@ public:
 
    U32 getStrWidthPrecise(const UTF8*);   // Note: ignores c/r
    U32 getStrNWidthPrecise(const UTF8*, U32 n);
+
+   /// Cached width of a string table entry.  Prefer this for labels that rarely change.
+   U32 getStrWidthCached(StringTableEntry string);
+
+   /// Rasterize the specified characters ahead of use.  Returns the number of characters generated.
+   U32 prewarm(const UTF8* string);
+   U32 prewarmRange(const U32 rangeStart, const U32 rangeEnd);
+
+   /// Glyph atlas shared by all fonts and sizes.  Only affects characters rasterized after it is enabled.
+   static void setGlyphAtlasEnabled(const bool enabled) { smGlyphAtlasEnabled = enabled; }
+   static bool getGlyphAtlasEnabled(void) { return smGlyphAtlasEnabled; }
+   static U32 getGlyphAtlasSheetCount(void) { return smGlyphAtlasSheets.size(); }
+   static void destroyGlyphAtlas(void);
+
+   /// Upload glyphs added to the atlas since the last flush.  Call before drawing with font textures.
+   static inline void flushGlyphAtlas(void) { if (smGlyphAtlasDirty) refreshGlyphAtlas(); }
    
    void wrapString(const UTF8 *string, U32 width, Vector<U32> &startLineOffset, Vector<U32> &lineLen);
 
@@ -167,6 +206,10 @@ public:
    /// are treated as having 0 for RGB).
    bool isAlphaOnly()
    {
+      // Glyph atlas sheets are always alpha.
+      if (mTextureSheets.size() == 0)
+         return true;
+
       return mTextureSheets[0].getBitmap()->getFormat() == GBitmap::Alpha;
    }
 
@@ -188,6 +231,7 @@ public:
    void forcePlatformFont(PlatformFont  *pf)
    {
       mPlatformFont = pf;
+      mStrWidthCache.clear();
    }
 };
 
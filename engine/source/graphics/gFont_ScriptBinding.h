@@ -98,6 +98,73 @@ ConsoleFunctionWithDocs(populateFontCacheRange, ConsoleVoid, 5, 5, (faceName, si
    // All done!
 }
 
+/*! 
+    Rasterize the specified characters for a font at one or more sizes ahead of use.
+    This avoids glyphs being generated (and their textures uploaded) mid-frame.
+    @param faceName The name of the font
+    @param sizes A space-separated list of font sizes.
+    @param string The characters to rasterize.
+    @return The number of glyphs generated.
+*/
+ConsoleFunctionWithDocs(prewarmFontGlyphs, ConsoleInt, 4, 4, (faceName, sizes, string))
+{
+   U32 generated = 0;
+
+   const U32 sizeCount = StringUnit::getUnitCount(argv[2], " \t\n");
+   for (U32 i = 0; i < sizeCount; i++)
+   {
+      const U32 size = dAtoi(StringUnit::getUnit(argv[2], i, " \t\n"));
+
+      Resource<GFont> f = GFont::create(argv[1], size, Con::getVariable("$GUI::fontCacheDirectory"));
+
+      if(f.isNull())
+      {
+         Con::errorf("prewarmFontGlyphs - could not load font '%s %d'!", argv[1], size);
+         continue;
+      }
+
+      if(!f->hasPlatformFont())
+      {
+         Con::errorf("prewarmFontGlyphs - font '%s %d' has no platform font! Cannot generate more characters.", argv[1], size);
+         continue;
+      }
+
+      generated += f->prewarm(argv[3]);
+   }
+
+   return generated;
+}
+
+/*! 
+    Sets whether newly rasterized glyphs from all fonts and sizes are packed into a shared glyph atlas.
+    Text using fonts in the atlas can be drawn together without switching textures.
+    Only affects characters rasterized after the change.
+    @param enabled Whether to use the shared glyph atlas or not.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(setFontGlyphAtlasEnabled, ConsoleVoid, 2, 2, (bool enabled))
+{
+   GFont::setGlyphAtlasEnabled(dAtob(argv[1]));
+}
+
+/*! 
+    Gets whether newly rasterized glyphs are packed into the shared glyph atlas.
+    @return Whether the shared glyph atlas is in use or not.
+*/
+ConsoleFunctionWithDocs(getFontGlyphAtlasEnabled, ConsoleBool, 1, 1, ())
+{
+   return GFont::getGlyphAtlasEnabled();
+}
+
+/*! 
+    Gets the number of sheets in the shared glyph atlas.
+    @return The number of sheets in the shared glyph atlas.
+*/
+ConsoleFunctionWithDocs(getFontGlyphAtlasSheetCount, ConsoleInt, 1, 1, ())
+{
+   return GFont::getGlyphAtlasSheetCount();
+}
+
 /*! Dump a full description 
     of all cached fonts, along with info on the codepoints each contains.
     @return No return value
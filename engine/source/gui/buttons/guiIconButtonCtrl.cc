@@ -280,7 +280,7 @@ void GuiIconButtonCtrl::renderButton( Point2I &offset, const RectI& updateRect )
    if(mTextLocation != TextLocNone)
    {
       dglSetBitmapModulation( fontColor );
-      S32 textWidth = mProfile->mFont->getStrWidth(mButtonText);
+      S32 textWidth = mProfile->mFont->getStrWidthCached(mButtonText);
 
       if(mTextLocation == TextLocRight)
       {
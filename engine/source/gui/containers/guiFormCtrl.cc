@@ -191,7 +191,7 @@ void GuiFormCtrl::resize(const Point2I &newPosition, const Point2I &newExtent)
       return;
 
    // Should the caption be modified because the title bar is too small?
-   S32 textWidth = mProfile->mFont->getStrWidth(mCaption);
+   S32 textWidth = mProfile->mFont->getStrWidthCached(mCaption);
    S32 newTextArea = mBounds.extent.x - mThumbSize.x - mProfile->mBitmapArrayRects[4].extent.x;
    if(newTextArea < textWidth)
    {
@@ -552,6 +552,7 @@ void GuiEditCtrl::onRender(Point2I offset, const RectI &updateRect)
       
       // draw the points.
       glEnableClientState(GL_VERTEX_ARRAY);
+      dglFlushBatch();
       glEnable( GL_BLEND );
       glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
 
@@ -77,6 +77,7 @@ void GuiGraphCtrl::onRender(Point2I offset, const RectI &updateRect)
 		dglDrawRect(rect, mProfile->mBorderColor);
 	}
 
+	dglFlushBatch();
 	glBlendFunc(GL_SRC_COLOR, GL_ONE_MINUS_SRC_COLOR);
 	glEnable(GL_BLEND);
 	ColorF color(1.0, 1.0, 1.0, 0.5);
@@ -405,7 +405,7 @@ void GuiInspectorField::onRender(Point2I offset, const RectI &updateRect)
          dglSetClipRect( RectI( clipRect.point, Point2I( captionRect.extent.x, clipRect.extent.y ) ));
          // Draw Caption ( Vertically Centered )
          U32 textY = captionRect.point.y + captionYOffset;
-         U32 textX = captionRect.point.x + captionRect.extent.x - mProfile->mFont->getStrWidth(mCaption) - 6;
+         U32 textX = captionRect.point.x + captionRect.extent.x - mProfile->mFont->getStrWidthCached(mCaption) - 6;
          Point2I textPT(textX, textY);
 
          dglDrawText( mProfile->mFont, textPT, mCaption, &mProfile->mFontColor );
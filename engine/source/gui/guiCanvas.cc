@@ -96,6 +96,9 @@ GuiCanvas::GuiCanvas()
     /// Background color.
     mBackgroundColor.set( 0.0f, 0.0f, 0.0f, 0.0f );
     mUseBackgroundColor = true;
+
+    /// Batch rendering.
+    mBatchRendering = false;
 }
 
 GuiCanvas::~GuiCanvas()
@@ -115,6 +118,7 @@ void GuiCanvas::initPersistFields()
     // Physics.
     addField("UseBackgroundColor", TypeBool, Offset(mUseBackgroundColor, GuiCanvas), "" );
     addField("BackgroundColor", TypeColorF, Offset(mBackgroundColor, GuiCanvas), "" );
+    addField("BatchRendering", TypeBool, Offset(mBatchRendering, GuiCanvas), "Whether GUI primitives are batched to reduce draw calls." );
 }
 
 //------------------------------------------------------------------------------
@@ -1191,6 +1195,10 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
    if(preRenderOnly)
       return;
 
+   // Start a new set of draw statistics and batch the GUI if requested.
+   dglBeginFrameStats();
+   dglSetBatchEnabled( mBatchRendering );
+
    // for now, just always reset the update regions - this is a
    // fix for FSAA on ATI cards
    resetUpdateRegions();
@@ -1297,6 +1305,8 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
       //temp draw the mouse
       if (cursorON && mShowCursor && !mouseCursor)
       {
+         // Flush batched geometry so it cannot draw over the cursor.
+         dglFlushBatch();
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
          glColor4ub(255, 0, 0, 255);
          GLfloat vertices[] = {
@@ -1331,6 +1341,9 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
       }
    }
 
+   // Flush anything batched and stop batching outside of the GUI render.
+   dglSetBatchEnabled( false );
+
    PROFILE_END();
 
 
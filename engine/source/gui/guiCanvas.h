@@ -83,6 +83,9 @@ protected:
     ColorF                      mBackgroundColor;
     bool                        mUseBackgroundColor;
 
+    /// Batch rendering.
+    bool                        mBatchRendering;
+
 
    /// @name Rendering
    /// @{
@@ -179,6 +182,10 @@ public:
     inline void             setUseBackgroundColor( const bool useBackgroundColor ) { mUseBackgroundColor = useBackgroundColor; }
     inline bool             getUseBackgroundColor( void ) const         { return mUseBackgroundColor; }
 
+    /// Batch rendering.
+    inline void             setBatchRendering( const bool batchRendering ) { mBatchRendering = batchRendering; }
+    inline bool             getBatchRendering( void ) const             { return mBatchRendering; }
+
    /// @name Rendering methods
    ///
    /// @{
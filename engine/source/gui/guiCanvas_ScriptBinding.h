@@ -374,6 +374,59 @@ ConsoleMethodWithDocs(GuiCanvas, getUseBackgroundColor, ConsoleBool, 2, 2, (...)
     return object->getUseBackgroundColor();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Sets whether GUI primitives are batched to reduce draw calls or not.
+    @param batchRendering Whether GUI primitives are batched or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(GuiCanvas, setBatchRendering, ConsoleVoid, 3, 3, (...))
+{
+    // Set the flag.
+    object->setBatchRendering( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether GUI primitives are batched to reduce draw calls or not.
+    @return Whether GUI primitives are batched or not.
+*/
+ConsoleMethodWithDocs(GuiCanvas, getBatchRendering, ConsoleBool, 2, 2, (...))
+{
+    // Get the flag.
+    return object->getBatchRendering();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of draw calls issued during the last rendered frame.
+    @return The number of draw calls issued during the last rendered frame.
+*/
+ConsoleMethodWithDocs(GuiCanvas, getDrawCallCount, ConsoleInt, 2, 2, (...))
+{
+    return dglGetFrameDrawCalls();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of GUI primitives batched during the last rendered frame.
+    @return The number of GUI primitives batched during the last rendered frame.
+*/
+ConsoleMethodWithDocs(GuiCanvas, getBatchedPrimitiveCount, ConsoleInt, 2, 2, (...))
+{
+    return dglGetFrameBatchedPrimitives();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of times the GUI batch was flushed during the last rendered frame.
+    @return The number of times the GUI batch was flushed during the last rendered frame.
+*/
+ConsoleMethodWithDocs(GuiCanvas, getBatchFlushCount, ConsoleInt, 2, 2, (...))
+{
+    return dglGetFrameBatchFlushes();
+}
+
 ConsoleMethodGroupEndWithDocs(GuiCanvas)
 
 /*! Use the createCanvas function to initialize the canvas.
@@ -384,6 +437,13 @@ ConsoleFunctionWithDocs( createCanvas, ConsoleBool, 2, 2, ( WindowTitle ))
 {
     AssertISV(!Canvas, "CreateCanvas: canvas has already been instantiated");
 
+    // Headless games have no window to render into.
+    if (Game->isHeadless())
+    {
+        Con::warnf("createCanvas() - Cannot create a canvas in a headless game.");
+        return false;
+    }
+
     Platform::initWindow(Point2I(MIN_RESOLUTION_X, MIN_RESOLUTION_Y), argv[1]);
 
 
@@ -106,6 +106,7 @@ void dglDrawBlendBox(RectI &bounds, ColorF &c1, ColorF &c2, ColorF &c3, ColorF &
    S32 left = bounds.point.x, right = bounds.point.x + bounds.extent.x - 1;
    S32 top = bounds.point.y, bottom = bounds.point.y + bounds.extent.y - 1;
    
+   dglFlushBatch();
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -142,6 +143,7 @@ void dglDrawBlendRangeBox(RectI &bounds, bool vertical, U8 numColors, ColorI *co
    S32 y_inc = S32(mFloor((bottom - top) / (numColors-1)));
    
 
+   dglFlushBatch();
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -279,6 +281,7 @@ void dglDrawBlendBox(RectI &bounds, ColorF &c1, ColorF &c2, ColorF &c3, ColorF &
    F32 t = (F32)(bounds.point.y + 1);
    F32 b = (F32)(bounds.point.y + bounds.extent.y - 2);
    
+   dglFlushBatch();
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -402,6 +405,7 @@ void dglDrawBlendRangeBox(RectI &bounds, bool vertical, U8 numColors, ColorI *co
    F32 x_inc = F32((r - l) / (numColors-1));
    F32 y_inc = F32((b - t) / (numColors-1));
    
+   dglFlushBatch();
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -122,6 +122,7 @@ void GuiConsoleTextCtrl::onRender(Point2I offset, const RectI &updateRect)
 
    // draw the border
    r.extent += r.point;
+   dglFlushBatch();
    glColor4ub(0, 0, 0, 0);
 
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
@@ -674,7 +674,7 @@ void GuiListBoxCtrl::updateSize()
       S32 maxWidth = 1;
       for ( U32 i = 0; i < (U32)mItems.size(); i++ )
       {
-         S32 width = font->getStrWidth( mItems[i]->itemText );
+         S32 width = font->getStrWidthCached( mItems[i]->itemText );
          if( width > maxWidth )
             maxWidth = width;
       }
@@ -128,6 +128,13 @@ GuiMLTextCtrl::GuiMLTextCtrl()
    mLineList = 0;
    mTagList = 0;
    mHitURL = 0;
+
+   mLayoutValid = false;
+   mLayoutTextHash = 0;
+   mLayoutTextLength = 0;
+   mLayoutExtent.set(0, 0);
+   mLayoutProfile = NULL;
+   mLayoutLineSpacing = 0;
    mActive = true;
    mAlpha = 1.0;
 }
@@ -188,7 +195,43 @@ bool GuiMLTextCtrl::onWake()
 void GuiMLTextCtrl::onPreRender()
 {
    if(mDirty)
-      reflow();
+   {
+      // Selection changes and re-setting the same text only dirty the control,
+      // they don't change the layout.
+      if(isLayoutCurrent())
+         mDirty = false;
+      else
+         reflow();
+   }
+}
+
+//--------------------------------------------------------------------------
+static U32 hashTextBuffer(const UTF16* text, const U32 length)
+{
+   // FNV-1a.
+   U32 hash = 2166136261u;
+   for(U32 i = 0; i < length; i++)
+   {
+      hash ^= text[i];
+      hash *= 16777619u;
+   }
+   return hash;
+}
+
+//--------------------------------------------------------------------------
+bool GuiMLTextCtrl::isLayoutCurrent() const
+{
+   if(!mLayoutValid)
+      return false;
+
+   if(mLayoutExtent != mBounds.extent || mLayoutProfile != mProfile || mLayoutLineSpacing != mLineSpacingPixels)
+      return false;
+
+   const U32 length = mTextBuffer.length();
+   if(mLayoutTextLength != length)
+      return false;
+
+   return mLayoutTextHash == hashTextBuffer(mTextBuffer.getPtr(), length);
 }
 
 //--------------------------------------------------------------------------
@@ -331,6 +374,7 @@ void GuiMLTextCtrl::freeLineBuffers()
    mTagList = NULL;
    mHitURL = 0;
    mDirty = true;
+   mLayoutValid = false;
 }
 
 //--------------------------------------------------------------------------
@@ -365,6 +409,9 @@ void GuiMLTextCtrl::inspectPostApply()
 {
    Parent::inspectPostApply();
 
+   // Fields may have changed so force a full reflow.
+   freeLineBuffers();
+
    if (mInitialText[0] != 0)
       setText(mInitialText, dStrlen(mInitialText));
 
@@ -1932,6 +1979,14 @@ textemit:
    processEmitAtoms();
    emitNewLine(mScanPos);
    resize(mBounds.point, Point2I(mBounds.extent.x, mMaxY));
+
+   // Remember what this layout was built from.
+   mLayoutValid = true;
+   mLayoutTextLength = mTextBuffer.length();
+   mLayoutTextHash = hashTextBuffer(mTextBuffer.getPtr(), mLayoutTextLength);
+   mLayoutExtent = mBounds.extent;
+   mLayoutProfile = mProfile;
+   mLayoutLineSpacing = mLineSpacingPixels;
    Con::executef( this, 3, "onResize", Con::getIntArg( mBounds.extent.x ), Con::getIntArg( mMaxY ) );
 
    //make sure the cursor is still visible - this handles if we're a child of a scroll ctrl...
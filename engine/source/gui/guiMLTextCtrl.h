@@ -149,6 +149,7 @@ class GuiMLTextCtrl : public GuiControl
    void scrollToBottom();
 
    virtual void reflow();
+   bool isLayoutCurrent() const;
 
    DECLARE_CONOBJECT(GuiMLTextCtrl);
    static void initPersistFields();
@@ -178,6 +179,14 @@ class GuiMLTextCtrl : public GuiControl
    bool mDirty;
    Style *mCurStyle;
 
+   // Inputs to the last reflow so that redundant reflows can be skipped.
+   bool mLayoutValid;
+   U32 mLayoutTextHash;
+   U32 mLayoutTextLength;
+   Point2I mLayoutExtent;
+   GuiControlProfile *mLayoutProfile;
+   U32 mLayoutLineSpacing;
+
    U32 mCurLMargin;
    U32 mCurRMargin;
    U32 mCurJustify;
@@ -1106,6 +1106,7 @@ void GuiPopUpMenuCtrl::onRender(Point2I offset, const RectI &updateRect)
          F32 top = (F32)(r.extent.y / 2 + r.point.y - 4);
          F32 bottom = (F32)(top + 8);
 
+         dglFlushBatch();
          glBegin(GL_TRIANGLES);
          glColor3i(mProfile->mFontColor.red,mProfile->mFontColor.green,mProfile->mFontColor.blue);
          glVertex2fv( Point3F(left,top,0) );
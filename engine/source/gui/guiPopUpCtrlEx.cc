@@ -1082,6 +1082,7 @@ void GuiPopUpMenuCtrlEx::onRender(Point2I offset, const RectI &updateRect)
       F32 top = (F32)(r.extent.y / 2 + r.point.y - 4);
       F32 bottom = (F32)(top + 8);
 
+      dglFlushBatch();
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
 // PUAP -Mat untested
        glColor4ub(mProfile->mFontColor.red,mProfile->mFontColor.green,mProfile->mFontColor.blue, 255);
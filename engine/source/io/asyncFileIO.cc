@@ -0,0 +1,503 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "io/asyncFileIO.h"
+#include "io/fileStream.h"
+#include "io/memstream.h"
+#include "io/streamObject.h"
+#include "io/resource/resourceManager.h"
+#include "io/zip/zipArchive.h"
+#include "console/console.h"
+#include "memory/safeDelete.h"
+
+#include "asyncFileIO_ScriptBinding.h"
+
+AsyncFileIO *AsyncIO = NULL;
+
+//-----------------------------------------------------------------------------
+
+void AsyncFileIO::create(U32 threadCount /* = DefaultThreadCount */)
+{
+   AsyncIO = new AsyncFileIO(threadCount);
+}
+
+void AsyncFileIO::destroy()
+{
+   delete AsyncIO;
+   AsyncIO = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void AsyncFileIO::WorkerThread::run(void *arg /* = 0 */)
+{
+   for(;;)
+   {
+      mService->mWorkAvailable.acquire();
+      if(mService->mStopWorkers)
+         break;
+
+      Request *request = mService->popRequest();
+      if(request == NULL)
+         continue;
+
+      mService->performRead(request);
+
+      mService->mMutex.lock();
+      mService->mFinished.push_back(request);
+      mService->mMutex.unlock();
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+AsyncFileIO::AsyncFileIO(U32 threadCount) : mWorkAvailable(0)
+{
+   mStopWorkers = false;
+   mNextId = 1;
+
+   mCompleted = 0;
+   mCoalesced = 0;
+   mWindowStart = Platform::getRealMilliseconds();
+   mWindowBytes = 0;
+   mBytesPerSecond = 0;
+   mLatencyCount = 0;
+
+#ifndef TORQUE_OS_EMSCRIPTEN
+   for(U32 i = 0;i < getMax(threadCount, (U32)1);++i)
+   {
+      WorkerThread *thread = new WorkerThread(this);
+      thread->start();
+      mWorkers.push_back(thread);
+   }
+#endif
+}
+
+AsyncFileIO::~AsyncFileIO()
+{
+   mStopWorkers = true;
+   for(S32 i = 0;i < mWorkers.size();++i)
+      mWorkAvailable.release();
+   for(S32 i = 0;i < mWorkers.size();++i)
+   {
+      mWorkers[i]->join();
+      delete mWorkers[i];
+   }
+   mWorkers.clear();
+
+   // Everything outstanding is either queued, finished or was never handed
+   // to a worker, and all of it is in mOutstanding.
+   for(S32 i = 0;i < mOutstanding.size();++i)
+   {
+      Request *request = mOutstanding[i];
+      if(request->mBuffer)
+         freeBuffer(request->mBuffer, request->mBufferCapacity);
+      if(request->mDiskPath)
+         dFree((void *)request->mDiskPath);
+      delete request;
+   }
+   mOutstanding.clear();
+
+   for(U32 i = 0;i < PriorityCount;++i)
+      mQueues[i].clear();
+   mFinished.clear();
+
+   for(U32 i = 0;i <= MaxPooledBufferBits - MinPooledBufferBits;++i)
+   {
+      for(S32 j = 0;j < mBufferPool[i].size();++j)
+         delete [] mBufferPool[i][j];
+      mBufferPool[i].clear();
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+U8 *AsyncFileIO::allocBuffer(U32 size, U32 &capacity)
+{
+   U32 bits = MinPooledBufferBits;
+   while(bits <= MaxPooledBufferBits && (1U << bits) < size)
+      ++bits;
+
+   // Too big to pool
+   if(bits > MaxPooledBufferBits)
+   {
+      capacity = size;
+      return new U8[size];
+   }
+
+   capacity = 1 << bits;
+
+   U8 *buffer = NULL;
+   mMutex.lock();
+   VectorPtr<U8 *> &pool = mBufferPool[bits - MinPooledBufferBits];
+   if(pool.size())
+   {
+      buffer = pool.last();
+      pool.pop_back();
+   }
+   mMutex.unlock();
+
+   return buffer ? buffer : new U8[capacity];
+}
+
+void AsyncFileIO::freeBuffer(U8 *buffer, U32 capacity)
+{
+   U32 bits = MinPooledBufferBits;
+   while(bits <= MaxPooledBufferBits && (1U << bits) != capacity)
+      ++bits;
+
+   if(bits <= MaxPooledBufferBits)
+   {
+      mMutex.lock();
+      VectorPtr<U8 *> &pool = mBufferPool[bits - MinPooledBufferBits];
+      bool pooled = pool.size() < MaxPooledBuffersPerSize;
+      if(pooled)
+         pool.push_back(buffer);
+      mMutex.unlock();
+
+      if(pooled)
+         return;
+   }
+
+   delete [] buffer;
+}
+
+//-----------------------------------------------------------------------------
+
+AsyncFileIO::Request *AsyncFileIO::popRequest()
+{
+   Request *request = NULL;
+
+   mMutex.lock();
+   for(S32 i = PriorityCount - 1;i >= 0 && request == NULL;--i)
+   {
+      if(mQueues[i].size())
+      {
+         request = mQueues[i].front();
+         mQueues[i].pop_front();
+      }
+   }
+   mMutex.unlock();
+
+   return request;
+}
+
+// Files in a mapped zip can be read without the archive's shared stream
+static bool canReadOffThread(Zip::ZipArchive *zip, const Zip::CentralDir *cd)
+{
+   return zip->isMapped() && (cd->mFlags & Zip::Encrypted) == 0 &&
+      (cd->mCompressMethod == Zip::Stored || cd->mCompressMethod == Zip::Deflated);
+}
+
+void AsyncFileIO::performRead(Request *request)
+{
+   // This may run on a worker, so it must not touch the console.
+   FileStream fileStream;
+   Stream *stream = NULL;
+
+   if(request->mZip)
+      stream = request->mZip->openFileForRead(request->mCentralDir);
+   else if(Platform::isFile(request->mDiskPath) && fileStream.open(request->mDiskPath, FileStream::Read))
+      stream = &fileStream;
+
+   if(stream == NULL)
+      return;
+
+   U32 total = stream->getStreamSize();
+   if(request->mOffset <= total)
+   {
+      U32 count = total - request->mOffset;
+      if(request->mSize)
+         count = getMin(count, request->mSize);
+
+      request->mBuffer = allocBuffer(getMax(count, (U32)1), request->mBufferCapacity);
+
+      request->mSuccess = (request->mOffset == 0 || stream->setPosition(request->mOffset)) &&
+         stream->read(count, request->mBuffer);
+      request->mBytesRead = request->mSuccess ? count : 0;
+   }
+
+   if(request->mZip)
+      request->mZip->closeFile(stream);
+   else
+      fileStream.close();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AsyncFileIO::read(const char *filename, Callback callback, void *userData, Priority priority /* = PriorityNormal */, U32 offset /* = 0 */, U32 size /* = 0 */)
+{
+   if(filename == NULL || *filename == 0 || callback == NULL)
+      return 0;
+
+   S32 pri = mClamp((S32)priority, (S32)PriorityLow, (S32)PriorityCritical);
+
+   Waiter waiter;
+   waiter.mId = mNextId++;
+   if(mNextId == 0)
+      mNextId = 1;
+   waiter.mCallback = callback;
+   waiter.mUserData = userData;
+   waiter.mSubmitTime = Platform::getRealMilliseconds();
+
+   StringTableEntry name = StringTable->insert(filename);
+
+   // Coalesce with an identical outstanding request
+   for(S32 i = 0;i < mOutstanding.size();++i)
+   {
+      Request *request = mOutstanding[i];
+      if(request->mFilename != name || request->mOffset != offset || request->mSize != size)
+         continue;
+
+      request->mWaiters.push_back(waiter);
+      ++mCoalesced;
+
+      if(pri > request->mPriority)
+      {
+         // Move it up if no worker has picked it up yet
+         mMutex.lock();
+         VectorPtr<Request *> &queue = mQueues[request->mPriority];
+         for(S32 j = 0;j < queue.size();++j)
+         {
+            if(queue[j] == request)
+            {
+               queue.erase(queue.begin() + j);
+               mQueues[pri].push_back(request);
+               request->mPriority = pri;
+               break;
+            }
+         }
+         mMutex.unlock();
+      }
+
+      return waiter.mId;
+   }
+
+   Request *request = new Request;
+   request->mFilename = name;
+   request->mDiskPath = NULL;
+   request->mOffset = offset;
+   request->mSize = size;
+   request->mPriority = pri;
+   request->mZip = NULL;
+   request->mCentralDir = NULL;
+   request->mBuffer = NULL;
+   request->mBufferCapacity = 0;
+   request->mBytesRead = 0;
+   request->mSuccess = false;
+   request->mWaiters.push_back(waiter);
+
+   // The resource manager isn't thread safe, so resolve the file here
+   ResourceObject *obj = ResourceManager ? ResourceManager->find(filename) : NULL;
+   if(obj && (obj->flags & ResourceObject::VolumeBlock) && obj->mZipArchive && obj->mCentralDir)
+   {
+      request->mZip = obj->mZipArchive;
+      request->mCentralDir = obj->mCentralDir;
+   }
+   else
+   {
+      char path[1024];
+      if(obj)
+         ResourceManager->getFullPath(filename, path, sizeof(path));
+      else
+         dStrncpy(path, filename, sizeof(path));
+      path[sizeof(path) - 1] = 0;
+
+      request->mDiskPath = dStrdup(path);
+   }
+
+   mOutstanding.push_back(request);
+
+   if(mWorkers.empty() || (request->mZip && ! canReadOffThread(request->mZip, request->mCentralDir)))
+   {
+      // Read now; the callback still comes from process()
+      performRead(request);
+
+      mMutex.lock();
+      mFinished.push_back(request);
+      mMutex.unlock();
+   }
+   else
+   {
+      mMutex.lock();
+      mQueues[pri].push_back(request);
+      mMutex.unlock();
+
+      mWorkAvailable.release();
+   }
+
+   return waiter.mId;
+}
+
+bool AsyncFileIO::cancel(U32 requestId)
+{
+   for(S32 i = 0;i < mOutstanding.size();++i)
+   {
+      Request *request = mOutstanding[i];
+
+      bool found = false, anyLeft = false;
+      for(S32 j = 0;j < request->mWaiters.size();++j)
+      {
+         Waiter &waiter = request->mWaiters[j];
+         if(waiter.mId == requestId && waiter.mCallback)
+         {
+            waiter.mCallback = NULL;
+            found = true;
+         }
+         else if(waiter.mCallback)
+            anyLeft = true;
+      }
+
+      if(! found)
+         continue;
+
+      if(! anyLeft)
+      {
+         // Nobody wants it, so drop it if it hasn't been started
+         bool removed = false;
+
+         mMutex.lock();
+         VectorPtr<Request *> &queue = mQueues[request->mPriority];
+         for(S32 j = 0;j < queue.size();++j)
+         {
+            if(queue[j] == request)
+            {
+               queue.erase(queue.begin() + j);
+               removed = true;
+               break;
+            }
+         }
+         mMutex.unlock();
+
+         if(removed)
+         {
+            mOutstanding.erase(mOutstanding.begin() + i);
+            dFree((void *)request->mDiskPath);
+            delete request;
+         }
+      }
+
+      return true;
+   }
+
+   return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void AsyncFileIO::process()
+{
+   mMutex.lock();
+   VectorPtr<Request *> finished;
+   finished = mFinished;
+   mFinished.clear();
+   mMutex.unlock();
+
+   for(S32 i = 0;i < finished.size();++i)
+      deliver(finished[i]);
+
+   U32 now = Platform::getRealMilliseconds();
+   U32 elapsed = now - mWindowStart;
+   if(elapsed >= 1000)
+   {
+      mBytesPerSecond = (U32)((U64)mWindowBytes * 1000 / elapsed);
+      mWindowBytes = 0;
+      mWindowStart = now;
+   }
+}
+
+void AsyncFileIO::deliver(Request *request)
+{
+   // Take it off the outstanding list first so that callbacks making the
+   // same request again get a fresh read.
+   for(S32 i = 0;i < mOutstanding.size();++i)
+   {
+      if(mOutstanding[i] == request)
+      {
+         mOutstanding.erase(mOutstanding.begin() + i);
+         break;
+      }
+   }
+
+   Result result;
+   result.mFilename = request->mFilename;
+   result.mOffset = request->mOffset;
+   result.mData = request->mBuffer;
+   result.mSize = request->mBytesRead;
+   result.mSuccess = request->mSuccess;
+
+   U32 now = Platform::getRealMilliseconds();
+   for(S32 i = 0;i < request->mWaiters.size();++i)
+   {
+      const Waiter &waiter = request->mWaiters[i];
+      if(waiter.mCallback == NULL)
+         continue;
+
+      mLatencies[mLatencyCount % LatencySampleCount] = now - waiter.mSubmitTime;
+      ++mLatencyCount;
+      ++mCompleted;
+
+      result.mRequestId = waiter.mId;
+      waiter.mCallback(result, waiter.mUserData);
+   }
+
+   mWindowBytes += request->mBytesRead;
+
+   if(request->mBuffer)
+      freeBuffer(request->mBuffer, request->mBufferCapacity);
+   if(request->mDiskPath)
+      dFree((void *)request->mDiskPath);
+   delete request;
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareLatency(const void *a, const void *b)
+{
+   U32 la = *(const U32 *)a, lb = *(const U32 *)b;
+   return la < lb ? -1 : (la > lb ? 1 : 0);
+}
+
+void AsyncFileIO::getStats(Stats &stats)
+{
+   stats.mInFlight = mOutstanding.size();
+   stats.mCompleted = mCompleted;
+   stats.mCoalesced = mCoalesced;
+   stats.mBytesPerSecond = mBytesPerSecond;
+
+   stats.mQueued = 0;
+   mMutex.lock();
+   for(U32 i = 0;i < PriorityCount;++i)
+      stats.mQueued += mQueues[i].size();
+   mMutex.unlock();
+
+   U32 count = getMin(mLatencyCount, (U32)LatencySampleCount);
+   stats.mP99LatencyMs = 0;
+   if(count)
+   {
+      U32 sorted[LatencySampleCount];
+      dMemcpy(sorted, mLatencies, count * sizeof(U32));
+      dQsort(sorted, count, sizeof(U32), compareLatency);
+
+      stats.mP99LatencyMs = sorted[(count * 99 + 99) / 100 - 1];
+   }
+}
@@ -0,0 +1,228 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ASYNCFILEIO_H_
+#define _ASYNCFILEIO_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+namespace Zip
+{
+   class ZipArchive;
+   class CentralDir;
+}
+
+/// Background file reading service.
+///
+/// Files, or byte ranges within them, are read on a pool of worker threads
+/// and the results are handed back on the main thread from process(), which
+/// is called once per frame by the main loop. This keeps blocking reads off
+/// the main thread and is intended as the basis for streaming in assets,
+/// textures and audio.
+///
+/// Like the TelnetConsole, there is a single global instance:
+///
+/// @code
+///      static void onLoaded(const AsyncFileIO::Result &result, void *userData)
+///      {
+///         if(result.mSuccess)
+///            parseLevel(result.mData, result.mSize);
+///      }
+///
+///      AsyncIO->read("game/data/level1.taml", onLoaded, NULL);
+/// @endcode
+///
+/// Requests are serviced highest priority first, then in the order they were
+/// made. Identical requests (same file, offset and size) that arrive while
+/// one is still outstanding are coalesced into a single read, and each
+/// caller gets its own callback.
+///
+/// Result buffers come from a pool and are only valid for the duration of
+/// the callback. Copy anything that needs to be kept.
+///
+/// Files inside zips are read on the workers when the zip is memory mapped.
+/// Otherwise the zip's shared stream can't be used off the main thread, so
+/// the read happens when the request is made and only the callback is
+/// deferred. The same applies to every read on platforms without threads,
+/// such as Emscripten, where no workers are started.
+class AsyncFileIO
+{
+public:
+   enum Priority
+   {
+      PriorityLow,
+      PriorityNormal,
+      PriorityHigh,
+      PriorityCritical,
+
+      PriorityCount
+   };
+
+   enum
+   {
+      DefaultThreadCount = 2,
+      LatencySampleCount = 1024,   ///< Number of recent latencies kept for the p99
+      MinPooledBufferBits = 12,    ///< Smallest pooled buffer is 4KB
+      MaxPooledBufferBits = 24,    ///< Largest pooled buffer is 16MB
+      MaxPooledBuffersPerSize = 4
+   };
+
+   /// Passed to the completion callback
+   struct Result
+   {
+      U32 mRequestId;
+      StringTableEntry mFilename;
+      U32 mOffset;
+      const U8 *mData;        ///< Valid only for the duration of the callback
+      U32 mSize;
+      bool mSuccess;
+   };
+
+   typedef void (*Callback)(const Result &result, void *userData);
+
+   /// Snapshot of the queue, see getStats()
+   struct Stats
+   {
+      U32 mInFlight;          ///< Requests queued or being read
+      U32 mQueued;            ///< Requests waiting for a worker
+      U32 mCompleted;         ///< Callbacks made since startup
+      U32 mCoalesced;         ///< Requests that were merged into an outstanding one
+      U32 mBytesPerSecond;    ///< Bytes delivered over the last second
+      U32 mP99LatencyMs;      ///< 99th percentile of request to callback time
+   };
+
+protected:
+   struct Waiter
+   {
+      U32 mId;
+      Callback mCallback;
+      void *mUserData;
+      U32 mSubmitTime;
+   };
+
+   struct Request
+   {
+      StringTableEntry mFilename;
+      const char *mDiskPath;
+      U32 mOffset;
+      U32 mSize;              ///< 0 to read to the end of the file
+      S32 mPriority;
+
+      Zip::ZipArchive *mZip;
+      const Zip::CentralDir *mCentralDir;
+
+      Vector<Waiter> mWaiters;
+
+      // Filled in by the worker
+      U8 *mBuffer;
+      U32 mBufferCapacity;
+      U32 mBytesRead;
+      bool mSuccess;
+   };
+
+   class WorkerThread : public Thread
+   {
+      AsyncFileIO *mService;
+
+   public:
+      WorkerThread(AsyncFileIO *service) : Thread(0, 0, false), mService(service) {}
+      virtual void run(void *arg = 0);
+   };
+
+   // Shared with the workers, guarded by mMutex
+   Mutex mMutex;
+   VectorPtr<Request *> mQueues[PriorityCount];
+   VectorPtr<Request *> mFinished;
+   VectorPtr<U8 *> mBufferPool[MaxPooledBufferBits - MinPooledBufferBits + 1];
+   Semaphore mWorkAvailable;
+   volatile bool mStopWorkers;
+
+   // Main thread only
+   VectorPtr<WorkerThread *> mWorkers;
+   VectorPtr<Request *> mOutstanding;
+   U32 mNextId;
+
+   U32 mCompleted;
+   U32 mCoalesced;
+   U32 mWindowStart;
+   U32 mWindowBytes;
+   U32 mBytesPerSecond;
+   U32 mLatencies[LatencySampleCount];
+   U32 mLatencyCount;
+
+   AsyncFileIO(U32 threadCount);
+   ~AsyncFileIO();
+
+   Request *popRequest();
+   void performRead(Request *request);
+   void deliver(Request *request);
+
+   U8 *allocBuffer(U32 size, U32 &capacity);
+   void freeBuffer(U8 *buffer, U32 capacity);
+
+public:
+   static void create(U32 threadCount = DefaultThreadCount);   ///< Start the service
+   static void destroy();                                      ///< Stop the workers and drop outstanding requests
+
+   /// Called by the main loop to deliver finished reads
+   void process();
+
+   /// Request a read of a file or part of one.
+   ///
+   /// @param filename  Path of the file, resolved through the resource manager
+   /// @param callback  Called on the main thread when the read finishes or fails
+   /// @param userData  Passed to the callback
+   /// @param priority  One of the Priority values
+   /// @param offset    Byte offset to start reading from
+   /// @param size      Number of bytes to read, or 0 for the rest of the file
+   /// @return A request ID for cancel(), or 0 if the request could not be made
+   U32 read(const char *filename, Callback callback, void *userData, Priority priority = PriorityNormal, U32 offset = 0, U32 size = 0);
+
+   /// Cancel a request. Its callback will not be called. The read itself may
+   /// still happen if it was already started or shared with other requests.
+   /// @return true if the request was outstanding
+   bool cancel(U32 requestId);
+
+   void getStats(Stats &stats);
+};
+
+extern AsyncFileIO *AsyncIO;
+
+#endif // _ASYNCFILEIO_H_
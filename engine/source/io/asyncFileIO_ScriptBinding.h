@@ -0,0 +1,123 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @defgroup AsyncFileIOFunctions Async File I/O
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+static const struct
+{
+   const char *strPriority;
+   AsyncFileIO::Priority priority;
+} gPriorityMap[]=
+{
+   { "low", AsyncFileIO::PriorityLow },
+   { "normal", AsyncFileIO::PriorityNormal },
+   { "high", AsyncFileIO::PriorityHigh },
+   { "critical", AsyncFileIO::PriorityCritical },
+   { NULL, (AsyncFileIO::Priority)0 }
+};
+
+static void scriptReadCallback(const AsyncFileIO::Result &result, void *userData)
+{
+   char id[16], size[16], streamId[16];
+   dSprintf(id, sizeof(id), "%u", result.mRequestId);
+   dSprintf(size, sizeof(size), "%u", result.mSize);
+
+   // The data is handed to script as a read only StreamObject. Like the
+   // result buffer, it only lives for the duration of the callback.
+   if(result.mSuccess && result.mSize > 0)
+   {
+      MemStream stream(result.mSize, (void *)result.mData, true, false);
+      StreamObject *so = new StreamObject(&stream);
+      so->registerObject();
+      dSprintf(streamId, sizeof(streamId), "%d", so->getId());
+
+      Con::executef(6, (StringTableEntry)userData, id, result.mFilename, "1", size, streamId);
+
+      so->setStream(NULL);
+      so->deleteObject();
+      return;
+   }
+
+   Con::executef(6, (StringTableEntry)userData, id, result.mFilename, result.mSuccess ? "1" : "0", size, "0");
+}
+
+/*! Read a file on a background thread
+    @param filename The file to read
+    @param callback The function to call when the read finishes, as callback(%requestId, %filename, %success, %size, %stream).
+    %stream is a StreamObject holding the data, or 0 if the read failed or the file is empty. It is deleted when the callback returns.
+    @param priority One of low, normal, high or critical (default normal)
+    @return Returns the request ID, or 0 if the request could not be made
+    @sa cancelAsyncRead, getAsyncIOStats
+*/
+ConsoleFunctionWithDocs(asyncReadFile, ConsoleInt, 3, 4, (filename, callback, [priority=normal]?))
+{
+   if(AsyncIO == NULL)
+      return 0;
+
+   AsyncFileIO::Priority priority = AsyncFileIO::PriorityNormal;
+   if(argc > 3)
+   {
+      for(S32 i = 0;gPriorityMap[i].strPriority;++i)
+      {
+         if(dStricmp(gPriorityMap[i].strPriority, argv[3]) == 0)
+         {
+            priority = gPriorityMap[i].priority;
+            break;
+         }
+      }
+   }
+
+   char filename[1024];
+   Con::expandPath(filename, sizeof(filename), argv[1]);
+
+   return AsyncIO->read(filename, scriptReadCallback, (void *)StringTable->insert(argv[2]), priority);
+}
+
+/*! Cancel a read started with asyncReadFile(). Its callback will not be called.
+    @param requestId The ID returned by asyncReadFile()
+    @return Returns true if the request was still outstanding
+*/
+ConsoleFunctionWithDocs(cancelAsyncRead, ConsoleBool, 2, 2, (requestId))
+{
+   return AsyncIO && AsyncIO->cancel(dAtoi(argv[1]));
+}
+
+/*! Get the state of the async read queue
+    @return Returns "inFlight queued completed coalesced bytesPerSecond p99LatencyMs"
+*/
+ConsoleFunctionWithDocs(getAsyncIOStats, ConsoleString, 1, 1, ())
+{
+   AsyncFileIO::Stats stats;
+   dMemset(&stats, 0, sizeof(stats));
+   if(AsyncIO)
+      AsyncIO->getStats(stats);
+
+   char *ret = Con::getReturnBuffer(128);
+   dSprintf(ret, 128, "%u %u %u %u %u %u", stats.mInFlight, stats.mQueued, stats.mCompleted,
+      stats.mCoalesced, stats.mBytesPerSecond, stats.mP99LatencyMs);
+   return ret;
+}
+
+/*! @} */ // group AsyncFileIOFunctions
@@ -26,9 +26,11 @@
 #include "io/filterStream.h"
 #include "io/zip/zipCryptStream.h"
 #include "algorithm/crc.h"
+#include "algorithm/hashFunction.h"
 #include "io/resource/resourceManager.h"
 
 #include "console/console.h"
+#include "debug/profiler.h"
 
 #include "io/zip/zipArchive.h"
 #include "io/zip/compressor.h"
@@ -55,6 +57,7 @@ ZipArchive::ZipArchive()
    mMode = Read;
    
    mDiskStream = NULL;
+   mMappedStream = NULL;
 
    mFilename = NULL;
 
@@ -111,13 +114,115 @@ bool ZipArchive::readCentralDirectory()
       insertEntry(ze);
    }
 
+   if(mMode == Read)
+      buildIndex();
+
    return true;
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+static U32 normalizeZipPath(char *dest, U32 destSize, const char *path)
+{
+   U32 len = 0;
+   for(;path[len] && len < destSize - 1;++len)
+      dest[len] = path[len] == '\\' ? '/' : path[len];
+   dest[len] = 0;
+
+   return len;
+}
+
+void ZipArchive::buildIndex()
+{
+   PROFILE_SCOPE(ZipArchive_BuildIndex);
+
+   // Keep the load factor at or below 0.5 so probes stay short
+   U32 size = 16;
+   while(size < (U32)mEntries.size() * 2)
+      size <<= 1;
+
+   mIndex.setSize(size);
+   dMemset(mIndex.address(), 0, size * sizeof(IndexSlot));
+
+   char path[1024];
+   for(S32 i = 0;i < mEntries.size();++i)
+   {
+      U32 len = normalizeZipPath(path, sizeof(path), mEntries[i]->mCD.mFilename);
+      U32 h = hash((U8 *)path, len, 0);
+
+      U32 slot = h & (size - 1);
+      while(mIndex[slot].mEntry)
+         slot = (slot + 1) & (size - 1);
+
+      mIndex[slot].mHash = h;
+      mIndex[slot].mEntry = mEntries[i];
+   }
+}
+
+ZipArchive::ZipEntry *ZipArchive::findIndexedEntry(const char *filename)
+{
+   char path[1024];
+   U32 len = normalizeZipPath(path, sizeof(path), filename);
+   U32 h = hash((U8 *)path, len, 0);
+
+   U32 mask = mIndex.size() - 1;
+   for(U32 slot = h & mask;mIndex[slot].mEntry;slot = (slot + 1) & mask)
+   {
+      if(mIndex[slot].mHash != h)
+         continue;
+
+      // Compare against the stored name, treating both slashes as equal
+      const char *name = mIndex[slot].mEntry->mCD.mFilename;
+      U32 j = 0;
+      while(j < len && name[j] && (name[j] == path[j] || (name[j] == '\\' && path[j] == '/')))
+         ++j;
+
+      if(j == len && name[j] == 0)
+         return mIndex[slot].mEntry;
+   }
+
+   return NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+const U8 *ZipArchive::getMappedFileData(const CentralDir *fileCD)
+{
+   if(! mMappedFile.isOpen() || (fileCD->mInternalFlags & (CDFileDirty | CDFileDeleted)) != 0)
+      return NULL;
+
+   // The local header may have a different sized extra field to the central
+   // directory, so the data offset has to come from the local header itself.
+   const U32 localHeaderSize = 30;
+   const U8 *base = mMappedFile.getData();
+   U32 size = mMappedFile.getSize();
+   U32 offset = fileCD->mLocalHeadOffset;
+
+   if(offset > size || size - offset < localHeaderSize)
+      return NULL;
+
+   const U8 *header = base + offset;
+   // Local file header signature, as FileHeader::mFileHeaderSignature
+   U32 sig = header[0] | (header[1] << 8) | (header[2] << 16) | ((U32)header[3] << 24);
+   if(sig != 0x04034b50)
+      return NULL;
+
+   U32 filenameLen = header[26] | (header[27] << 8);
+   U32 extraLen = header[28] | (header[29] << 8);
+
+   U32 dataOffset = offset + localHeaderSize + filenameLen + extraLen;
+   if(dataOffset > size || size - dataOffset < fileCD->mCompressedSize)
+      return NULL;
+
+   return base + dataOffset;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 void ZipArchive::insertEntry(ZipEntry *ze)
 {
+   mIndex.clear();
+
    char path[1024];
    dStrncpy(path, ze->mCD.mFilename, sizeof(path));
    path[sizeof(path) - 1] = 0;
@@ -192,6 +297,8 @@ void ZipArchive::removeEntry(ZipEntry *ze)
    // Can't iterate the hash table, so we can't do this safely
    AssertFatal(!ze->mIsDirectory, "ZipArchive::removeEntry - Cannot remove a directory");
 
+   mIndex.clear();
+
    // See if we have a temporary file for this entry
    VectorPtr<ZipTempStream *>::iterator i;
    for(i = mTempFiles.begin();i != mTempFiles.end();++i)
@@ -232,6 +339,15 @@ CentralDir *ZipArchive::findFileInfo(const char *filename)
 
 ZipArchive::ZipEntry *ZipArchive::findZipEntry(const char *filename)
 {
+   if(mIndex.size())
+   {
+      ZipEntry *ze = findIndexedEntry(filename);
+      if(ze)
+         return ze;
+
+      // Not a file, but it may still be a directory
+   }
+
    char path[1024];
    dStrncpy(path, filename, sizeof(path));
    path[sizeof(path) - 1] = 0;
@@ -528,6 +644,18 @@ bool ZipArchive::openArchive(const char *filename, AccessMode mode /* = Read */)
 
    closeArchive();
 
+   if(mode == Read && ! Con::getBoolVariable("$Pref::Zip::DisableMemoryMapping") && mMappedFile.open(filename))
+   {
+      setFilename(filename);
+
+      mMappedStream = new MemStream(mMappedFile.getSize(), (void *)mMappedFile.getData(), true, false);
+      if(openArchive(mMappedStream, mode))
+         return true;
+
+      // Fall back to the disk stream
+      closeArchive();
+   }
+
    mDiskStream = new FileStream;
    if(mDiskStream->open(filename, (FileStream::AccessMode)mode))
    {
@@ -593,6 +721,10 @@ void ZipArchive::closeArchive()
       mDiskStream = NULL;
    }
 
+   SAFE_DELETE(mMappedStream);
+   mMappedFile.close();
+   mIndex.clear();
+
    mStream = NULL;
 
    SAFE_FREE(mFilename);
@@ -656,6 +788,13 @@ void ZipArchive::closeFile(Stream *stream)
       delete currentStream;
    }
 
+   ZipMappedStream *mappedStream = dynamic_cast<ZipMappedStream *>(stream);
+   if(mappedStream)
+   {
+      delete mappedStream;
+      return;
+   }
+
    ZipTempStream *tempStream = dynamic_cast<ZipTempStream *>(stream);
    if(tempStream && (tempStream->getCentralDir()->mInternalFlags & CDFileOpen))
    {
@@ -675,6 +814,17 @@ Stream *ZipArchive::openFileForRead(const CentralDir *fileCD)
    if((fileCD->mInternalFlags & (CDFileDeleted | CDFileOpen)) != 0)
       return NULL;
 
+   // Unencrypted files in a mapped archive don't need the shared stream
+   if((fileCD->mFlags & Encrypted) == 0 && (fileCD->mCompressMethod == Stored || fileCD->mCompressMethod == Deflated))
+   {
+      const U8 *data = getMappedFileData(fileCD);
+      if(data)
+      {
+         bool deflated = fileCD->mCompressMethod == Deflated;
+         return new ZipMappedStream(data, fileCD->mCompressedSize, deflated ? fileCD->mUncompressedSize : fileCD->mCompressedSize, deflated);
+      }
+   }
+
    Stream *stream = mStream;
 
    if(fileCD->mInternalFlags & CDFileDirty)
@@ -760,6 +910,47 @@ Stream *ZipArchive::openFileForRead(const CentralDir *fileCD)
    return comp->createReadStream(fileCD, attachTo);
 }
 
+bool ZipArchive::readFile(const CentralDir *fileCD, void *buffer, U32 bufferSize)
+{
+   PROFILE_SCOPE(ZipArchive_ReadFile);
+
+   if(bufferSize < fileCD->mUncompressedSize)
+      return false;
+
+   if(fileCD->mUncompressedSize == 0)
+      return true;
+
+   if((fileCD->mFlags & Encrypted) == 0)
+   {
+      const U8 *data = getMappedFileData(fileCD);
+      if(data && fileCD->mCompressMethod == Stored)
+      {
+         dMemcpy(buffer, data, fileCD->mUncompressedSize);
+         return true;
+      }
+
+      if(data && fileCD->mCompressMethod == Deflated)
+         return ZipMappedStream::inflateToBuffer(data, fileCD->mCompressedSize, buffer, fileCD->mUncompressedSize);
+   }
+
+   Stream *stream = openFileForRead(fileCD);
+   if(stream == NULL)
+      return false;
+
+   bool ret = stream->read(fileCD->mUncompressedSize, buffer);
+   closeFile(stream);
+
+   return ret;
+}
+
+const U8 *ZipArchive::getStoredFileData(const CentralDir *fileCD)
+{
+   if(fileCD->mCompressMethod != Stored || (fileCD->mFlags & Encrypted) != 0)
+      return NULL;
+
+   return getMappedFileData(fileCD);
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 bool ZipArchive::addFile(const char *filename, const char *pathInZip, bool replace /* = true */)
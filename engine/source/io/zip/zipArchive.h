@@ -23,8 +23,10 @@
 #include "io/zip/fileHeader.h"
 #include "io/zip/centralDir.h"
 #include "io/zip/compressor.h"
+#include "io/zip/zipMappedStream.h"
 
 #include "io/fileStream.h"
+#include "io/memstream.h"
 
 #include "collection/simpleHashTable.h"
 #include "collection/vector.h"
@@ -183,6 +185,10 @@ class ZipTempStream;
 ///   <li> Files can only be open as #Read or #Write, but not #ReadWrite
 ///   <li> Only one file can be open for read at a time, but multiple files can
 ///        be open for write at a time. - [tom, 2/9/2007] Check this
+///   <li> The exception to the above is archives opened for #Read from a file,
+///        which are memory mapped where the platform supports it. Files that
+///        are stored or deflated (and not encrypted) are then read directly
+///        from the mapping, so any number of them may be open at once.
 /// </ul>
 /// 
 /// See the following method documentation for more information:
@@ -299,6 +305,11 @@ protected:
    FileStream *mDiskStream;
    AccessMode mMode;
 
+   // Archives opened for Read from a file are mapped, and mStream is then
+   // a MemStream over the mapping rather than mDiskStream.
+   ZipMappedFile mMappedFile;
+   MemStream *mMappedStream;
+
    EndOfCentralDir mEOCD;
 
    // mRoot forms a tree of entries for fast queries given a file path
@@ -306,12 +317,27 @@ protected:
    ZipEntry *mRoot;
    VectorPtr<ZipEntry *> mEntries;
 
+   // Open addressed hash of full path to file entry, built once after the
+   // central directory is read for archives opened as Read. Any change to
+   // the entries clears it and lookups go back to walking mRoot.
+   struct IndexSlot
+   {
+      U32 mHash;
+      ZipEntry *mEntry;
+   };
+   Vector<IndexSlot> mIndex;
+
    const char *mFilename;
 
    VectorPtr<ZipTempStream *> mTempFiles;
 
    bool readCentralDirectory();
 
+   void buildIndex();
+   ZipEntry *findIndexedEntry(const char *path);
+
+   const U8 *getMappedFileData(const CentralDir *fileCD);
+
    void insertEntry(ZipEntry *ze);
    void removeEntry(ZipEntry *ze);
    
@@ -331,9 +357,6 @@ protected:
    bool rebuildZip();
    bool copyFileToNewZip(CentralDir *cdir, Stream *newZipStream);
    bool writeDirtyFileToNewZip(ZipTempStream *fileStream, Stream *zipStream);
-
-   U32 localTimeToDOSTime(const Platform::LocalTime &t);
-   U32 currentTimeToDOSTime();
    
 public:
    ZipArchive();
@@ -387,6 +410,11 @@ public:
    /// @see ZipArchive::isVerbose()
    //////////////////////////////////////////////////////////////////////////
    void setVerbose(bool verbose);
+
+   /// Convert a local time to the packed DOS date and time used in zip headers
+   static U32 localTimeToDOSTime(const Platform::LocalTime &t);
+   /// Get the current time as a packed DOS date and time
+   static U32 currentTimeToDOSTime();
    // @}
 
    /// @name Archive Access Methods
@@ -477,6 +505,40 @@ public:
    /// @see ZipArchive::openFile(const char *, AccessMode), ZipArchive::closeFile()
    //////////////////////////////////////////////////////////////////////////
    Stream *openFileForRead(const CentralDir *fileCD);
+
+   //////////////////////////////////////////////////////////////////////////
+   /// @brief Read the entire contents of a file in the zip into a buffer
+   ///
+   /// For memory mapped archives, stored files are copied straight out of the
+   /// mapping and deflated files are inflated directly into the buffer. Other
+   /// archives fall back to reading through openFileForRead().
+   ///
+   /// @param fileCD Pointer to central directory of the file to read
+   /// @param buffer Buffer to receive the uncompressed file
+   /// @param bufferSize Size of buffer, which must be at least the uncompressed size of the file
+   /// @return true for success, false for failure
+   //////////////////////////////////////////////////////////////////////////
+   bool readFile(const CentralDir *fileCD, void *buffer, U32 bufferSize);
+
+   //////////////////////////////////////////////////////////////////////////
+   /// @brief Get a pointer to the data of a stored file in a mapped archive
+   ///
+   /// The returned pointer is a view into the mapping and remains valid until
+   /// the archive is closed.
+   ///
+   /// @param fileCD Pointer to central directory of the file
+   /// @return Pointer to the file data, or NULL if the archive is not mapped
+   ///         or the file is compressed or encrypted
+   //////////////////////////////////////////////////////////////////////////
+   const U8 *getStoredFileData(const CentralDir *fileCD);
+
+   //////////////////////////////////////////////////////////////////////////
+   /// @brief Determine if the archive is memory mapped
+   ///
+   /// Memory mapping can be disabled by setting $Pref::Zip::DisableMemoryMapping
+   /// to true before the archive is opened.
+   //////////////////////////////////////////////////////////////////////////
+   bool isMapped() const                              { return mMappedFile.isOpen(); }
    // @}
 
    /// @name Archiver Style File Access Methods
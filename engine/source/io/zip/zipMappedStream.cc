@@ -0,0 +1,332 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/platform.h"
+#include "io/zip/zipMappedStream.h"
+
+#include "zlib.h"
+
+#if defined(TORQUE_OS_WIN32)
+#include "platformWin32/platformWin32.h"
+#define TORQUE_ZIP_MMAP_WIN32
+#elif defined(TORQUE_OS_LINUX) || defined(TORQUE_OS_OSX) || defined(TORQUE_OS_IOS) || defined(TORQUE_OS_FREEBSD) || defined(TORQUE_OS_OPENBSD)
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define TORQUE_ZIP_MMAP_POSIX
+#endif
+
+namespace Zip
+{
+
+//////////////////////////////////////////////////////////////////////////
+// ZipMappedFile
+//////////////////////////////////////////////////////////////////////////
+
+ZipMappedFile::ZipMappedFile() : mData(NULL), mSize(0)
+{
+#ifdef TORQUE_OS_WIN32
+   mFileHandle = NULL;
+   mMapHandle = NULL;
+#endif
+}
+
+ZipMappedFile::~ZipMappedFile()
+{
+   close();
+}
+
+bool ZipMappedFile::open(const char *filename)
+{
+   close();
+
+#if defined(TORQUE_ZIP_MMAP_POSIX)
+   int fd = ::open(filename, O_RDONLY);
+   if(fd == -1)
+      return false;
+
+   struct stat st;
+   if(fstat(fd, &st) == -1 || st.st_size <= 0 || (U64)st.st_size > 0xffffffffULL)
+   {
+      ::close(fd);
+      return false;
+   }
+
+   void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+   // The mapping holds its own reference to the file
+   ::close(fd);
+
+   if(data == MAP_FAILED)
+      return false;
+
+   mData = (U8 *)data;
+   mSize = (U32)st.st_size;
+   return true;
+
+#elif defined(TORQUE_ZIP_MMAP_WIN32)
+   HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+   if(file == INVALID_HANDLE_VALUE)
+      return false;
+
+   DWORD sizeHigh = 0;
+   DWORD size = GetFileSize(file, &sizeHigh);
+   if(size == INVALID_FILE_SIZE || size == 0 || sizeHigh != 0)
+   {
+      CloseHandle(file);
+      return false;
+   }
+
+   HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+   if(mapping == NULL)
+   {
+      CloseHandle(file);
+      return false;
+   }
+
+   void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+   if(data == NULL)
+   {
+      CloseHandle(mapping);
+      CloseHandle(file);
+      return false;
+   }
+
+   mFileHandle = file;
+   mMapHandle = mapping;
+   mData = (U8 *)data;
+   mSize = size;
+   return true;
+
+#else
+   // No mapping support, the archive will use a FileStream instead
+   return false;
+#endif
+}
+
+void ZipMappedFile::close()
+{
+   if(mData == NULL)
+      return;
+
+#if defined(TORQUE_ZIP_MMAP_POSIX)
+   munmap(mData, mSize);
+#elif defined(TORQUE_ZIP_MMAP_WIN32)
+   UnmapViewOfFile(mData);
+   CloseHandle((HANDLE)mMapHandle);
+   CloseHandle((HANDLE)mFileHandle);
+   mMapHandle = NULL;
+   mFileHandle = NULL;
+#endif
+
+   mData = NULL;
+   mSize = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// ZipMappedStream
+//////////////////////////////////////////////////////////////////////////
+
+ZipMappedStream::ZipMappedStream(const U8 *data, U32 compressedSize, U32 uncompressedSize, bool deflated)
+ : mData(data),
+   mCompressedSize(compressedSize),
+   mUncompressedSize(uncompressedSize),
+   mPosition(0),
+   mZipStream(NULL)
+{
+   if(deflated)
+   {
+      mZipStream = new z_stream_s;
+      mZipStream->zalloc = Z_NULL;
+      mZipStream->zfree  = Z_NULL;
+      mZipStream->opaque = Z_NULL;
+      mZipStream->next_in  = Z_NULL;
+      mZipStream->avail_in = 0;
+
+      if(inflateInit2(mZipStream, -MAX_WBITS) != Z_OK)
+      {
+         delete mZipStream;
+         mZipStream = NULL;
+         setStatus(IOError);
+         return;
+      }
+
+      resetInflate();
+   }
+
+   setStatus(Ok);
+}
+
+ZipMappedStream::~ZipMappedStream()
+{
+   if(mZipStream)
+   {
+      inflateEnd(mZipStream);
+      delete mZipStream;
+      mZipStream = NULL;
+   }
+
+   setStatus(Closed);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+bool ZipMappedStream::resetInflate()
+{
+   if(inflateReset(mZipStream) != Z_OK)
+      return false;
+
+   // The whole compressed file is in memory, so inflate() never needs refilling
+   mZipStream->next_in  = (Bytef *)mData;
+   mZipStream->avail_in = mCompressedSize;
+   mPosition = 0;
+
+   return true;
+}
+
+bool ZipMappedStream::_read(const U32 in_numBytes, void *out_pBuffer)
+{
+   AssertFatal(getStatus() != Closed, "Attempted read from a closed stream");
+
+   if(in_numBytes == 0)
+      return true;
+
+   AssertFatal(out_pBuffer != NULL, "Invalid output buffer");
+
+   bool success = true;
+   U32 actualBytes = in_numBytes;
+   if((mPosition + in_numBytes) > mUncompressedSize)
+   {
+      success = false;
+      actualBytes = mUncompressedSize - mPosition;
+   }
+
+   if(mZipStream == NULL)
+   {
+      dMemcpy(out_pBuffer, mData + mPosition, actualBytes);
+      mPosition += actualBytes;
+   }
+   else if(actualBytes > 0)
+   {
+      mZipStream->next_out  = (Bytef *)out_pBuffer;
+      mZipStream->avail_out = actualBytes;
+
+      S32 ret = inflate(mZipStream, Z_SYNC_FLUSH);
+      mPosition += actualBytes - mZipStream->avail_out;
+
+      if((ret != Z_OK && ret != Z_STREAM_END) || mZipStream->avail_out != 0)
+      {
+         setStatus(IOError);
+         return false;
+      }
+   }
+
+   setStatus(success ? Ok : EOS);
+   return success;
+}
+
+bool ZipMappedStream::_write(const U32 in_numBytes, const void *in_pBuffer)
+{
+   AssertWarn(false, "ZipMappedStream::_write - Files in mapped zips are read only");
+   setStatus(IllegalCall);
+   return false;
+}
+
+bool ZipMappedStream::hasCapability(const Capability in_cap) const
+{
+   if(getStatus() == Closed)
+      return false;
+
+   return (U32(in_cap) & (U32(Stream::StreamRead) | U32(Stream::StreamPosition))) != 0;
+}
+
+U32 ZipMappedStream::getPosition() const
+{
+   return mPosition;
+}
+
+bool ZipMappedStream::setPosition(const U32 in_newPosition)
+{
+   if(in_newPosition > mUncompressedSize)
+   {
+      setStatus(UnknownError);
+      return false;
+   }
+
+   if(mZipStream)
+   {
+      // As with ZipSubRStream, seeking a compressed file means inflating
+      // everything up to the new position.
+      if(in_newPosition < mPosition && ! resetInflate())
+      {
+         setStatus(IOError);
+         return false;
+      }
+
+      U8 skipBuffer[2048];
+      while(mPosition < in_newPosition)
+      {
+         U32 skip = in_newPosition - mPosition;
+         if(skip > sizeof(skipBuffer))
+            skip = sizeof(skipBuffer);
+         if(! _read(skip, skipBuffer))
+            return false;
+      }
+   }
+   else
+      mPosition = in_newPosition;
+
+   setStatus(mPosition == mUncompressedSize ? EOS : Ok);
+   return true;
+}
+
+U32 ZipMappedStream::getStreamSize()
+{
+   return mUncompressedSize;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+bool ZipMappedStream::inflateToBuffer(const U8 *src, U32 srcSize, void *dst, U32 dstSize)
+{
+   z_stream_s zs;
+   zs.zalloc = Z_NULL;
+   zs.zfree  = Z_NULL;
+   zs.opaque = Z_NULL;
+   zs.next_in  = (Bytef *)src;
+   zs.avail_in = srcSize;
+
+   if(inflateInit2(&zs, -MAX_WBITS) != Z_OK)
+      return false;
+
+   zs.next_out  = (Bytef *)dst;
+   zs.avail_out = dstSize;
+
+   S32 ret = inflate(&zs, Z_FINISH);
+   inflateEnd(&zs);
+
+   return ret == Z_STREAM_END && zs.avail_out == 0;
+}
+
+} // end namespace Zip
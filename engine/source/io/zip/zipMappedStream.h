@@ -0,0 +1,119 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ZIPMAPPEDSTREAM_H_
+#define _ZIPMAPPEDSTREAM_H_
+
+#ifndef _STREAM_H_
+#include "io/stream.h"
+#endif
+
+struct z_stream_s;
+
+namespace Zip
+{
+
+/// @addtogroup zipint_group
+/// @ingroup zip_group
+// @{
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Read only memory mapping of a zip file on disk
+///
+/// Archives opened for Read are mapped in their entirety so that the central
+/// directory and the file data can be accessed without seeking a shared
+/// FileStream. Platforms without a mapping API (or files that can't be
+/// mapped) fail open() and the archive falls back to regular stream access.
+//////////////////////////////////////////////////////////////////////////
+class ZipMappedFile
+{
+protected:
+   U8 *mData;
+   U32 mSize;
+
+#ifdef TORQUE_OS_WIN32
+   void *mFileHandle;
+   void *mMapHandle;
+#endif
+
+public:
+   ZipMappedFile();
+   ~ZipMappedFile();
+
+   bool open(const char *filename);
+   void close();
+
+   bool isOpen() const                    { return mData != NULL; }
+   const U8 *getData() const              { return mData; }
+   U32 getSize() const                    { return mSize; }
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Stream over a single file in a memory mapped zip
+///
+/// Stored files are served directly from the mapping and getBuffer() exposes
+/// the data without copying. Deflated files are inflated straight from the
+/// mapping into the buffer passed to read(), so no intermediate input buffer
+/// is needed. Unlike the FileStream based path, any number of these may be
+/// open on the same archive at once.
+///
+/// ZipMappedStream is not a FilterStream, so it is freed by
+/// ResManager::closeStream() and ZipArchive::closeFile() like a FileStream.
+//////////////////////////////////////////////////////////////////////////
+class ZipMappedStream : public Stream
+{
+   typedef Stream Parent;
+
+protected:
+   const U8 *mData;
+   U32 mCompressedSize;
+   U32 mUncompressedSize;
+   U32 mPosition;
+
+   z_stream_s *mZipStream;
+
+   bool resetInflate();
+
+   bool _read(const U32 in_numBytes, void *out_pBuffer);
+   bool _write(const U32 in_numBytes, const void *in_pBuffer);
+
+public:
+   ZipMappedStream(const U8 *data, U32 compressedSize, U32 uncompressedSize, bool deflated);
+   virtual ~ZipMappedStream();
+
+   /// Returns the file data if it is stored uncompressed, or NULL if it is deflated
+   const U8 *getBuffer() const            { return mZipStream ? NULL : mData; }
+
+   bool hasCapability(const Capability) const;
+   U32  getPosition() const;
+   bool setPosition(const U32 in_newPosition);
+   U32  getStreamSize();
+
+   /// Inflate a raw deflate stream directly into a caller supplied buffer
+   static bool inflateToBuffer(const U8 *src, U32 srcSize, void *dst, U32 dstSize);
+};
+
+// @}
+
+} // end namespace Zip
+
+#endif // _ZIPMAPPEDSTREAM_H_
@@ -0,0 +1,518 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/platform.h"
+#include "io/zip/zipParallelWriter.h"
+#include "io/fileStream.h"
+#include "console/console.h"
+#include "debug/profiler.h"
+#include "memory/safeDelete.h"
+
+#include "zlib.h"
+
+#include "zipParallelWriter_ScriptBinding.h"
+
+namespace Zip
+{
+
+//////////////////////////////////////////////////////////////////////////
+// Worker Thread
+//////////////////////////////////////////////////////////////////////////
+
+void ZipParallelWriter::WorkerThread::run(void *arg /* = 0 */)
+{
+   for(;;)
+   {
+      mWriter->mWorkAvailable.acquire();
+
+      Job *job = mWriter->popJob();
+      if(job == NULL)
+      {
+         // Woken with an empty queue means we're shutting down
+         if(mWriter->mStopWorkers)
+            break;
+         continue;
+      }
+
+      mWriter->compressJob(job);
+
+      mWriter->mQueueMutex.lock();
+      job->mDone = true;
+      mWriter->mQueueMutex.unlock();
+
+      mWriter->mWorkDone.release();
+   }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor/Destructor
+//////////////////////////////////////////////////////////////////////////
+
+ZipParallelWriter::ZipParallelWriter() : mWorkAvailable(0), mWorkDone(0)
+{
+   mThreadCount = 4;
+   mChunkSize = 1024 * 1024;
+   mCompressionLevel = Z_DEFAULT_COMPRESSION;
+
+   mBytesIn = 0;
+   mBytesOut = 0;
+
+   mStopWorkers = false;
+}
+
+ZipParallelWriter::~ZipParallelWriter()
+{
+   clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Protected Methods
+//////////////////////////////////////////////////////////////////////////
+
+ZipParallelWriter::Job *ZipParallelWriter::popJob()
+{
+   Job *job = NULL;
+
+   mQueueMutex.lock();
+   if(mQueue.size())
+   {
+      job = mQueue.front();
+      mQueue.pop_front();
+   }
+   mQueueMutex.unlock();
+
+   return job;
+}
+
+void ZipParallelWriter::compressJob(Job *job)
+{
+   z_stream_s zs;
+   zs.zalloc = Z_NULL;
+   zs.zfree  = Z_NULL;
+   zs.opaque = Z_NULL;
+
+   job->mCRC32 = crc32(crc32(0, Z_NULL, 0), job->mInput, job->mInputSize);
+
+   if(deflateInit2(&zs, mCompressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+   {
+      job->mFailed = true;
+      return;
+   }
+
+   if(job->mDictionarySize)
+      deflateSetDictionary(&zs, job->mDictionary, job->mDictionarySize);
+
+   // Room for the worst case plus the empty block written by the sync flush
+   U32 outputSize = deflateBound(&zs, job->mInputSize) + 16;
+   job->mOutput = new U8[outputSize];
+
+   zs.next_in   = job->mInput;
+   zs.avail_in  = job->mInputSize;
+   zs.next_out  = job->mOutput;
+   zs.avail_out = outputSize;
+
+   // Every chunk but the last ends on a byte aligned sync flush so the next
+   // chunk's output can simply be appended.
+   S32 ret = deflate(&zs, job->mLastChunk ? Z_FINISH : Z_SYNC_FLUSH);
+   job->mOutputSize = outputSize - zs.avail_out;
+   job->mFailed = job->mLastChunk ? ret != Z_STREAM_END : (ret != Z_OK || zs.avail_in != 0);
+
+   deflateEnd(&zs);
+
+   SAFE_DELETE_ARRAY(job->mInput);
+   SAFE_DELETE_ARRAY(job->mDictionary);
+}
+
+void ZipParallelWriter::waitForJob(Job *job)
+{
+   for(;;)
+   {
+      mQueueMutex.lock();
+      bool done = job->mDone;
+      mQueueMutex.unlock();
+
+      if(done)
+         return;
+
+      // Any job finishing wakes us, so check again
+      mWorkDone.acquire();
+   }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Public Methods
+//////////////////////////////////////////////////////////////////////////
+
+void ZipParallelWriter::addFile(const char *diskPath, const char *pathInZip)
+{
+   Entry entry;
+   entry.mDiskPath = dStrdup(diskPath);
+   entry.mZipPath = dStrdup(pathInZip);
+
+   // Zip paths always use forward slashes
+   for(char *ptr = entry.mZipPath;*ptr;++ptr)
+   {
+      if(*ptr == '\\')
+         *ptr = '/';
+   }
+
+   mEntries.push_back(entry);
+}
+
+static S32 QSORT_CALLBACK compareFileInfo(const void *a, const void *b)
+{
+   const Platform::FileInfo *fa = (const Platform::FileInfo *)a;
+   const Platform::FileInfo *fb = (const Platform::FileInfo *)b;
+
+   S32 ret = dStrcmp(fa->pFullPath, fb->pFullPath);
+   return ret ? ret : dStrcmp(fa->pFileName, fb->pFileName);
+}
+
+U32 ZipParallelWriter::addDirectory(const char *dirPath, const char *zipPrefix /* = NULL */)
+{
+   char basePath[1024];
+   Platform::makeFullPathName(dirPath, basePath, sizeof(basePath));
+
+   U32 baseLen = dStrlen(basePath);
+   while(baseLen && (basePath[baseLen - 1] == '/' || basePath[baseLen - 1] == '\\'))
+      basePath[--baseLen] = 0;
+
+   Vector<Platform::FileInfo> files;
+   if(! Platform::dumpPath(basePath, files))
+      return 0;
+
+   // Directory listings come back in file system order
+   dQsort(files.address(), files.size(), sizeof(Platform::FileInfo), compareFileInfo);
+
+   char diskPath[1024], zipPath[1024];
+   for(S32 i = 0;i < files.size();++i)
+   {
+      dSprintf(diskPath, sizeof(diskPath), "%s/%s", files[i].pFullPath, files[i].pFileName);
+
+      const char *relPath = diskPath + baseLen;
+      while(*relPath == '/' || *relPath == '\\')
+         ++relPath;
+
+      if(zipPrefix && *zipPrefix)
+         dSprintf(zipPath, sizeof(zipPath), "%s/%s", zipPrefix, relPath);
+      else
+         dStrcpy(zipPath, relPath);
+
+      addFile(diskPath, zipPath);
+   }
+
+   return files.size();
+}
+
+void ZipParallelWriter::clear()
+{
+   for(S32 i = 0;i < mEntries.size();++i)
+   {
+      dFree(mEntries[i].mDiskPath);
+      dFree(mEntries[i].mZipPath);
+   }
+   mEntries.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void ZipParallelWriter::freeJob(Job *job)
+{
+   SAFE_DELETE_ARRAY(job->mInput);
+   SAFE_DELETE_ARRAY(job->mDictionary);
+   SAFE_DELETE_ARRAY(job->mOutput);
+   delete job;
+}
+
+static bool writeLocalHeader(Stream *stream, CentralDir *cd)
+{
+   FileHeader fh(*cd);
+   fh.mFilename = NULL;
+   fh.setFilename(cd->mFilename);
+
+   return fh.write(stream);
+}
+
+bool ZipParallelWriter::write(const char *zipFilename)
+{
+   PROFILE_SCOPE(ZipParallelWriter_Write);
+
+   mBytesIn = 0;
+   mBytesOut = 0;
+
+   FileStream zipStream;
+   if(! zipStream.open(zipFilename, FileStream::Write))
+   {
+      Con::errorf("ZipParallelWriter::write - Could not create %s", zipFilename);
+      return false;
+   }
+
+   // Start the workers
+   mStopWorkers = false;
+   VectorPtr<WorkerThread *> workers;
+   for(U32 i = 0;i < mThreadCount;++i)
+   {
+      WorkerThread *thread = new WorkerThread(this);
+      thread->start();
+      workers.push_back(thread);
+   }
+
+   const U32 dosTime = ZipArchive::currentTimeToDOSTime();
+   const U32 maxInFlight = mThreadCount * 2;
+
+   VectorPtr<CentralDir *> centralDirs;
+   VectorPtr<Job *> inFlight;
+   Vector<S32> inFlightEntry;
+
+   // Reader state. Files are read chunk by chunk on this thread, possibly
+   // several files ahead of the one being written.
+   S32 readEntry = 0;
+   FileStream readStream;
+   U32 readRemaining = 0;
+   bool readOpen = false;
+   U8 *tail = new U8[csmDictionarySize];
+   U32 tailSize = 0;
+
+   // Writer state
+   U32 crc = 0;
+   bool ok = true;
+
+   while(ok)
+   {
+      // Keep the workers fed
+      while(ok && (U32)inFlight.size() < maxInFlight && readEntry < mEntries.size())
+      {
+         if(! readOpen)
+         {
+            if(! readStream.open(mEntries[readEntry].mDiskPath, FileStream::Read))
+            {
+               Con::errorf("ZipParallelWriter::write - Could not open %s", mEntries[readEntry].mDiskPath);
+               ok = false;
+               break;
+            }
+
+            readOpen = true;
+            readRemaining = readStream.getStreamSize();
+            tailSize = 0;
+         }
+
+         Job *job = new Job;
+         job->mInputSize = getMin(readRemaining, mChunkSize);
+         job->mInput = new U8[getMax(job->mInputSize, (U32)1)];
+         job->mDictionarySize = tailSize;
+         job->mDictionary = tailSize ? new U8[tailSize] : NULL;
+         if(tailSize)
+            dMemcpy(job->mDictionary, tail, tailSize);
+         job->mOutput = NULL;
+         job->mOutputSize = 0;
+         job->mCRC32 = 0;
+         job->mFailed = false;
+         job->mDone = false;
+
+         if(job->mInputSize && ! readStream.read(job->mInputSize, job->mInput))
+         {
+            Con::errorf("ZipParallelWriter::write - Error reading %s", mEntries[readEntry].mDiskPath);
+            freeJob(job);
+            ok = false;
+            break;
+         }
+
+         readRemaining -= job->mInputSize;
+         job->mLastChunk = readRemaining == 0;
+
+         // The end of this chunk primes the next one
+         tailSize = getMin(job->mInputSize, csmDictionarySize);
+         dMemcpy(tail, job->mInput + job->mInputSize - tailSize, tailSize);
+
+         inFlight.push_back(job);
+         inFlightEntry.push_back(readEntry);
+
+         mQueueMutex.lock();
+         mQueue.push_back(job);
+         mQueueMutex.unlock();
+         mWorkAvailable.release();
+
+         if(job->mLastChunk)
+         {
+            readStream.close();
+            readOpen = false;
+            ++readEntry;
+         }
+      }
+
+      if(! ok || inFlight.empty())
+         break;
+
+      // Write out the oldest chunk
+      Job *job = inFlight.front();
+      S32 entryIdx = inFlightEntry.front();
+      waitForJob(job);
+      inFlight.pop_front();
+      inFlightEntry.pop_front();
+
+      if(job->mFailed)
+      {
+         Con::errorf("ZipParallelWriter::write - Error compressing %s", mEntries[entryIdx].mDiskPath);
+         freeJob(job);
+         ok = false;
+         break;
+      }
+
+      if(centralDirs.size() == entryIdx)
+      {
+         // First chunk of a new file
+         CentralDir *cd = new CentralDir;
+         cd->setFilename(mEntries[entryIdx].mZipPath);
+         cd->mCompressMethod = Deflated;
+         cd->mVersionMadeBy = (TORQUE_GAME_ENGINE / 100) & 0xff;
+         cd->mExtractVer = 20;
+         cd->mModTime = dosTime & 0x0000ffff;
+         cd->mModDate = (dosTime & 0xffff0000) >> 16;
+         cd->mLocalHeadOffset = zipStream.getPosition();
+         centralDirs.push_back(cd);
+
+         // Sizes and CRC are filled in once the last chunk is written
+         writeLocalHeader(&zipStream, cd);
+         crc = job->mCRC32;
+      }
+      else
+         crc = crc32_combine(crc, job->mCRC32, job->mInputSize);
+
+      CentralDir *cd = centralDirs.last();
+      cd->mUncompressedSize += job->mInputSize;
+      cd->mCompressedSize += job->mOutputSize;
+      mBytesIn += job->mInputSize;
+      mBytesOut += job->mOutputSize;
+
+      ok = zipStream.write(job->mOutputSize, job->mOutput);
+
+      if(ok && job->mLastChunk)
+      {
+         cd->mCRC32 = crc;
+
+         U32 endPos = zipStream.getPosition();
+         ok = zipStream.setPosition(cd->mLocalHeadOffset) && writeLocalHeader(&zipStream, cd) && zipStream.setPosition(endPos);
+      }
+
+      freeJob(job);
+
+      // Zip offsets are 32 bit
+      if(mBytesOut >= 0xffffffffULL - 0xffff)
+      {
+         Con::errorf("ZipParallelWriter::write - %s would exceed 4GB, which requires Zip64", zipFilename);
+         ok = false;
+      }
+   }
+
+   if(readOpen)
+      readStream.close();
+   delete [] tail;
+
+   // Stop the workers, then free anything left over from a failure
+   mStopWorkers = true;
+   for(S32 i = 0;i < workers.size();++i)
+      mWorkAvailable.release();
+   for(S32 i = 0;i < workers.size();++i)
+   {
+      workers[i]->join();
+      delete workers[i];
+   }
+
+   mQueue.clear();
+   for(S32 i = 0;i < inFlight.size();++i)
+      freeJob(inFlight[i]);
+
+   // Write central directory
+   if(ok)
+   {
+      EndOfCentralDir eocd;
+      eocd.mCDOffset = zipStream.getPosition();
+
+      for(S32 i = 0;i < centralDirs.size() && ok;++i)
+         ok = centralDirs[i]->write(&zipStream);
+
+      eocd.mCDSize = zipStream.getPosition() - eocd.mCDOffset;
+      eocd.mNumEntriesInThisCD = centralDirs.size();
+      eocd.mTotalEntriesInCD = centralDirs.size();
+
+      ok = ok && eocd.write(&zipStream);
+   }
+
+   for(S32 i = 0;i < centralDirs.size();++i)
+      delete centralDirs[i];
+
+   zipStream.close();
+
+   if(! ok)
+      Platform::fileDelete(zipFilename);
+
+   return ok;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+U32 ZipParallelWriter::packModules(const char *sourcePath, const char *outputPath, U32 threadCount)
+{
+   char fullSource[1024], fullOutput[1024];
+   Platform::makeFullPathName(sourcePath, fullSource, sizeof(fullSource));
+   Platform::makeFullPathName(outputPath, fullOutput, sizeof(fullOutput));
+
+   Vector<StringTableEntry> modules;
+   if(! Platform::dumpDirectories(fullSource, modules, 1, true))
+   {
+      Con::errorf("ZipParallelWriter::packModules - Could not read %s", fullSource);
+      return 0;
+   }
+
+   ZipParallelWriter writer;
+   writer.setThreadCount(threadCount);
+
+   U32 written = 0;
+   char modulePath[1024], zipPath[1024];
+   for(S32 i = 0;i < modules.size();++i)
+   {
+      const char *name = modules[i];
+      while(*name == '/')
+         ++name;
+      if(*name == 0)
+         continue;
+
+      dSprintf(modulePath, sizeof(modulePath), "%s/%s", fullSource, name);
+      dSprintf(zipPath, sizeof(zipPath), "%s/%s.zip", fullOutput, name);
+
+      writer.clear();
+      if(writer.addDirectory(modulePath) == 0)
+         continue;
+
+      U32 start = Platform::getRealMilliseconds();
+      if(! writer.write(zipPath))
+         continue;
+
+      Con::printf("Packed %s: %d files, %u -> %u bytes in %d ms", zipPath, writer.getFileCount(),
+         (U32)writer.getBytesIn(), (U32)writer.getBytesOut(), Platform::getRealMilliseconds() - start);
+      ++written;
+   }
+
+   return written;
+}
+
+} // end namespace Zip
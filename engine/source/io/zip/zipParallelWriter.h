@@ -0,0 +1,183 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ZIPPARALLELWRITER_H_
+#define _ZIPPARALLELWRITER_H_
+
+#ifndef _ZIPARCHIVE_H_
+#include "io/zip/zipArchive.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+namespace Zip
+{
+
+/// @addtogroup zip_group
+// @{
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Multi-threaded writer for building new zip files
+///
+/// ZipArchive deflates each file through a ZipSubWStream into a temporary
+/// file and copies them all into the zip when it is closed, one at a time.
+/// ZipParallelWriter is intended for packaging large sets of files: files
+/// are queued with addFile() or addDirectory() and write() deflates them
+/// on a pool of worker threads, streaming the results straight into the
+/// new zip.
+///
+/// Every file is split into chunks of getChunkSize() bytes that are
+/// compressed independently, so a single large file keeps all the workers
+/// busy. Each chunk is primed with the last 32KB of the chunk before it
+/// and ends on a sync flush, so the chunks concatenate into one ordinary
+/// deflate stream that any zip reader can inflate.
+///
+/// The output does not depend on the number of threads. Files are written
+/// in the order they were added, and addDirectory() adds files sorted by
+/// path, so the same input always produces the same zip.
+///
+/// @code
+/// Zip::ZipParallelWriter writer;
+/// writer.addDirectory("modules/Sandbox");
+/// writer.write("modules/Sandbox.zip");
+/// @endcode
+//////////////////////////////////////////////////////////////////////////
+class ZipParallelWriter
+{
+public:
+   /// Size of the deflate window, and so of the dictionary carried between chunks
+   static const U32 csmDictionarySize = 32 * 1024;
+
+protected:
+   struct Entry
+   {
+      char *mDiskPath;
+      char *mZipPath;
+   };
+
+   /// A chunk of a file to be compressed by a worker
+   struct Job
+   {
+      U8 *mInput;
+      U32 mInputSize;
+
+      U8 *mDictionary;
+      U32 mDictionarySize;
+
+      bool mLastChunk;
+
+      U8 *mOutput;
+      U32 mOutputSize;
+      U32 mCRC32;
+      bool mFailed;
+
+      volatile bool mDone;
+   };
+
+   class WorkerThread : public Thread
+   {
+      ZipParallelWriter *mWriter;
+
+   public:
+      WorkerThread(ZipParallelWriter *writer) : Thread(0, 0, false), mWriter(writer) {}
+      virtual void run(void *arg = 0);
+   };
+
+   Vector<Entry> mEntries;
+
+   U32 mThreadCount;
+   U32 mChunkSize;
+   S32 mCompressionLevel;
+
+   U64 mBytesIn;
+   U64 mBytesOut;
+
+   // Shared with the worker threads
+   Mutex mQueueMutex;
+   Semaphore mWorkAvailable;
+   Semaphore mWorkDone;
+   VectorPtr<Job *> mQueue;
+   volatile bool mStopWorkers;
+
+   static void freeJob(Job *job);
+
+   Job *popJob();
+   void compressJob(Job *job);
+   void waitForJob(Job *job);
+
+public:
+   ZipParallelWriter();
+   virtual ~ZipParallelWriter();
+
+   /// Set the number of worker threads. The default is 4.
+   void setThreadCount(U32 count)            { mThreadCount = getMax(count, (U32)1); }
+   U32 getThreadCount() const                { return mThreadCount; }
+
+   /// Set the size of the chunks files are split into. The default is 1MB.
+   void setChunkSize(U32 size)               { mChunkSize = getMax(size, csmDictionarySize); }
+   U32 getChunkSize() const                  { return mChunkSize; }
+
+   /// Set the zlib compression level, from 1 (fastest) to 9 (smallest)
+   void setCompressionLevel(S32 level)       { mCompressionLevel = level; }
+
+   /// Queue a file on disk to be added to the zip as pathInZip
+   void addFile(const char *diskPath, const char *pathInZip);
+
+   /// Queue every file under a directory, sorted by path. Paths in the zip
+   /// are relative to the directory, optionally under a prefix.
+   /// @return The number of files queued
+   U32 addDirectory(const char *dirPath, const char *zipPrefix = NULL);
+
+   U32 getFileCount() const                  { return mEntries.size(); }
+
+   /// Remove all queued files
+   void clear();
+
+   /// Compress all queued files and write them to a new zip
+   /// @return true for success, false for failure
+   bool write(const char *zipFilename);
+
+   /// Uncompressed and compressed bytes written by the last call to write()
+   U64 getBytesIn() const                    { return mBytesIn; }
+   U64 getBytesOut() const                   { return mBytesOut; }
+
+   /// Build a zip for every module directory directly under sourcePath,
+   /// writing outputPath/&lt;module&gt;.zip for each.
+   /// @return The number of zips written
+   static U32 packModules(const char *sourcePath, const char *outputPath, U32 threadCount);
+};
+
+// @}
+
+} // end namespace Zip
+
+#endif // _ZIPPARALLELWRITER_H_
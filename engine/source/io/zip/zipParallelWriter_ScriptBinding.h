@@ -0,0 +1,82 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @defgroup ZipFunctions Zip
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Build a zip of every file under a directory, compressing on several threads
+    @param sourcePath The directory to pack. Paths in the zip are relative to it.
+    @param zipFile The zip file to create
+    @param threads The number of compression threads (default 4)
+    @param chunkSizeKB The size in KB that large files are split into for compression (default 1024)
+    @return Returns true on success, false otherwise
+    @sa packModules
+*/
+ConsoleFunctionWithDocs(packDirectory, ConsoleBool, 3, 5, (sourcePath, zipFile, [threads=4]?, [chunkSizeKB=1024]?))
+{
+   char sourcePath[1024], zipFile[1024];
+   Con::expandPath(sourcePath, sizeof(sourcePath), argv[1]);
+   Con::expandPath(zipFile, sizeof(zipFile), argv[2]);
+
+   Zip::ZipParallelWriter writer;
+   if(argc > 3)
+      writer.setThreadCount(dAtoi(argv[3]));
+   if(argc > 4)
+      writer.setChunkSize(dAtoi(argv[4]) * 1024);
+
+   if(writer.addDirectory(sourcePath) == 0)
+   {
+      Con::errorf("packDirectory - No files found in %s", sourcePath);
+      return false;
+   }
+
+   U32 start = Platform::getRealMilliseconds();
+   if(! writer.write(zipFile))
+      return false;
+
+   Con::printf("packDirectory - %s: %d files, %u -> %u bytes in %d ms on %d threads", zipFile, writer.getFileCount(),
+      (U32)writer.getBytesIn(), (U32)writer.getBytesOut(), Platform::getRealMilliseconds() - start, writer.getThreadCount());
+   return true;
+}
+
+/*! Build a zip for each module directory directly under sourcePath. Each
+    module is written to outputPath/<module>.zip, which the resource manager
+    will mount in place of the directory.
+    This can also be run from the command line with -packModules sourcePath outputPath [threads].
+    @param sourcePath The directory containing the module directories
+    @param outputPath The directory to write the zips to
+    @param threads The number of compression threads (default 4)
+    @return Returns the number of zips written
+    @sa packDirectory
+*/
+ConsoleFunctionWithDocs(packModules, ConsoleInt, 3, 4, (sourcePath, outputPath, [threads=4]?))
+{
+   char sourcePath[1024], outputPath[1024];
+   Con::expandPath(sourcePath, sizeof(sourcePath), argv[1]);
+   Con::expandPath(outputPath, sizeof(outputPath), argv[2]);
+
+   return Zip::ZipParallelWriter::packModules(sourcePath, outputPath, argc > 3 ? dAtoi(argv[3]) : 4);
+}
+
+/*! @} */ // group ZipFunctions
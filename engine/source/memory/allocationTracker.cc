@@ -0,0 +1,239 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "memory/allocationTracker.h"
+#include "platform/threads/mutex.h"
+#include "console/console.h"
+#include "math/mMathFn.h"
+#include <stdlib.h>
+
+#include "allocationTracker_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+// Tags are allocated with malloc() so that tracking dMalloc can't recurse.
+static const U32 TagHashSize = 1024;
+
+static AllocationTracker::Tag *sTagList = NULL;
+static AllocationTracker::Tag *sTagHash[TagHashSize];
+static U32 sTagCount = 0;
+static U32 sReportTime = 0;
+static Mutex *sTagMutex = NULL;
+
+static Mutex *getTagMutex()
+{
+   // Created on first use as dMalloc can be called during static init
+   if(sTagMutex == NULL)
+      sTagMutex = new Mutex;
+   return sTagMutex;
+}
+
+static U32 hashTag(const char *name, U32 line)
+{
+   U32 hash = 2166136261U ^ line;
+   for(const char *c = name;*c;++c)
+      hash = (hash ^ (U8)*c) * 16777619U;
+   return hash;
+}
+
+static AllocationTracker::Tag *findTagLocked(const char *name, U32 line)
+{
+   if(name == NULL)
+      name = "unknown";
+
+   U32 bucket = hashTag(name, line) % TagHashSize;
+   for(AllocationTracker::Tag *tag = sTagHash[bucket];tag;tag = tag->mHashNext)
+   {
+      if(tag->mLine == line && (tag->mName == name || dStrcmp(tag->mName, name) == 0))
+         return tag;
+   }
+
+   AllocationTracker::Tag *tag = (AllocationTracker::Tag *)malloc(sizeof(AllocationTracker::Tag));
+   dMemset(tag, 0, sizeof(AllocationTracker::Tag));
+   tag->mName = name;
+   tag->mLine = line;
+
+   tag->mNext = sTagList;
+   sTagList = tag;
+   tag->mHashNext = sTagHash[bucket];
+   sTagHash[bucket] = tag;
+
+   if(sTagCount++ == 0)
+      sReportTime = Platform::getRealMilliseconds();
+
+   return tag;
+}
+
+// File tags are reported by file name only
+static const char *getDisplayName(const char *name)
+{
+   const char *slash = dStrrchr(name, '/');
+   const char *backslash = dStrrchr(name, '\\');
+   if(backslash > slash)
+      slash = backslash;
+   return slash ? slash + 1 : name;
+}
+
+//-----------------------------------------------------------------------------
+
+AllocationTracker::Tag *AllocationTracker::findTag(const char *name, U32 line /* = 0 */)
+{
+   Mutex *mutex = getTagMutex();
+   mutex->lock();
+   Tag *tag = findTagLocked(name, line);
+   mutex->unlock();
+
+   return tag;
+}
+
+AllocationTracker::Tag *AllocationTracker::trackAlloc(const char *fileName, U32 line, dsize_t size)
+{
+   Mutex *mutex = getTagMutex();
+   mutex->lock();
+   Tag *tag = findTagLocked(fileName, line);
+   recordAlloc(tag, size);
+   mutex->unlock();
+
+   return tag;
+}
+
+void AllocationTracker::trackFree(Tag *tag, dsize_t size)
+{
+   Mutex *mutex = getTagMutex();
+   mutex->lock();
+   recordFree(tag, size);
+   mutex->unlock();
+}
+
+bool AllocationTracker::isTrackingMalloc()
+{
+#if defined(TORQUE_TRACK_ALLOCATIONS)
+   return true;
+#else
+   return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+static AllocationTracker::SortMode sSortMode;
+
+static S32 QSORT_CALLBACK compareTags(const void *a, const void *b)
+{
+   const AllocationTracker::Tag *ta = (const AllocationTracker::Tag *)a;
+   const AllocationTracker::Tag *tb = (const AllocationTracker::Tag *)b;
+
+   U64 va, vb;
+   switch(sSortMode)
+   {
+   case AllocationTracker::SortPeakBytes:
+      va = ta->mPeakBytes;
+      vb = tb->mPeakBytes;
+      break;
+   case AllocationTracker::SortAllocRate:
+      va = ta->mTotalAllocs - ta->mReportedAllocs;
+      vb = tb->mTotalAllocs - tb->mReportedAllocs;
+      break;
+   default:
+      va = ta->mLiveBytes;
+      vb = tb->mLiveBytes;
+      break;
+   }
+
+   // Largest first
+   return va > vb ? -1 : (va < vb ? 1 : 0);
+}
+
+void AllocationTracker::dump(U32 maxTags, SortMode sort)
+{
+   Mutex *mutex = getTagMutex();
+
+   // Take a snapshot so that printing, which allocates, happens unlocked
+   mutex->lock();
+   U32 count = sTagCount;
+   Tag *tags = (Tag *)malloc(getMax(count, (U32)1) * sizeof(Tag));
+   U32 index = 0;
+   for(Tag *tag = sTagList;tag && index < count;tag = tag->mNext)
+   {
+      tags[index++] = *tag;
+      tag->mReportedAllocs = tag->mTotalAllocs;
+   }
+
+   U32 now = Platform::getRealMilliseconds();
+   U32 elapsed = getMax(now - sReportTime, (U32)1);
+   sReportTime = now;
+   mutex->unlock();
+
+   sSortMode = sort;
+   dQsort(tags, count, sizeof(Tag), compareTags);
+
+   U64 totalLive = 0;
+   for(U32 i = 0;i < count;++i)
+      totalLive += tags[i].mLiveBytes;
+
+   Con::printf("Allocations: %d tags, %u KB live, over %.1f seconds%s", count, (U32)(totalLive / 1024), elapsed / 1000.0f,
+      isTrackingMalloc() ? "" : " (malloc not tracked, define TORQUE_TRACK_ALLOCATIONS)");
+   Con::printf("  %-40s %10s %10s %10s %10s", "Tag", "Live KB", "Peak KB", "Count", "Allocs/s");
+
+   for(U32 i = 0;i < count && i < maxTags;++i)
+   {
+      const Tag &tag = tags[i];
+
+      char name[256];
+      if(tag.mLine)
+         dSprintf(name, sizeof(name), "%s:%d", getDisplayName(tag.mName), tag.mLine);
+      else
+         dStrncpy(name, tag.mName, sizeof(name));
+      name[sizeof(name) - 1] = 0;
+
+      Con::printf("  %-40s %10u %10u %10u %10u", name, (U32)(tag.mLiveBytes / 1024), (U32)(tag.mPeakBytes / 1024),
+         tag.mLiveCount, (U32)((U64)(tag.mTotalAllocs - tag.mReportedAllocs) * 1000 / elapsed));
+   }
+
+   free(tags);
+}
+
+bool AllocationTracker::getTagStats(const char *name, U64 &liveBytes, U64 &peakBytes, U32 &liveCount, U32 &totalAllocs)
+{
+   liveBytes = peakBytes = 0;
+   liveCount = totalAllocs = 0;
+
+   bool found = false;
+
+   Mutex *mutex = getTagMutex();
+   mutex->lock();
+   for(Tag *tag = sTagList;tag;tag = tag->mNext)
+   {
+      const char *tagName = tag->mLine ? getDisplayName(tag->mName) : tag->mName;
+      if(dStricmp(tagName, name) != 0)
+         continue;
+
+      liveBytes += tag->mLiveBytes;
+      peakBytes += tag->mPeakBytes;
+      liveCount += tag->mLiveCount;
+      totalAllocs += tag->mTotalAllocs;
+      found = true;
+   }
+   mutex->unlock();
+
+   return found;
+}
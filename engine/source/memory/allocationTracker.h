@@ -0,0 +1,109 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ALLOCATION_TRACKER_H_
+#define _ALLOCATION_TRACKER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+/// Per-tag allocation telemetry.
+///
+/// A tag is a named set of counters: live bytes, peak bytes and the number
+/// of allocations made. Tags are reported through the console with
+/// dumpAllocationStats(), which also gives the allocation rate for each tag
+/// since the previous report. This is meant for finding allocation churn.
+///
+/// Two things feed the tracker:
+///
+/// - The pool allocators (see PoolAllocator) always keep counters for the
+///   class they serve, e.g. "SceneObject". This costs a few adds per
+///   allocation.
+/// - When TORQUE_TRACK_ALLOCATIONS is defined, dMalloc_r, dRealloc_r and
+///   dFree track every allocation using the file and line passed to them,
+///   e.g. "vector.cc:48". This adds a small header to each allocation and
+///   takes a lock, so it is meant for profiling builds.
+class AllocationTracker
+{
+public:
+   struct Tag
+   {
+      const char *mName;
+      U32 mLine;              ///< Source line, or 0 for a named tag
+      U32 mLiveCount;
+      U64 mLiveBytes;
+      U64 mPeakBytes;
+      U32 mTotalAllocs;
+      U32 mReportedAllocs;    ///< mTotalAllocs at the last report
+      Tag *mNext;
+      Tag *mHashNext;
+   };
+
+   /// Find or create a tag. The name must stay valid for the life of the
+   /// program, e.g. a string literal or __FILE__.
+   static Tag *findTag(const char *name, U32 line = 0);
+
+   /// Update a tag's counters. These don't lock, so a tag must only be
+   /// updated from one thread (or under the caller's own lock).
+   static inline void recordAlloc(Tag *tag, dsize_t size)
+   {
+      tag->mLiveCount++;
+      tag->mLiveBytes += size;
+      tag->mTotalAllocs++;
+      if(tag->mLiveBytes > tag->mPeakBytes)
+         tag->mPeakBytes = tag->mLiveBytes;
+   }
+
+   static inline void recordFree(Tag *tag, dsize_t size)
+   {
+      tag->mLiveCount--;
+      tag->mLiveBytes -= size;
+   }
+
+   /// @name Tracked malloc
+   /// Used by dMalloc_r and friends when TORQUE_TRACK_ALLOCATIONS is defined.
+   /// These are thread safe.
+   /// @{
+   static Tag *trackAlloc(const char *fileName, U32 line, dsize_t size);
+   static void trackFree(Tag *tag, dsize_t size);
+   /// @}
+
+   enum SortMode
+   {
+      SortLiveBytes,
+      SortPeakBytes,
+      SortAllocRate
+   };
+
+   /// Print the busiest tags to the console and start a new rate window.
+   static void dump(U32 maxTags, SortMode sort);
+
+   /// Get a tag's counters by name, summed over all lines for file tags.
+   /// @return false if no tag has that name
+   static bool getTagStats(const char *name, U64 &liveBytes, U64 &peakBytes, U32 &liveCount, U32 &totalAllocs);
+
+   /// True if the malloc family is being tracked
+   static bool isTrackingMalloc();
+};
+
+#endif // _ALLOCATION_TRACKER_H_
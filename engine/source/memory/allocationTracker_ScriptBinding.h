@@ -0,0 +1,69 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @defgroup AllocationTrackerFunctions Allocation Tracking
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Print the live bytes, peak bytes, live count and allocation rate of the busiest allocation tags.
+    Pooled classes such as SceneObject are always tracked. Every dMalloc call site is tracked when
+    the engine is built with TORQUE_TRACK_ALLOCATIONS. The rate is measured since the previous dump.
+    @param maxTags The number of tags to print (default 20)
+    @param sortBy One of live, peak or rate (default live)
+    @return No return value.
+    @sa getAllocationStats
+*/
+ConsoleFunctionWithDocs(dumpAllocationStats, ConsoleVoid, 1, 3, ([maxTags=20]?, [sortBy=live]?))
+{
+   U32 maxTags = argc > 1 ? dAtoi(argv[1]) : 20;
+
+   AllocationTracker::SortMode sort = AllocationTracker::SortLiveBytes;
+   if(argc > 2)
+   {
+      if(dStricmp(argv[2], "peak") == 0)
+         sort = AllocationTracker::SortPeakBytes;
+      else if(dStricmp(argv[2], "rate") == 0)
+         sort = AllocationTracker::SortAllocRate;
+   }
+
+   AllocationTracker::dump(maxTags, sort);
+}
+
+/*! Get the counters for an allocation tag
+    @param tag The tag name, e.g. SceneObject, or a source file name such as vector.cc for tracked mallocs
+    @return Returns "liveBytes peakBytes liveCount totalAllocs", or an empty string if there is no such tag
+    @sa dumpAllocationStats
+*/
+ConsoleFunctionWithDocs(getAllocationStats, ConsoleString, 2, 2, (tag))
+{
+   U64 liveBytes, peakBytes;
+   U32 liveCount, totalAllocs;
+   if(! AllocationTracker::getTagStats(argv[1], liveBytes, peakBytes, liveCount, totalAllocs))
+      return "";
+
+   char *ret = Con::getReturnBuffer(128);
+   dSprintf(ret, 128, "%u %u %u %u", (U32)liveBytes, (U32)peakBytes, liveCount, totalAllocs);
+   return ret;
+}
+
+/*! @} */ // group AllocationTrackerFunctions
@@ -0,0 +1,114 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "memory/poolAllocator.h"
+#include "math/mMathFn.h"
+
+//-----------------------------------------------------------------------------
+
+PoolAllocator::SizeClass PoolAllocator::smClasses[PoolAllocator::ClassCount];
+U32 PoolAllocator::smReservedBytes = 0;
+
+//-----------------------------------------------------------------------------
+
+void *PoolAllocator::alloc(dsize_t size, AllocationTracker::Tag *tag)
+{
+   AllocationTracker::recordAlloc(tag, size);
+
+   if(size > MaxPooledSize)
+      return dMalloc(size);
+
+   const U32 index = size ? (U32)(size - 1) / Granularity : 0;
+   const U32 blockSize = (index + 1) * Granularity;
+   SizeClass &sizeClass = smClasses[index];
+
+   sizeClass.mLive++;
+
+   // Reuse a freed block
+   if(sizeClass.mFreeList)
+   {
+      void *block = sizeClass.mFreeList;
+      sizeClass.mFreeList = *(void **)block;
+      return block;
+   }
+
+   // Start a new slab. The first block's worth holds the slab chain so that
+   // the rest stay aligned.
+   if(sizeClass.mNext == NULL || sizeClass.mNext + blockSize > sizeClass.mEnd)
+   {
+      const U32 slabSize = getMax((U32)MinSlabSize, blockSize * (MinBlocksPerSlab + 1));
+      U8 *slab = (U8 *)dMalloc(slabSize);
+      *(U8 **)slab = sizeClass.mSlabs;
+      sizeClass.mSlabs = slab;
+      sizeClass.mNext = slab + Granularity;
+      sizeClass.mEnd = slab + slabSize;
+      smReservedBytes += slabSize;
+   }
+
+   void *block = sizeClass.mNext;
+   sizeClass.mNext += blockSize;
+   return block;
+}
+
+void PoolAllocator::free(void *ptr, dsize_t size, AllocationTracker::Tag *tag)
+{
+   if(ptr == NULL)
+      return;
+
+   AllocationTracker::recordFree(tag, size);
+
+   if(size > MaxPooledSize)
+   {
+      dFree(ptr);
+      return;
+   }
+
+   const U32 index = size ? (U32)(size - 1) / Granularity : 0;
+   const U32 blockSize = (index + 1) * Granularity;
+   SizeClass &sizeClass = smClasses[index];
+
+   AssertFatal(sizeClass.mLive > 0, "PoolAllocator::free - Freeing a block that was not allocated.");
+
+   if(--sizeClass.mLive)
+   {
+      *(void **)ptr = sizeClass.mFreeList;
+      sizeClass.mFreeList = ptr;
+      return;
+   }
+
+   // Nothing left in this class, so give back all but the newest slab and
+   // start carving that one again from the top.
+   const U32 slabSize = getMax((U32)MinSlabSize, blockSize * (MinBlocksPerSlab + 1));
+   U8 *slab = *(U8 **)sizeClass.mSlabs;
+   while(slab)
+   {
+      U8 *next = *(U8 **)slab;
+      dFree(slab);
+      slab = next;
+      smReservedBytes -= slabSize;
+   }
+
+   *(U8 **)sizeClass.mSlabs = NULL;
+   sizeClass.mNext = sizeClass.mSlabs + Granularity;
+   sizeClass.mEnd = sizeClass.mSlabs + slabSize;
+   sizeClass.mFreeList = NULL;
+}
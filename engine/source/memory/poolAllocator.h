@@ -0,0 +1,98 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _POOL_ALLOCATOR_H_
+#define _POOL_ALLOCATOR_H_
+
+#include <stddef.h>
+
+#ifndef _ALLOCATION_TRACKER_H_
+#include "memory/allocationTracker.h"
+#endif
+
+/// Size-classed pool for small, frequently created objects.
+///
+/// Sizes are rounded up to a multiple of Granularity and each size class
+/// keeps a free list of blocks carved from larger slabs, so allocating and
+/// freeing is a couple of pointer moves instead of a trip to malloc. A size
+/// class returns all but one of its slabs once all of its blocks have been
+/// freed, e.g. when a level is unloaded. The slab it keeps stops a class that
+/// repeatedly empties and refills from going back to malloc each time.
+/// Allocations larger than MaxPooledSize go to dMalloc.
+///
+/// Classes opt in with DECLARE_POOLED_ALLOCATION, which routes their new and
+/// delete here and tags their allocations with the class name:
+///
+/// @code
+///   class SceneObject : public BehaviorComponent, ...
+///   {
+///      DECLARE_POOLED_ALLOCATION( SceneObject );
+///      ...
+///   };
+/// @endcode
+///
+/// Derived classes share the tag but get the size class of their own size.
+///
+/// The pool is not thread safe. Only pool types that are created and
+/// destroyed on the main thread.
+class PoolAllocator
+{
+public:
+   enum
+   {
+      Granularity = 16,                               ///< Sizes are rounded up to, and blocks aligned to, this
+      MaxPooledSize = 4096,                           ///< Larger allocations are not pooled
+      MinSlabSize = 32768,                            ///< Blocks are carved from slabs at least this big
+      MinBlocksPerSlab = 8,
+      ClassCount = MaxPooledSize / Granularity
+   };
+
+   static void *alloc(dsize_t size, AllocationTracker::Tag *tag);
+   static void free(void *ptr, dsize_t size, AllocationTracker::Tag *tag);
+
+   /// Bytes held in slabs, whether in use or not
+   static U32 getReservedBytes() { return smReservedBytes; }
+
+private:
+   struct SizeClass
+   {
+      U8 *mSlabs;          ///< Slabs are chained through their first pointer
+      U8 *mNext;           ///< Next uncarved block in the current slab
+      U8 *mEnd;
+      void *mFreeList;     ///< Freed blocks are chained through their first pointer
+      U32 mLive;
+   };
+
+   static SizeClass smClasses[ClassCount];
+   static U32 smReservedBytes;
+};
+
+/// Route a class's new and delete through the PoolAllocator.
+#define DECLARE_POOLED_ALLOCATION( className ) \
+   public: \
+   static AllocationTracker::Tag *getAllocationTag( void ) { static AllocationTracker::Tag *pTag = AllocationTracker::findTag( #className ); return pTag; } \
+   static void *operator new( size_t size ) { return PoolAllocator::alloc( (dsize_t)size, getAllocationTag() ); } \
+   static void *operator new( size_t, void *ptr ) { return ptr; } \
+   static void operator delete( void *ptr, size_t size ) { PoolAllocator::free( ptr, (dsize_t)size, getAllocationTag() ); } \
+   static void operator delete( void *, void * ) {}
+
+#endif // _POOL_ALLOCATOR_H_
@@ -65,6 +65,7 @@ ModuleDefinition::ModuleDefinition() :
     mModuleScriptFilePath( StringTable->EmptyString ),
     mSignature( StringTable->EmptyString ),
     mLoadCount( 0 ),
+    mLoadTime( 0 ),
     mLocked( false ),
     mScopeSet( 0 ),
     mpModuleManager( NULL )
@@ -108,6 +109,7 @@ void ModuleDefinition::initPersistFields()
 
     /// Misc.
     addProtectedField( "Signature", TypeString, 0, &defaultProtectedNotSetFn, &getSignature, &defaultProtectedNotWriteFn, "A unique signature of the module definition based upon its Id, version and build.  This is read-only and is available only after the module has been registered by a module manager." );
+    addProtectedField( "LoadTime", TypeS32, Offset(mLoadTime, ModuleDefinition), &defaultProtectedNotSetFn, &defaultProtectedGetFn, &defaultProtectedNotWriteFn, "The time (in milliseconds) taken to execute the module script file and create function when the module was last loaded.  This is read-only." );
 }
 
 //-----------------------------------------------------------------------------
@@ -111,6 +111,7 @@ private:
     /// Miscellaneous.
     StringTableEntry                mSignature;
     S32                             mLoadCount;
+    U32                             mLoadTime;
     SimObjectId                     mScopeSet;
     bool                            mLocked;
     ModuleManager*                  mpModuleManager;
@@ -186,6 +187,8 @@ public:
     inline void             increaseLoadCount( void )                           { ++mLoadCount; }
     inline void             reduceLoadCount( void )                             { --mLoadCount; }
     inline S32              getLoadCount( void ) const                          { return mLoadCount; }
+    inline void             setLoadTime( const U32 loadTime )                   { mLoadTime = loadTime; }
+    inline U32              getLoadTime( void ) const                           { return mLoadTime; }
     inline void             setLocked( const bool status )                      { mLocked = status; }
     inline bool             getLocked( void ) const                             { return mLocked; }
     inline ModuleManager*   getModuleManager( void ) const                      { return mpModuleManager; }
@@ -416,6 +416,9 @@ bool ModuleManager::loadModuleGroup( const char* pModuleGroup )
         // Raise notifications.
         raiseModulePreLoadNotifications( pLoadReadyModuleDefinition );
 
+        // Note the load start time.
+        const U32 loadStartTime = Platform::getRealMilliseconds();
+
         // Do we have a script file-path specified?
         if ( pLoadReadyModuleDefinition->getModuleScriptFilePath() != StringTable->EmptyString )
         {
@@ -440,6 +443,16 @@ bool ModuleManager::loadModuleGroup( const char* pModuleGroup )
             }
         }
 
+        // Note the load time.
+        pLoadReadyModuleDefinition->setLoadTime( Platform::getRealMilliseconds() - loadStartTime );
+
+        // Info.
+        if ( mEchoInfo )
+        {
+            Con::printf( "Module Manager: Loaded module Id '%s' at version Id '%d' in %dms.",
+                pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getVersionId(), pLoadReadyModuleDefinition->getLoadTime() );
+        }
+
         // Raise notifications.
         raiseModulePostLoadNotifications( pLoadReadyModuleDefinition );
     }
@@ -779,6 +792,9 @@ bool ModuleManager::loadModuleExplicit( const char* pModuleId, const U32 version
         // Raise notifications.
         raiseModulePreLoadNotifications( pLoadReadyModuleDefinition );
 
+        // Note the load start time.
+        const U32 loadStartTime = Platform::getRealMilliseconds();
+
         // Do we have a script file-path specified?
         if ( pLoadReadyModuleDefinition->getModuleScriptFilePath() != StringTable->EmptyString )
         {
@@ -803,6 +819,16 @@ bool ModuleManager::loadModuleExplicit( const char* pModuleId, const U32 version
             }
         }
 
+        // Note the load time.
+        pLoadReadyModuleDefinition->setLoadTime( Platform::getRealMilliseconds() - loadStartTime );
+
+        // Info.
+        if ( mEchoInfo )
+        {
+            Con::printf( "Module Manager: Loaded module Id '%s' at version Id '%d' in %dms.",
+                pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getVersionId(), pLoadReadyModuleDefinition->getLoadTime() );
+        }
+
         // Raise notifications.
         raiseModulePostLoadNotifications( pLoadReadyModuleDefinition );
     }
@@ -132,7 +132,7 @@ void TamlBinaryWriter::writeAttributes( Stream& stream, const TamlWriteNode* pTa
     PROFILE_SCOPE(TamlBinaryWriter_WriteAttributes);
 
     // Fetch fields.
-    const Vector<TamlWriteNode::FieldValuePair*>& fields = pTamlWriteNode->mFields;
+    const TamlWriteNode::typeFieldVector& fields = pTamlWriteNode->mFields;
 
     // Write placeholder attribute count.
     stream.write( (U32)fields.size() );
@@ -142,7 +142,7 @@ void TamlBinaryWriter::writeAttributes( Stream& stream, const TamlWriteNode* pTa
         return;
 
     // Iterate fields.
-    for( Vector<TamlWriteNode::FieldValuePair*>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
+    for( TamlWriteNode::typeFieldVector::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
     {
         // Fetch field/value pair.
         TamlWriteNode::FieldValuePair* pFieldValue = (*itr);
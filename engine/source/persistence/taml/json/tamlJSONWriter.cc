@@ -181,7 +181,7 @@ void TamlJSONWriter::compileFields( rapidjson::Document& document, rapidjson::Va
     PROFILE_SCOPE(TamlJSONWriter_CompileFields);
 
     // Fetch fields.
-    const Vector<TamlWriteNode::FieldValuePair*>& fields = pTamlWriteNode->mFields;
+    const TamlWriteNode::typeFieldVector& fields = pTamlWriteNode->mFields;
 
     // Ignore if no fields.
     if ( fields.size() == 0 )
@@ -191,7 +191,7 @@ void TamlJSONWriter::compileFields( rapidjson::Document& document, rapidjson::Va
     rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
 
     // Iterate fields.
-    for( Vector<TamlWriteNode::FieldValuePair*>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
+    for( TamlWriteNode::typeFieldVector::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
     {
         // Fetch field/value pair.
         TamlWriteNode::FieldValuePair* pFieldValue = (*itr);
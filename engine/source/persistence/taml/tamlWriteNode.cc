@@ -33,9 +33,10 @@ void TamlWriteNode::resetNode( void )
     PROFILE_SCOPE(TamlWriteNode_ResetNode);
 
     // Clear fields.
-    for( Vector<TamlWriteNode::FieldValuePair*>::iterator itr = mFields.begin(); itr != mFields.end(); ++itr )
+    for( typeFieldVector::iterator itr = mFields.begin(); itr != mFields.end(); ++itr )
     {
-        delete (*itr)->mpValue;
+        delete [] (*itr)->mpValue;
+        delete (*itr);
     }
     mFields.clear();
 
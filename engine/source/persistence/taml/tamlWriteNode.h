@@ -31,8 +31,12 @@
 #include "sim/simBase.h"
 #endif
 
-#ifndef _VECTOR_H_
-#include "collection/vector.h"
+#ifndef _INLINE_VECTOR_H_
+#include "collection/inlineVector.h"
+#endif
+
+#ifndef _POOL_ALLOCATOR_H_
+#include "memory/poolAllocator.h"
 #endif
 
 //-----------------------------------------------------------------------------
@@ -45,9 +49,13 @@ class TamlCallbacks;
 /// @see tamlGroup
 class TamlWriteNode
 {
+    DECLARE_POOLED_ALLOCATION( TamlWriteNode );
+
 public:
     class FieldValuePair
     {
+        DECLARE_POOLED_ALLOCATION( TamlWriteNode::FieldValuePair );
+
     public:        
         FieldValuePair( StringTableEntry name, const char* pValue )
         {
@@ -64,6 +72,9 @@ public:
         const char*         mpValue;
     };
 
+    // Most objects write only a few fields so keep them inline to avoid a heap allocation per node.
+    typedef InlineVector<TamlWriteNode::FieldValuePair*, 16> typeFieldVector;
+
 public:
     TamlWriteNode()
     {
@@ -110,7 +121,7 @@ public:
     SimObject*                  mpSimObject;
     TamlCallbacks*              mpTamlCallbacks;
     const char*                 mpObjectName;
-    Vector<TamlWriteNode::FieldValuePair*> mFields;
+    typeFieldVector             mFields;
     Vector<TamlWriteNode*>*     mChildren;
     TamlCustomNodes             mCustomNodes;
 };
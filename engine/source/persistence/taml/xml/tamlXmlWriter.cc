@@ -157,14 +157,14 @@ void TamlXmlWriter::compileAttributes( TiXmlElement* pXmlElement, const TamlWrit
     PROFILE_SCOPE(TamlXmlWriter_CompileAttributes);
 
     // Fetch fields.
-    const Vector<TamlWriteNode::FieldValuePair*>& fields = pTamlWriteNode->mFields;
+    const TamlWriteNode::typeFieldVector& fields = pTamlWriteNode->mFields;
 
     // Ignore if no fields.
     if ( fields.size() == 0 )
         return;
 
     // Iterate fields.
-    for( Vector<TamlWriteNode::FieldValuePair*>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
+    for( TamlWriteNode::typeFieldVector::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
     {
         // Fetch field/value pair.
         TamlWriteNode::FieldValuePair* pFieldValue = (*itr);
@@ -121,6 +121,9 @@ public:
    static const F32 smTickSec;      ///< Fraction of a second per tick
    static const U32 smTickMask;
 
+   /// Time of the tick being processed (or last processed); unique per tick
+   static U32 getLastTick() { return smLastTick; }
+
    /// Constructor
    /// This will add the object to the process list
    Tickable();
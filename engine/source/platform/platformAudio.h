@@ -178,5 +178,6 @@ bool alxIsPlaying(AUDIOHANDLE handle);
 void alxUpdate();
 F32 alxGetStreamPosition( AUDIOHANDLE handle );
 F32 alxGetStreamDuration( AUDIOHANDLE handle );
+U32 alxGetStreamingResidentBytes( const char *filename );
 
 #endif  // _H_PLATFORMAUDIO_
@@ -26,10 +26,79 @@
 #include "debug/profiler.h"
 #include "platform/threads/mutex.h"
 #include "math/mMath.h"
+#include "memory/allocationTracker.h"
 #include <stdlib.h>
 
 //-----------------------------------------------------------------------------
 
+#if defined(TORQUE_TRACK_ALLOCATIONS)
+
+// Each tracked allocation is prefixed with its tag and size. This is kept
+// 16 bytes so that the memory handed out keeps malloc's alignment.
+struct AllocationHeader
+{
+   AllocationTracker::Tag* mTag;
+   dsize_t mSize;
+};
+
+static const dsize_t AllocationHeaderSize = 16;
+
+//-----------------------------------------------------------------------------
+
+void* dMalloc_r(dsize_t in_size, const char* fileName, const dsize_t line)
+{
+   U8* pMemory = (U8*)malloc(in_size + AllocationHeaderSize);
+   if (pMemory == NULL)
+      return NULL;
+
+   AllocationHeader* pHeader = (AllocationHeader*)pMemory;
+   pHeader->mTag = AllocationTracker::trackAlloc(fileName, (U32)line, in_size);
+   pHeader->mSize = in_size;
+
+   return pMemory + AllocationHeaderSize;
+}
+
+//-----------------------------------------------------------------------------
+
+void dFree(void* in_pFree)
+{
+   if (in_pFree == NULL)
+      return;
+
+   AllocationHeader* pHeader = (AllocationHeader*)((U8*)in_pFree - AllocationHeaderSize);
+   AllocationTracker::trackFree(pHeader->mTag, pHeader->mSize);
+
+   free(pHeader);
+}
+
+//-----------------------------------------------------------------------------
+
+void* dRealloc_r(void* in_pResize, dsize_t in_size, const char* fileName, const dsize_t line)
+{
+   if (in_pResize == NULL)
+      return dMalloc_r(in_size, fileName, line);
+
+   AllocationHeader* pHeader = (AllocationHeader*)((U8*)in_pResize - AllocationHeaderSize);
+   AllocationTracker::Tag* pOldTag = pHeader->mTag;
+   dsize_t oldSize = pHeader->mSize;
+
+   U8* pMemory = (U8*)realloc(pHeader, in_size + AllocationHeaderSize);
+   if (pMemory == NULL)
+      return NULL;
+
+   AllocationTracker::trackFree(pOldTag, oldSize);
+
+   pHeader = (AllocationHeader*)pMemory;
+   pHeader->mTag = AllocationTracker::trackAlloc(fileName, (U32)line, in_size);
+   pHeader->mSize = in_size;
+
+   return pMemory + AllocationHeaderSize;
+}
+
+#else
+
+//-----------------------------------------------------------------------------
+
 void* dMalloc_r(dsize_t in_size, const char* fileName, const dsize_t line)
 {
    return malloc(in_size);
@@ -48,3 +117,5 @@ void* dRealloc_r(void* in_pResize, dsize_t in_size, const char* fileName, const
 {
    return realloc(in_pResize,in_size);
 }
+
+#endif // TORQUE_TRACK_ALLOCATIONS
@@ -29,10 +29,15 @@
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/poll.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
 #include <arpa/inet.h>
 #include <netdb.h>
 #include <netinet/in.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <time.h>
 
 /* for PROTO_IPX */
 #if defined(__linux__)
@@ -48,15 +53,19 @@
 #include <stdlib.h>
 
 #include "console/console.h"
+#include "console/consoleTypes.h"
 #include "game/gameInterface.h"
 #include "io/fileStream.h"
 #include "collection/vector.h"
+#include "platform/threads/thread.h"
+#include "testing/benchmark.h"
 
 static Net::Error getLastError();
 static S32 defaultPort = 28000;
 static S32 netPort = 0;
 static int ipxSocket = InvalidSocket;
 static int udpSocket = InvalidSocket;
+static bool gNetIOThreadEnabled = false;
 
 // local enum for socket states for polled sockets
 enum SocketState
@@ -78,17 +87,108 @@ struct Socket
          state = InvalidState;
          remoteAddr[0] = 0;
          remotePort = -1;
+         ready = false;
       }
 
       NetSocket fd;
       S32 state;
       char remoteAddr[256];
       S32 remotePort;
+      bool ready;    ///< Reported ready by the reactor and not yet drained.
 };
 
 // list of polled sockets
 static Vector<Socket*> gPolledSockets;
 
+//-----------------------------------------------------------------------------
+// Socket reactor.
+//
+// On Linux, connected, connecting and listening sockets are registered with
+// an edge-triggered epoll set so Net::process() only touches sockets that
+// have something to do.  A socket stays on the ready list until it has been
+// drained, so a busy socket cannot starve the others.  Sockets waiting on an
+// asynchronous name lookup cannot be polled and are still checked each frame.
+//-----------------------------------------------------------------------------
+
+#if defined(__linux__)
+#define TORQUE_NET_EPOLL
+#endif
+
+#ifdef TORQUE_NET_EPOLL
+
+enum
+{
+   NetEpollBatchSize = 256,   ///< Most events fetched by one epoll_wait().
+};
+
+static int gEpollFd = -1;
+static Vector<Socket*> gReadySockets;
+static Vector<Socket*> gLookupSockets;
+
+static void netWatchSocket(Socket* sock, bool add)
+{
+   if (gEpollFd == -1)
+      return;
+
+   epoll_event event;
+   dMemset(&event, 0, sizeof(event));
+   event.data.ptr = sock;
+
+   switch (sock->state)
+   {
+      case ConnectionPending:
+         // Completion of a non-blocking connect is reported as writable.
+         event.events = EPOLLOUT | EPOLLET;
+         break;
+      case Connected:
+      case Listening:
+         event.events = EPOLLIN | EPOLLRDHUP | EPOLLET;
+         break;
+      default:
+         // Name lookups are tracked separately.
+         gLookupSockets.push_back(sock);
+         return;
+   }
+
+   epoll_ctl(gEpollFd, add ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, sock->fd, &event);
+}
+
+static void netUnwatchSocket(Socket* sock)
+{
+   if (gEpollFd == -1)
+      return;
+
+   if (sock->state == NameLookupRequired)
+   {
+      for (S32 i = 0; i < gLookupSockets.size(); ++i)
+      {
+         if (gLookupSockets[i] == sock)
+         {
+            gLookupSockets.erase_fast(i);
+            break;
+         }
+      }
+   }
+   else
+   {
+      epoll_ctl(gEpollFd, EPOLL_CTL_DEL, sock->fd, NULL);
+   }
+
+   if (sock->ready)
+   {
+      for (S32 i = 0; i < gReadySockets.size(); ++i)
+      {
+         if (gReadySockets[i] == sock)
+         {
+            gReadySockets.erase(i);
+            break;
+         }
+      }
+   }
+}
+
+#endif // TORQUE_NET_EPOLL
+
 static Socket* addPolledSocket(NetSocket& fd, S32 state,
                                char* remoteAddr = NULL, S32 port = -1)
 {
@@ -100,9 +200,25 @@ static Socket* addPolledSocket(NetSocket& fd, S32 state,
    if (port != -1)
       sock->remotePort = port;
    gPolledSockets.push_back(sock);
+#ifdef TORQUE_NET_EPOLL
+   netWatchSocket(sock, true);
+#endif
    return sock;
 }
 
+static void setPolledSocketState(Socket* sock, S32 state)
+{
+#ifdef TORQUE_NET_EPOLL
+   const bool wasLookup = sock->state == NameLookupRequired;
+   if (wasLookup)
+      netUnwatchSocket(sock);
+   sock->state = state;
+   netWatchSocket(sock, wasLookup);
+#else
+   sock->state = state;
+#endif
+}
+
 enum {
    MaxConnections = 1024,
 };
@@ -124,6 +240,14 @@ S32 Poll(NetSocket fd, S32 eventMask, S32 timeoutMs)
 
 bool Net::init()
 {
+   Con::addVariable("Net::ioThread", TypeBool, &gNetIOThreadEnabled);
+
+#ifdef TORQUE_NET_EPOLL
+   gEpollFd = epoll_create1(EPOLL_CLOEXEC);
+   if (gEpollFd == -1)
+      Con::warnf("Net::init() - Unable to create epoll set, falling back to polling sockets: %s", strerror(errno));
+#endif
+
    NetAsync::startAsync();
    return(true);
 }
@@ -135,6 +259,14 @@ void Net::shutdown()
    
    closePort();
    NetAsync::stopAsync();
+
+#ifdef TORQUE_NET_EPOLL
+   if (gEpollFd != -1)
+   {
+      close(gEpollFd);
+      gEpollFd = -1;
+   }
+#endif
 }
 
 static void netToIPSocketAddress(const NetAddress *address, struct sockaddr_in *sockAddr)
@@ -199,6 +331,517 @@ static void IPXSocketToNetAddress(const sockaddr_ipx *sockAddr, NetAddress *addr
 #endif
 }
 
+//-----------------------------------------------------------------------------
+// Network I/O thread.
+//
+// When $Net::ioThread is set before the port is opened, UDP traffic leaves the
+// main loop: a dedicated thread receives packets in batches with recvmmsg()
+// into a ring that Net::process() drains once per tick, and Net::sendto()
+// queues packets into a second ring that the thread flushes with sendmmsg().
+// Each ring has exactly one producer and one consumer so neither needs a lock.
+//-----------------------------------------------------------------------------
+
+#if defined(__linux__)
+#define TORQUE_NET_IO_THREAD
+#endif
+
+static U64 netGetMicroseconds()
+{
+   timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (U64)now.tv_sec * 1000000 + (U64)(now.tv_nsec / 1000);
+}
+
+// Statistics for the loopback load test.
+struct NetLoadTestStats
+{
+   U32 packetsSent;
+   U32 packetsReceived;
+   U32 startTime;
+   U32 endTime;
+   U64 latencyTotal;
+   U64 latencyMax;
+};
+
+static NetLoadTestStats gNetLoadTestStats;
+static volatile bool gNetLoadTestRunning = false;
+static volatile U16 gNetLoadTestPort = 0;
+
+// Consumes a packet sent by the loopback load test, recording its latency.
+static bool netConsumeLoadTestPacket(const NetAddress& address, const U8* data, S32 size)
+{
+   // The port is only ours while the test runs; the OS can hand it to a real client afterwards.
+   if(!gNetLoadTestRunning || gNetLoadTestPort == 0 || address.port != gNetLoadTestPort || address.type != NetAddress::IPAddress ||
+      address.netNum[0] != 127 || address.netNum[1] != 0 || address.netNum[2] != 0 || address.netNum[3] != 1)
+      return false;
+
+   if(size >= (S32)sizeof(U64))
+   {
+      U64 sendTime;
+      dMemcpy(&sendTime, data, sizeof(U64));
+      const U64 latency = netGetMicroseconds() - sendTime;
+      gNetLoadTestStats.latencyTotal += latency;
+      if(latency > gNetLoadTestStats.latencyMax)
+         gNetLoadTestStats.latencyMax = latency;
+   }
+
+   gNetLoadTestStats.packetsReceived++;
+   gNetLoadTestStats.endTime = Platform::getRealMilliseconds();
+   return true;
+}
+
+#ifdef TORQUE_NET_IO_THREAD
+
+enum
+{
+   NetIORingSize  = 1024,  ///< Packets per ring; must be a power of two.
+   NetIOBatchSize = 64,    ///< Most packets moved by one recvmmsg/sendmmsg call.
+   NetIOPollMs    = 10,    ///< Longest the thread sleeps without being woken.
+};
+
+struct NetIOPacket
+{
+   sockaddr_in address;
+   S32         size;
+   U64         timestamp;     ///< Microseconds when the packet was received.
+   U8          data[MaxPacketDataSize];
+};
+
+/// A lock-free packet ring with a single producer and a single consumer.
+class NetIORing
+{
+   NetIOPacket    mPackets[NetIORingSize];
+   volatile U32   mHead;     ///< Next slot to write; only the producer advances it.
+   volatile U32   mTail;     ///< Next slot to read; only the consumer advances it.
+
+public:
+   NetIORing() : mHead(0), mTail(0) {}
+
+   U32 getWritable() const { const U32 count = NetIORingSize - (mHead - mTail); __sync_synchronize(); return count; }
+   U32 getReadable() const { const U32 count = mHead - mTail; __sync_synchronize(); return count; }
+
+   NetIOPacket& getWriteSlot(const U32 offset) { return mPackets[(mHead + offset) & (NetIORingSize - 1)]; }
+   NetIOPacket& getReadSlot(const U32 offset)  { return mPackets[(mTail + offset) & (NetIORingSize - 1)]; }
+
+   void commitWrite(const U32 count) { __sync_synchronize(); mHead += count; __sync_synchronize(); }
+   void commitRead(const U32 count)  { __sync_synchronize(); mTail += count; __sync_synchronize(); }
+};
+
+struct NetIOStats
+{
+   U32 packetsReceived;
+   U32 packetsSent;
+   U32 packetsDropped;
+   U32 receiveBatches;
+   U32 sendBatches;
+   U32 sendOverflows;     ///< Packets refused because the send ring was full.
+   U64 latencyTotal;
+   U64 latencyMax;
+};
+
+class NetIOThread : public Thread
+{
+   NetSocket   mSocket;
+   int         mWakePipe[2];
+   mmsghdr     mMessages[NetIOBatchSize];
+   iovec       mBuffers[NetIOBatchSize];
+
+   void receivePackets();
+   bool sendPackets();
+
+public:
+   NetIORing   mReceiveRing;
+   NetIORing   mSendRing;
+   NetIOStats  mStats;
+
+   NetIOThread(NetSocket socket);
+   virtual ~NetIOThread();
+
+   virtual void run(void* arg = 0);
+
+   void wake();
+   void shutdown();
+   bool queueSend(const sockaddr_in& address, const U8* buffer, S32 bufferSize);
+};
+
+static NetIOThread* gNetIOThread = NULL;
+
+NetIOThread::NetIOThread(NetSocket socket) : Thread(0, 0, false)
+{
+   mSocket = socket;
+   dMemset(&mStats, 0, sizeof(mStats));
+
+   if(pipe(mWakePipe) == 0)
+   {
+      fcntl(mWakePipe[0], F_SETFL, O_NONBLOCK);
+      fcntl(mWakePipe[1], F_SETFL, O_NONBLOCK);
+   }
+   else
+   {
+      mWakePipe[0] = mWakePipe[1] = -1;
+   }
+}
+
+NetIOThread::~NetIOThread()
+{
+   shutdown();
+
+   if(mWakePipe[0] != -1)
+   {
+      close(mWakePipe[0]);
+      close(mWakePipe[1]);
+   }
+}
+
+void NetIOThread::wake()
+{
+   if(mWakePipe[1] != -1)
+   {
+      const char signal = 0;
+      ::write(mWakePipe[1], &signal, 1);
+   }
+}
+
+void NetIOThread::shutdown()
+{
+   if(!isAlive())
+      return;
+
+   stop();
+   wake();
+   join();
+}
+
+void NetIOThread::run(void* arg)
+{
+   while(!checkForStop())
+   {
+      const bool sendPending = mSendRing.getReadable() != 0;
+
+      // Only wait on the socket for what we can act on: a full receive ring
+      // would otherwise make poll() return immediately.
+      pollfd fds[2];
+      fds[0].fd = mSocket;
+      fds[0].events = (mReceiveRing.getWritable() ? POLLIN : 0) | (sendPending ? POLLOUT : 0);
+      fds[0].revents = 0;
+      fds[1].fd = mWakePipe[0];
+      fds[1].events = POLLIN;
+      fds[1].revents = 0;
+
+      poll(fds, mWakePipe[0] != -1 ? 2 : 1, NetIOPollMs);
+
+      if(fds[1].revents & POLLIN)
+      {
+         char drain[64];
+         while(read(mWakePipe[0], drain, sizeof(drain)) > 0)
+            ;
+      }
+
+      receivePackets();
+      sendPackets();
+   }
+}
+
+void NetIOThread::receivePackets()
+{
+   for(;;)
+   {
+      const U32 count = getMin((U32)NetIOBatchSize, mReceiveRing.getWritable());
+      if(count == 0)
+         return;
+
+      for(U32 i = 0; i < count; ++i)
+      {
+         NetIOPacket& packet = mReceiveRing.getWriteSlot(i);
+         mBuffers[i].iov_base = packet.data;
+         mBuffers[i].iov_len = MaxPacketDataSize;
+         dMemset(&mMessages[i], 0, sizeof(mmsghdr));
+         mMessages[i].msg_hdr.msg_name = &packet.address;
+         mMessages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+         mMessages[i].msg_hdr.msg_iov = &mBuffers[i];
+         mMessages[i].msg_hdr.msg_iovlen = 1;
+      }
+
+      const S32 received = recvmmsg(mSocket, mMessages, count, MSG_DONTWAIT, NULL);
+      if(received <= 0)
+         return;
+
+      const U64 now = netGetMicroseconds();
+      for(S32 i = 0; i < received; ++i)
+      {
+         NetIOPacket& packet = mReceiveRing.getWriteSlot(i);
+         packet.size = (S32)mMessages[i].msg_len;
+         packet.timestamp = now;
+
+         // Anything that is not IPv4 is dropped by the consumer.
+         if(mMessages[i].msg_hdr.msg_namelen != sizeof(sockaddr_in))
+            packet.address.sin_family = AF_UNSPEC;
+      }
+
+      mReceiveRing.commitWrite(received);
+      mStats.packetsReceived += received;
+      mStats.receiveBatches++;
+
+      if((U32)received < count)
+         return;
+   }
+}
+
+bool NetIOThread::sendPackets()
+{
+   for(;;)
+   {
+      const U32 count = getMin((U32)NetIOBatchSize, mSendRing.getReadable());
+      if(count == 0)
+         return true;
+
+      for(U32 i = 0; i < count; ++i)
+      {
+         NetIOPacket& packet = mSendRing.getReadSlot(i);
+         mBuffers[i].iov_base = packet.data;
+         mBuffers[i].iov_len = packet.size;
+         dMemset(&mMessages[i], 0, sizeof(mmsghdr));
+         mMessages[i].msg_hdr.msg_name = &packet.address;
+         mMessages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+         mMessages[i].msg_hdr.msg_iov = &mBuffers[i];
+         mMessages[i].msg_hdr.msg_iovlen = 1;
+      }
+
+      const S32 sent = sendmmsg(mSocket, mMessages, count, MSG_DONTWAIT);
+      if(sent < 0)
+      {
+         // Try again once the socket is writable.
+         if(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+            return false;
+
+         // Drop the packet that failed so one bad destination cannot stall the queue.
+         mSendRing.commitRead(1);
+         mStats.packetsDropped++;
+         continue;
+      }
+
+      mSendRing.commitRead(sent);
+      mStats.packetsSent += sent;
+      mStats.sendBatches++;
+   }
+}
+
+bool NetIOThread::queueSend(const sockaddr_in& address, const U8* buffer, S32 bufferSize)
+{
+   if(bufferSize > MaxPacketDataSize || mSendRing.getWritable() == 0)
+   {
+      mStats.sendOverflows++;
+      return false;
+   }
+
+   NetIOPacket& packet = mSendRing.getWriteSlot(0);
+   packet.address = address;
+   packet.size = bufferSize;
+   dMemcpy(packet.data, buffer, bufferSize);
+   mSendRing.commitWrite(1);
+
+   // Only wake the thread when the ring was empty; otherwise it is already
+   // flushing and will see this packet before it sleeps again.
+   if(mSendRing.getReadable() == 1)
+      wake();
+
+   return true;
+}
+
+static void netStopIOThread()
+{
+   if(gNetIOThread == NULL)
+      return;
+
+   delete gNetIOThread;
+   gNetIOThread = NULL;
+}
+
+static void netStartIOThread(NetSocket socket)
+{
+   netStopIOThread();
+
+   gNetIOThread = new NetIOThread(socket);
+   gNetIOThread->start();
+   Con::printf("UDP I/O thread started.");
+}
+
+// Drains packets received by the I/O thread and posts them to the game.
+static void netDrainIOThread(PacketReceiveEvent& receiveEvent)
+{
+   NetIORing& ring = gNetIOThread->mReceiveRing;
+   const U32 count = ring.getReadable();
+   if(count == 0)
+      return;
+
+   const U64 now = netGetMicroseconds();
+
+   for(U32 i = 0; i < count; ++i)
+   {
+      const NetIOPacket& packet = ring.getReadSlot(i);
+
+      const U64 latency = now - packet.timestamp;
+      gNetIOThread->mStats.latencyTotal += latency;
+      if(latency > gNetIOThread->mStats.latencyMax)
+         gNetIOThread->mStats.latencyMax = latency;
+
+      if(packet.address.sin_family != AF_INET || packet.size <= 0)
+         continue;
+
+      IPSocketToNetAddress(&packet.address, &receiveEvent.sourceAddress);
+
+      NetAddress &na = receiveEvent.sourceAddress;
+      if(na.netNum[0] == 127 &&
+         na.netNum[1] == 0 &&
+         na.netNum[2] == 0 &&
+         na.netNum[3] == 1 &&
+         na.port == netPort)
+         continue;
+
+      if(netConsumeLoadTestPacket(na, packet.data, packet.size))
+         continue;
+
+      dMemcpy(receiveEvent.data, packet.data, packet.size);
+      receiveEvent.size = PacketReceiveEventHeaderSize + packet.size;
+      Game->postEvent(receiveEvent);
+   }
+
+   ring.commitRead(count);
+
+   // A full ring stops the thread polling for input, so let it resume now.
+   if(count == NetIORingSize)
+      gNetIOThread->wake();
+}
+
+#endif // TORQUE_NET_IO_THREAD
+
+//-----------------------------------------------------------------------------
+// Loopback load test.
+//
+// Sends timestamped packets to our own UDP port from a separate socket at a
+// fixed rate; Net::process() recognises them by their source port and records
+// their end-to-end latency instead of posting them.
+//-----------------------------------------------------------------------------
+
+class NetLoadTestThread : public Thread
+{
+   U32 mPacketsPerSecond;
+   U32 mPacketSize;
+   U32 mDuration;
+
+public:
+   NetLoadTestThread(U32 packetsPerSecond, U32 packetSize, U32 duration) : Thread(0, 0, false, true)
+   {
+      mPacketsPerSecond = packetsPerSecond;
+      mPacketSize = getMax((U32)sizeof(U64), getMin(packetSize, (U32)MaxPacketDataSize));
+      mDuration = duration;
+   }
+
+   virtual void run(void* arg = 0);
+};
+
+void NetLoadTestThread::run(void* arg)
+{
+   const int sendSocket = socket(AF_INET, SOCK_DGRAM, 0);
+   if(sendSocket == InvalidSocket)
+   {
+      gNetLoadTestRunning = false;
+      return;
+   }
+
+   sockaddr_in local;
+   dMemset(&local, 0, sizeof(local));
+   local.sin_family = AF_INET;
+   local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+   socklen_t localLength = sizeof(local);
+   ::bind(sendSocket, (sockaddr*)&local, sizeof(local));
+   getsockname(sendSocket, (sockaddr*)&local, &localLength);
+   gNetLoadTestPort = ntohs(local.sin_port);
+
+   sockaddr_in target;
+   dMemset(&target, 0, sizeof(target));
+   target.sin_family = AF_INET;
+   target.sin_port = htons(netPort);
+   target.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+   const U32 batchSize = 64;
+   U8 payload[batchSize][MaxPacketDataSize];
+   dMemset(payload, 0, sizeof(payload));
+#ifdef TORQUE_NET_IO_THREAD
+   mmsghdr messages[batchSize];
+   iovec buffers[batchSize];
+#endif
+
+   const U64 startTime = netGetMicroseconds();
+   const U64 endTime = startTime + (U64)mDuration * 1000;
+   U64 sent = 0;
+
+   for(U64 now = startTime; now < endTime && !checkForStop(); now = netGetMicroseconds())
+   {
+      // Send whatever is due at the requested rate, a batch at a time.
+      const U64 due = (now - startTime) * mPacketsPerSecond / 1000000;
+      if(due <= sent)
+      {
+         usleep(500);
+         continue;
+      }
+
+      const U32 count = (due - sent) < batchSize ? (U32)(due - sent) : batchSize;
+#ifdef TORQUE_NET_IO_THREAD
+      for(U32 i = 0; i < count; ++i)
+      {
+         const U64 sendTime = netGetMicroseconds();
+         dMemcpy(payload[i], &sendTime, sizeof(U64));
+         buffers[i].iov_base = payload[i];
+         buffers[i].iov_len = mPacketSize;
+         dMemset(&messages[i], 0, sizeof(mmsghdr));
+         messages[i].msg_hdr.msg_name = &target;
+         messages[i].msg_hdr.msg_namelen = sizeof(target);
+         messages[i].msg_hdr.msg_iov = &buffers[i];
+         messages[i].msg_hdr.msg_iovlen = 1;
+      }
+
+      const S32 result = sendmmsg(sendSocket, messages, count, 0);
+#else
+      // Without sendmmsg() the batch goes out a packet at a time.
+      S32 result = 0;
+      for(U32 i = 0; i < count; ++i)
+      {
+         const U64 sendTime = netGetMicroseconds();
+         dMemcpy(payload[i], &sendTime, sizeof(U64));
+         if(::sendto(sendSocket, payload[i], mPacketSize, 0, (sockaddr*)&target, sizeof(target)) < 0)
+            break;
+         ++result;
+      }
+#endif
+      if(result > 0)
+      {
+         sent += result;
+         gNetLoadTestStats.packetsSent += result;
+      }
+   }
+
+   close(sendSocket);
+   gNetLoadTestPort = 0;
+   gNetLoadTestRunning = false;
+}
+
+static bool netStartLoadTest(U32 packetsPerSecond, U32 packetSize, U32 duration)
+{
+   if(gNetLoadTestRunning || netPort == 0 || udpSocket == InvalidSocket)
+      return false;
+
+   dMemset(&gNetLoadTestStats, 0, sizeof(gNetLoadTestStats));
+   gNetLoadTestStats.startTime = Platform::getRealMilliseconds();
+   gNetLoadTestRunning = true;
+
+   NetLoadTestThread* pThread = new NetLoadTestThread(packetsPerSecond, packetSize, duration);
+   pThread->start();
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
 NetSocket Net::openListenPort(U16 port)
 {
 #ifdef	TORQUE_ALLOW_JOURNALING
@@ -319,6 +962,9 @@ void Net::closeConnectTo(NetSocket sock)
    for (int i = 0; i < gPolledSockets.size(); ++i)
       if (gPolledSockets[i]->fd == sock)
       {
+#ifdef TORQUE_NET_EPOLL
+         netUnwatchSocket(gPolledSockets[i]);
+#endif
          delete gPolledSockets[i];
          gPolledSockets.erase(i);
          break;
@@ -350,6 +996,10 @@ Net::Error Net::sendtoSocket(NetSocket socket, const U8 *buffer, int bufferSize)
 
 bool Net::openPort(S32 port)
 {
+#ifdef TORQUE_NET_IO_THREAD
+   netStopIOThread();
+#endif
+
    if(udpSocket != InvalidSocket)
       close(udpSocket);
    if(ipxSocket != InvalidSocket)
@@ -403,11 +1053,21 @@ bool Net::openPort(S32 port)
       }
    }
    netPort = port;
+
+#ifdef TORQUE_NET_IO_THREAD
+   if(gNetIOThreadEnabled && udpSocket != InvalidSocket)
+      netStartIOThread(udpSocket);
+#endif
+
    return ipxSocket != InvalidSocket || udpSocket != InvalidSocket;
 }
 
 void Net::closePort()
 {
+#ifdef TORQUE_NET_IO_THREAD
+   netStopIOThread();
+#endif
+
    if(ipxSocket != InvalidSocket)
       close(ipxSocket);
    if(udpSocket != InvalidSocket)
@@ -435,6 +1095,14 @@ Net::Error Net::sendto(const NetAddress *address, const U8 *buffer, S32 bufferSi
    {
       sockaddr_in ipAddr;
       netToIPSocketAddress(address, &ipAddr);
+
+#ifdef TORQUE_NET_IO_THREAD
+      // Queue for the I/O thread to batch. A direct send here would overtake the
+      // packets still in the ring, so a full ring drops the packet instead.
+      if(gNetIOThread)
+         return gNetIOThread->queueSend(ipAddr, buffer, bufferSize) ? NoError : WouldBlock;
+#endif
+
       if(::sendto(udpSocket, (const char*)buffer, bufferSize, 0,
                   (sockaddr *) &ipAddr, sizeof(sockaddr_in)) == -1)
          return getLastError();
@@ -443,16 +1111,439 @@ Net::Error Net::sendto(const NetAddress *address, const U8 *buffer, S32 bufferSi
    }
 }
 
+//-----------------------------------------------------------------------------
+
+static ConnectedNotifyEvent gNotifyEvent;
+static ConnectedAcceptEvent gAcceptEvent;
+static ConnectedReceiveEvent gReceiveEvent;
+
+enum
+{
+   /// Most reads taken from one socket per frame before moving on to the next.
+   MaxPolledSocketReads = 64,
+};
+
+// Checks whether a pending connect has finished.  Returns true if the socket should be removed.
+static bool processConnectionPending(Socket* currentSock)
+{
+   S32 optval;
+   socklen_t optlen = sizeof(S32);
+
+   gNotifyEvent.tag = currentSock->fd;
+   // see if it is now connected
+   if (getsockopt(currentSock->fd, SOL_SOCKET, SO_ERROR,
+                  &optval, &optlen) == -1)
+   {
+      Con::errorf("Error getting socket options: %s", strerror(errno));
+      gNotifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
+      Game->postEvent(gNotifyEvent);
+      return true;
+   }
+
+   if (optval == EINPROGRESS)
+      // still connecting...
+      return false;
+
+   if (optval == 0)
+   {
+      // connected
+      gNotifyEvent.state = ConnectedNotifyEvent::Connected;
+      Game->postEvent(gNotifyEvent);
+      setPolledSocketState(currentSock, Connected);
+      return false;
+   }
+
+   // some kind of error
+   Con::errorf("Error connecting: %s", strerror(errno));
+   gNotifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
+   Game->postEvent(gNotifyEvent);
+   return true;
+}
+
+// Reads up to maxReads packets from a connected socket.  Sets drained once the socket
+// would block.  Returns true if the socket should be removed.
+static bool processConnected(Socket* currentSock, U32 maxReads, bool& drained)
+{
+   drained = false;
+
+   for (U32 reads = 0; reads < maxReads; ++reads)
+   {
+      S32 bytesRead = 0;
+      // try to get some data
+      const Net::Error err = Net::recv(currentSock->fd, gReceiveEvent.data,
+                                       MaxPacketDataSize, &bytesRead);
+      if (err == Net::WouldBlock)
+      {
+         drained = true;
+         return false;
+      }
+
+      if (err != Net::NoError)
+      {
+         Con::errorf("Error reading from socket: %s", strerror(errno));
+         gNotifyEvent.tag = currentSock->fd;
+         gNotifyEvent.state = ConnectedNotifyEvent::Disconnected;
+         Game->postEvent(gNotifyEvent);
+         return true;
+      }
+
+      if (bytesRead <= 0)
+      {
+         // zero bytes read means EOF
+         if (bytesRead < 0)
+            // ack! this shouldn't happen
+            Con::errorf("Unexpected error on socket: %s",
+                        strerror(errno));
+
+         gNotifyEvent.tag = currentSock->fd;
+         gNotifyEvent.state = ConnectedNotifyEvent::Disconnected;
+         Game->postEvent(gNotifyEvent);
+         return true;
+      }
+
+      // got some data, post it
+      gReceiveEvent.tag = currentSock->fd;
+      gReceiveEvent.size = ConnectedReceiveEventHeaderSize +
+         bytesRead;
+      Game->postEvent(gReceiveEvent);
+   }
+
+   return false;
+}
+
+// Accepts up to maxAccepts pending connections.  Sets drained once there are none left.
+static void processListening(Socket* currentSock, U32 maxAccepts, bool& drained)
+{
+   drained = false;
+
+   for (U32 accepts = 0; accepts < maxAccepts; ++accepts)
+   {
+      NetSocket incoming =
+         Net::accept(currentSock->fd, &gAcceptEvent.address);
+      if (incoming == InvalidSocket)
+      {
+         drained = true;
+         return;
+      }
+
+      gAcceptEvent.portTag = currentSock->fd;
+      gAcceptEvent.connectionTag = incoming;
+      Net::setBlocking(incoming, false);
+      addPolledSocket(incoming, Connected);
+      Game->postEvent(gAcceptEvent);
+   }
+}
+
+// Checks whether a name lookup has finished and starts connecting if so.
+// Returns true if the socket should be removed.
+static bool processNameLookup(Socket* currentSock)
+{
+   char out_h_addr[1024];
+   int out_h_length = 0;
+   sockaddr_in ipAddr;
+   bool removeSock = false;
+
+   // is the lookup complete?
+   if (!gNetAsync.checkLookup(
+          currentSock->fd, out_h_addr, &out_h_length,
+          sizeof(out_h_addr)))
+      return false;
+
+   gNotifyEvent.tag = currentSock->fd;
+   if (out_h_length == -1)
+   {
+      Con::errorf("DNS lookup failed: %s", currentSock->remoteAddr);
+      gNotifyEvent.state = ConnectedNotifyEvent::DNSFailed;
+      removeSock = true;
+   }
+   else
+   {
+      // try to connect
+      dMemcpy(&(ipAddr.sin_addr.s_addr), out_h_addr, out_h_length);
+      ipAddr.sin_port = currentSock->remotePort;
+      ipAddr.sin_family = AF_INET;
+      if(::connect(currentSock->fd, (struct sockaddr *)&ipAddr,
+                   sizeof(ipAddr)) == -1)
+      {
+         if (errno == EINPROGRESS)
+         {
+            gNotifyEvent.state = ConnectedNotifyEvent::DNSResolved;
+            setPolledSocketState(currentSock, ConnectionPending);
+         }
+         else
+         {
+            Con::errorf("Error connecting to %s: %s",
+                        currentSock->remoteAddr, strerror(errno));
+            gNotifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
+            removeSock = true;
+         }
+      }
+      else
+      {
+         gNotifyEvent.state = ConnectedNotifyEvent::Connected;
+         setPolledSocketState(currentSock, Connected);
+      }
+   }
+   Game->postEvent(gNotifyEvent);
+   return removeSock;
+}
+
+#ifdef TORQUE_NET_EPOLL
+
+static void processReadySockets()
+{
+   // Collect newly ready sockets.
+   epoll_event events[NetEpollBatchSize];
+   S32 eventCount;
+   do
+   {
+      eventCount = epoll_wait(gEpollFd, events, NetEpollBatchSize, 0);
+      for (S32 i = 0; i < eventCount; ++i)
+      {
+         Socket* sock = (Socket*)events[i].data.ptr;
+         if (!sock->ready)
+         {
+            sock->ready = true;
+            gReadySockets.push_back(sock);
+         }
+      }
+   } while (eventCount == NetEpollBatchSize);
+
+   // Service the ready sockets; any not drained stay ready for the next frame.
+   for (S32 i = 0; i < gReadySockets.size(); /* incremented below */)
+   {
+      Socket* currentSock = gReadySockets[i];
+      bool removeSock = false;
+      bool drained = true;
+
+      switch (currentSock->state)
+      {
+         case ConnectionPending:
+            removeSock = processConnectionPending(currentSock);
+            // A connect that completed may already have data waiting.
+            drained = currentSock->state != Connected;
+            break;
+         case Connected:
+            removeSock = processConnected(currentSock, MaxPolledSocketReads, drained);
+            break;
+         case Listening:
+            processListening(currentSock, MaxPolledSocketReads, drained);
+            break;
+         default:
+            break;
+      }
+
+      if (removeSock)
+      {
+         // Removal also takes the socket off the ready list.
+         Net::closeConnectTo(currentSock->fd);
+      }
+      else if (drained)
+      {
+         currentSock->ready = false;
+         gReadySockets.erase(i);
+      }
+      else
+      {
+         i++;
+      }
+   }
+
+   // Name lookups have no descriptor to wait on, so check them directly.
+   for (S32 i = 0; i < gLookupSockets.size(); /* incremented below */)
+   {
+      Socket* currentSock = gLookupSockets[i];
+      if (processNameLookup(currentSock))
+         Net::closeConnectTo(currentSock->fd);
+      else if (i < gLookupSockets.size() && gLookupSockets[i] == currentSock)
+         i++;
+   }
+}
+
+#endif // TORQUE_NET_EPOLL
+
+static void processPolledSockets()
+{
+   if (gPolledSockets.size() == 0)
+      return;
+
+#ifdef TORQUE_NET_EPOLL
+   if (gEpollFd != -1)
+   {
+      processReadySockets();
+      return;
+   }
+#endif
+
+   bool drained;
+   for (S32 i = 0; i < gPolledSockets.size();
+        /* no increment, this is done at end of loop body */)
+   {
+      bool removeSock = false;
+      Socket* currentSock = gPolledSockets[i];
+      switch (currentSock->state)
+      {
+         case InvalidState:
+            Con::errorf("Error, InvalidState socket in polled sockets list");
+            break;
+         case ConnectionPending:
+            removeSock = processConnectionPending(currentSock);
+            break;
+         case Connected:
+            removeSock = processConnected(currentSock, 1, drained);
+            break;
+         case NameLookupRequired:
+            removeSock = processNameLookup(currentSock);
+            break;
+         case Listening:
+            processListening(currentSock, 1, drained);
+            break;
+      }
+
+      // only increment index if we're not removing the connection, since
+      // the removal will shift the indices down by one
+      if (removeSock)
+         Net::closeConnectTo(currentSock->fd);
+      else
+         i++;
+   }
+}
+
+//-----------------------------------------------------------------------------
+// Socket benchmarks.
+//
+// Open a loopback listen port with "$Benchmark::NetConnections" (default 1000)
+// mostly idle connections. One iteration sends to roughly one connection in a
+// hundred and runs processPolledSockets(), with the reactor or with the
+// fallback that walks every socket.
+//-----------------------------------------------------------------------------
+
+#ifndef TORQUE_SHIPPING
+
+class NetSocketBenchmark : public BenchmarkCase
+{
+public:
+   NetSocketBenchmark(const char* pSuiteName, const char* pCaseName) :
+      BenchmarkCase(pSuiteName, pCaseName),
+      mFrame(0)
+   {
+   }
+
+   virtual void setUp()
+   {
+      const char* pConnections = Con::getVariable("$Benchmark::NetConnections");
+      const U32 connections = *pConnections ? dAtoi(pConnections) : 1000;
+
+      // Remember the sockets that already exist so only ours are closed afterwards.
+      mExisting.merge(gPolledSockets);
+
+      NetSocket listenSocket = Net::openListenPort(0);
+      if (listenSocket == InvalidSocket)
+      {
+         fail("Could not open a loopback listen port.");
+         return;
+      }
+
+      sockaddr_in listenAddress;
+      socklen_t listenLength = sizeof(listenAddress);
+      getsockname(listenSocket, (sockaddr*)&listenAddress, &listenLength);
+      ::listen(listenSocket, getMax(connections, (U32)4));
+
+      char address[64];
+      dSprintf(address, sizeof(address), "127.0.0.1:%d", ntohs(listenAddress.sin_port));
+
+      for (U32 i = 0; i < connections; ++i)
+      {
+         NetSocket client = Net::openConnectTo(address);
+         if (client == InvalidSocket)
+            break;
+         mClients.push_back(client);
+      }
+
+      // Let the connections complete and be accepted.
+      const U32 settleTime = Platform::getRealMilliseconds();
+      while (Platform::getRealMilliseconds() - settleTime < 1000 && gPolledSockets.size() < mExisting.size() + 1 + mClients.size() * 2)
+         processPolledSockets();
+      processPolledSockets();
+   }
+
+   virtual void tearDown()
+   {
+      // Close everything the benchmark opened.
+      for (S32 i = gPolledSockets.size() - 1; i >= 0; --i)
+      {
+         if (i >= gPolledSockets.size())
+            continue;
+
+         bool found = false;
+         for (S32 j = 0; j < mExisting.size() && !found; ++j)
+            found = mExisting[j] == gPolledSockets[i];
+
+         if (!found)
+            Net::closeConnectTo(gPolledSockets[i]->fd);
+      }
+
+      mClients.clear();
+      mExisting.clear();
+   }
+
+protected:
+   void processFrames(const U32 frames)
+   {
+      for (U32 frame = 0; frame < frames; ++frame, ++mFrame)
+      {
+         // Keep roughly one connection in a hundred busy.
+         for (S32 i = mFrame % 100; i < mClients.size(); i += 100)
+            ::send(mClients[i], "x", 1, MSG_DONTWAIT | MSG_NOSIGNAL);
+
+         processPolledSockets();
+      }
+   }
+
+   Vector<Socket*> mExisting;
+   Vector<NetSocket> mClients;
+   U32 mFrame;
+};
+
+BENCHMARK_CASE_F(NetSockets, NetSocketBenchmark, Reactor)
+{
+   processFrames(iterations);
+}
+
+BENCHMARK_CASE_F(NetSockets, NetSocketBenchmark, Polling)
+{
+#ifdef TORQUE_NET_EPOLL
+   const int epollFd = gEpollFd;
+   gEpollFd = -1;
+   processFrames(iterations);
+   gEpollFd = epollFd;
+#else
+   processFrames(iterations);
+#endif
+}
+
+#endif // TORQUE_SHIPPING
+
 void Net::process()
 {
    sockaddr sa;
 
    PacketReceiveEvent receiveEvent;
+
+   bool udpThreaded = false;
+#ifdef TORQUE_NET_IO_THREAD
+   if(gNetIOThread)
+   {
+      netDrainIOThread(receiveEvent);
+      udpThreaded = true;
+   }
+#endif
+
    for(;;)
    {
       U32 addrLen = sizeof(sa);
       S32 bytesRead = -1;
-      if(udpSocket != InvalidSocket)
+      if(udpSocket != InvalidSocket && !udpThreaded)
          bytesRead = recvfrom(udpSocket, (char *) receiveEvent.data, MaxPacketDataSize, 0, &sa, &addrLen);
       if(bytesRead == -1 && ipxSocket != InvalidSocket)
       {
@@ -480,180 +1571,17 @@ void Net::process()
          continue;
       if(bytesRead <= 0)
          continue;
+      if(netConsumeLoadTestPacket(na, receiveEvent.data, bytesRead))
+         continue;
       receiveEvent.size = PacketReceiveEventHeaderSize + bytesRead;
       Game->postEvent(receiveEvent);
    }
 
    // process the polled sockets.  This blob of code performs functions
    // similar to WinsockProc in winNet.cc
-
-   if (gPolledSockets.size() == 0)
-      return;
-
-   static ConnectedNotifyEvent notifyEvent;
-   static ConnectedAcceptEvent acceptEvent;
-   static ConnectedReceiveEvent cReceiveEvent;
-
-   S32 optval;
-   socklen_t optlen = sizeof(S32);
-   S32 bytesRead;
-   Net::Error err;
-   bool removeSock = false;
-   Socket *currentSock = NULL;
-   sockaddr_in ipAddr;
-   NetSocket incoming = InvalidSocket;
-   char out_h_addr[1024];
-   int out_h_length = 0;
-
-   for (S32 i = 0; i < gPolledSockets.size(); 
-        /* no increment, this is done at end of loop body */)
-   {
-      removeSock = false;
-      currentSock = gPolledSockets[i];
-      switch (currentSock->state)
-      {
-         case InvalidState:
-            Con::errorf("Error, InvalidState socket in polled sockets list");
-            break;
-         case ConnectionPending:
-            notifyEvent.tag = currentSock->fd;
-            // see if it is now connected
-            if (getsockopt(currentSock->fd, SOL_SOCKET, SO_ERROR, 
-                           &optval, &optlen) == -1)
-            {
-               Con::errorf("Error getting socket options: %s", strerror(errno));
-               notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
-               Game->postEvent(notifyEvent);
-               removeSock = true;
-            }
-            else
-            {
-               if (optval == EINPROGRESS)
-                  // still connecting...
-                  break;
-
-               if (optval == 0)
-               {
-                  // connected
-                  notifyEvent.state = ConnectedNotifyEvent::Connected;
-                  Game->postEvent(notifyEvent);
-                  currentSock->state = Connected;
-               }
-               else
-               {
-                  // some kind of error
-                  Con::errorf("Error connecting: %s", strerror(errno));
-                  notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
-                  Game->postEvent(notifyEvent);
-                  removeSock = true;
-               }
-            }
-            break;
-         case Connected:
-            bytesRead = 0;
-            // try to get some data
-            err = Net::recv(currentSock->fd, cReceiveEvent.data, 
-                            MaxPacketDataSize, &bytesRead);
-            if(err == Net::NoError)
-            {
-               if (bytesRead > 0)
-               {
-                  // got some data, post it
-                  cReceiveEvent.tag = currentSock->fd;
-                  cReceiveEvent.size = ConnectedReceiveEventHeaderSize + 
-                     bytesRead;
-                  Game->postEvent(cReceiveEvent);
-               }
-               else 
-               {
-                  // zero bytes read means EOF
-                  if (bytesRead < 0)
-                     // ack! this shouldn't happen
-                     Con::errorf("Unexpected error on socket: %s", 
-                                 strerror(errno));
-
-                  notifyEvent.tag = currentSock->fd;
-                  notifyEvent.state = ConnectedNotifyEvent::Disconnected;
-                  Game->postEvent(notifyEvent);
-                  removeSock = true;
-               }
-            }
-            else if (err != Net::NoError && err != Net::WouldBlock)
-            {
-               Con::errorf("Error reading from socket: %s", strerror(errno));
-               notifyEvent.tag = currentSock->fd;
-               notifyEvent.state = ConnectedNotifyEvent::Disconnected;
-               Game->postEvent(notifyEvent);
-               removeSock = true;
-            }
-            break;
-         case NameLookupRequired:
-            // is the lookup complete?
-            if (!gNetAsync.checkLookup(
-                   currentSock->fd, out_h_addr, &out_h_length, 
-                   sizeof(out_h_addr)))
-               break;
-            
-            notifyEvent.tag = currentSock->fd;
-            if (out_h_length == -1)
-            {
-               Con::errorf("DNS lookup failed: %s", currentSock->remoteAddr);
-               notifyEvent.state = ConnectedNotifyEvent::DNSFailed;
-               removeSock = true;
-            }
-            else
-            {
-               // try to connect
-               dMemcpy(&(ipAddr.sin_addr.s_addr), out_h_addr, out_h_length);
-               ipAddr.sin_port = currentSock->remotePort;
-               ipAddr.sin_family = AF_INET;
-               if(::connect(currentSock->fd, (struct sockaddr *)&ipAddr, 
-                            sizeof(ipAddr)) == -1)
-               {
-                  if (errno == EINPROGRESS)
-                  {
-                     notifyEvent.state = ConnectedNotifyEvent::DNSResolved;
-                     currentSock->state = ConnectionPending;
-                  }
-                  else
-                  {
-                     Con::errorf("Error connecting to %s: %s", 
-                                 currentSock->remoteAddr, strerror(errno));
-                     notifyEvent.state = ConnectedNotifyEvent::ConnectFailed;
-                     removeSock = true;
-                  }
-               }
-               else
-               {
-                  notifyEvent.state = ConnectedNotifyEvent::Connected;
-                  currentSock->state = Connected;
-               }
-            }
-            Game->postEvent(notifyEvent);			
-            break;
-    	 case Listening:
-            incoming = 
-               Net::accept(currentSock->fd, &acceptEvent.address);
-            if(incoming != InvalidSocket)
-            {
-               acceptEvent.portTag = currentSock->fd;
-               acceptEvent.connectionTag = incoming;
-               setBlocking(incoming, false);
-               addPolledSocket(incoming, Connected);
-               Game->postEvent(acceptEvent);
-            }
-            break;
-      }
-
-      // only increment index if we're not removing the connection, since 
-      // the removal will shift the indices down by one
-      if (removeSock)
-         closeConnectTo(currentSock->fd);
-      else
-         i++;
-   }
+   processPolledSockets();
 }
-                 
+
 NetSocket Net::openSocket()
 {
    int retSocket;
@@ -939,4 +1867,6 @@ Net::Error getLastError()
    return Net::UnknownError;
 }
 
+//-----------------------------------------------------------------------------
 
+#include "platformX86UNIX/x86UNIXNet_ScriptBinding.h"
@@ -0,0 +1,87 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! Returns statistics for the UDP I/O thread enabled with $Net::ioThread.
+    @return Returns "received sent dropped receiveBatches sendBatches sendOverflows averageLatencyUs maxLatencyUs",
+    where sendOverflows counts packets dropped because the send ring was full, and the latency is the time packets wait in the receive ring before the main loop drains them.
+    Returns an empty string if the I/O thread is not running.
+    @sa startNetLoadTest
+*/
+ConsoleFunctionWithDocs( getNetIOStats, ConsoleString, 1, 1, () )
+{
+#ifdef TORQUE_NET_IO_THREAD
+   if ( gNetIOThread == NULL )
+      return "";
+
+   const NetIOStats& stats = gNetIOThread->mStats;
+   const U64 averageLatency = stats.packetsReceived ? stats.latencyTotal / stats.packetsReceived : 0;
+
+   char* pBuffer = Con::getReturnBuffer(128);
+   dSprintf( pBuffer, 128, "%u %u %u %u %u %u %u %u",
+      stats.packetsReceived, stats.packetsSent, stats.packetsDropped,
+      stats.receiveBatches, stats.sendBatches, stats.sendOverflows,
+      (U32)averageLatency, (U32)stats.latencyMax );
+   return pBuffer;
+#else
+   return "";
+#endif
+}
+
+//------------------------------------------------------------------------------
+
+/*! Starts a loopback load test against the open UDP port.
+    A separate thread sends timestamped packets to the port at a fixed rate; they are counted
+    and timed when the main loop processes them rather than being passed to the game.
+    @param packetsPerSecond The rate to send packets at.
+    @param packetSize The size of each packet in bytes (default 64).
+    @param durationMs How long to send for in milliseconds (default 5000).
+    @return Returns true if the test started, false if no port is open or a test is already running.
+    @sa getNetLoadTestResults
+*/
+ConsoleFunctionWithDocs( startNetLoadTest, ConsoleBool, 2, 4, (packetsPerSecond, [packetSize], [durationMs]) )
+{
+   const U32 packetsPerSecond = getMax( dAtoi(argv[1]), 1 );
+   const U32 packetSize = argc > 2 ? dAtoi(argv[2]) : 64;
+   const U32 duration = argc > 3 ? dAtoi(argv[3]) : 5000;
+
+   return netStartLoadTest( packetsPerSecond, packetSize, duration );
+}
+
+//------------------------------------------------------------------------------
+
+/*! Returns the results of the last loopback load test.
+    @return Returns "sent received packetsPerSecond averageLatencyUs maxLatencyUs running".
+    @sa startNetLoadTest
+*/
+ConsoleFunctionWithDocs( getNetLoadTestResults, ConsoleString, 1, 1, () )
+{
+   const NetLoadTestStats& stats = gNetLoadTestStats;
+   const U32 elapsed = stats.endTime > stats.startTime ? stats.endTime - stats.startTime : 0;
+   const U32 packetsPerSecond = elapsed ? (U32)((U64)stats.packetsReceived * 1000 / elapsed) : 0;
+   const U64 averageLatency = stats.packetsReceived ? stats.latencyTotal / stats.packetsReceived : 0;
+
+   char* pBuffer = Con::getReturnBuffer(128);
+   dSprintf( pBuffer, 128, "%u %u %u %u %u %d",
+      stats.packetsSent, stats.packetsReceived, packetsPerSecond,
+      (U32)averageLatency, (U32)stats.latencyMax, gNetLoadTestRunning );
+   return pBuffer;
+}
@@ -87,10 +87,10 @@ static S32 ParseCommandLine(S32 argc, const char **argv,
          dPrintf("gcc: %s\n", __VERSION__);
          return 1;
       }
-      if (dStrcmp(argv[i], "-dedicated") == 0)
+      if (dStrcmp(argv[i], "-dedicated") == 0 || dStrcmp(argv[i], "-headless") == 0)
       {
          foundDedicated = true;
-         // no continue because dedicated is also handled by script
+         // no continue because dedicated and headless are also handled by the game
       }
       if (dStrcmp(argv[i], "-dsleep") == 0)
       {
@@ -255,36 +255,141 @@ void SimManagerNameDictionary::remove(SimObject* obj)
 //---------------------------------------------------------------------------
 //---------------------------------------------------------------------------
 
+// Orders the writes to a page or slot against the lock-free readers in
+// SimIdDictionary::find().
+#if defined(TORQUE_COMPILER_VISUALC)
+#include <intrin.h>
+#define SIM_ID_BARRIER() _ReadWriteBarrier()
+#elif defined(TORQUE_COMPILER_GCC)
+#define SIM_ID_BARRIER() __sync_synchronize()
+#else
+#define SIM_ID_BARRIER()
+#endif
+
 SimIdDictionary::SimIdDictionary()
 {
-   for(S32 i = 0; i < DefaultTableSize; i++)
-      table[i] = NULL;
+   for(S32 i = 0; i < DirectorySize; i++)
+      directory[i] = NULL;
+   for(S32 i = 0; i < OverflowTableSize; i++)
+      overflowTable[i] = NULL;
+   retiredPages = NULL;
+   reclaimablePages = NULL;
+   pageCount = 0;
+   lastGeneration = 0;
+   highestPage = 0;
    mutex = Mutex::createMutex();
 }
 
 SimIdDictionary::~SimIdDictionary()
 {
+   for(S32 i = 0; i < DirectorySize; i++)
+      dFree((void*)directory[i]);
+   freePages(retiredPages);
+   freePages(reclaimablePages);
    Mutex::destroyMutex(mutex);
 }
 
+SimIdDictionary::Page* SimIdDictionary::allocatePage(U32 pageIndex)
+{
+   // Called with the mutex held.
+   Page* page = (Page*)dMalloc(sizeof(Page));
+   dMemset((void*)page, 0, sizeof(Page));
+
+   // The page must be cleared before readers can see it.
+   SIM_ID_BARRIER();
+   directory[pageIndex] = page;
+   pageCount++;
+
+   return page;
+}
+
+void SimIdDictionary::retirePage(U32 pageIndex)
+{
+   // Called with the mutex held.  Readers may still hold the page, so it is
+   // only unpublished here.
+   Page* page = directory[pageIndex];
+   directory[pageIndex] = NULL;
+   pageCount--;
+
+   page->nextRetired = retiredPages;
+   retiredPages = page;
+}
+
+void SimIdDictionary::freePages(Page *page)
+{
+   while(page)
+   {
+      Page* next = page->nextRetired;
+      dFree(page);
+      page = next;
+   }
+}
+
+void SimIdDictionary::reclaimPages()
+{
+   Mutex::lockMutex(mutex);
+
+   // Anything retired before the last call has had a whole time advance for
+   // lookups that started on it to finish.
+   freePages(reclaimablePages);
+   reclaimablePages = retiredPages;
+   retiredPages = NULL;
+
+   Mutex::unlockMutex(mutex);
+}
+
 void SimIdDictionary::insert(SimObject* obj)
 {
    Mutex::lockMutex(mutex);
 
-   S32 idx = obj->getId() & TableBitMask;
-   obj->nextIdObject = table[idx];
-   AssertFatal( obj->nextIdObject != obj, "SimIdDictionary::insert - Creating Infinite Loop linking to self!" );
-   table[idx] = obj;
+   const U32 id = obj->getId();
+   if(id < DirectIdLimit)
+   {
+      const U32 pageIndex = id >> PageShift;
+      Page* page = directory[pageIndex];
+      if(page == NULL)
+         page = allocatePage(pageIndex);
+      highestPage = getMax(highestPage, pageIndex);
+
+      Slot& slot = page->slots[id & PageMask];
+      obj->nextIdObject = slot.object;
+      AssertFatal( obj->nextIdObject != obj, "SimIdDictionary::insert - Creating Infinite Loop linking to self!" );
+      if(slot.object == NULL)
+         page->liveCount++;
+
+      // A reader that sees the new generation must also see the new object.
+      slot.generation = 0;
+      SIM_ID_BARRIER();
+      slot.object = obj;
+      SIM_ID_BARRIER();
+      slot.generation = nextGeneration();
+   }
+   else
+   {
+      S32 idx = id & OverflowBitMask;
+      obj->nextIdObject = overflowTable[idx];
+      AssertFatal( obj->nextIdObject != obj, "SimIdDictionary::insert - Creating Infinite Loop linking to self!" );
+      overflowTable[idx] = obj;
+   }
 
    Mutex::unlockMutex(mutex);
 }
 
 SimObject* SimIdDictionary::find(S32 id)
 {
+   // Direct ids are read without locking.
+   if(U32(id) < DirectIdLimit)
+   {
+      Page* page = directory[U32(id) >> PageShift];
+      if(page == NULL)
+         return NULL;
+
+      return page->slots[U32(id) & PageMask].object;
+   }
+
    Mutex::lockMutex(mutex);
 
-   S32 idx = id & TableBitMask;
-   SimObject *walk = table[idx];
+   SimObject *walk = overflowTable[id & OverflowBitMask];
    while(walk)
    {
       if(walk->getId() == U32(id))
@@ -300,15 +405,87 @@ SimObject* SimIdDictionary::find(S32 id)
    return NULL;
 }
 
+SimObject* SimIdDictionary::find(S32 id, U32 generation)
+{
+   if(U32(id) >= DirectIdLimit)
+      return find(id);
+
+   // Zero is never a valid generation; it marks a slot being written.
+   if(generation == 0)
+      return NULL;
+
+   Page* page = directory[U32(id) >> PageShift];
+   if(page == NULL)
+      return NULL;
+
+   // The generation is checked either side of reading the object so that a
+   // concurrent insert or remove can't pair it with the wrong object.
+   const Slot& slot = page->slots[U32(id) & PageMask];
+   if(slot.generation != generation)
+      return NULL;
+   SIM_ID_BARRIER();
+   SimObject* obj = slot.object;
+   SIM_ID_BARRIER();
+   return slot.generation == generation ? obj : NULL;
+}
+
+U32 SimIdDictionary::getGeneration(S32 id)
+{
+   if(U32(id) >= DirectIdLimit)
+      return 0;
+
+   Page* page = directory[U32(id) >> PageShift];
+   return page ? page->slots[U32(id) & PageMask].generation : 0;
+}
+
 void SimIdDictionary::remove(SimObject* obj)
 {
    Mutex::lockMutex(mutex);
 
-   SimObject **walk = &table[obj->getId() & TableBitMask];
-   while(*walk && *walk != obj)
-      walk = &((*walk)->nextIdObject);
-   if(*walk)
-      *walk = obj->nextIdObject;
+   const U32 id = obj->getId();
+   if(id >= DirectIdLimit)
+   {
+      SimObject** walk = &overflowTable[id & OverflowBitMask];
+      while(*walk && *walk != obj)
+         walk = &((*walk)->nextIdObject);
+      if(*walk)
+         *walk = obj->nextIdObject;
+
+      Mutex::unlockMutex(mutex);
+      return;
+   }
+
+   const U32 pageIndex = id >> PageShift;
+   Page* page = directory[pageIndex];
+   if(page == NULL)
+   {
+      Mutex::unlockMutex(mutex);
+      return;
+   }
+
+   Slot& slot = page->slots[id & PageMask];
+   if(slot.object == obj)
+   {
+      // The object found under the id changes, so does the generation.
+      slot.generation = 0;
+      SIM_ID_BARRIER();
+      slot.object = obj->nextIdObject;
+      SIM_ID_BARRIER();
+      slot.generation = nextGeneration();
+
+      // Keep the newest page so that creating and deleting objects at the
+      // end of the id range doesn't allocate and free it over and over.
+      if(slot.object == NULL && --page->liveCount == 0 && pageIndex != highestPage)
+         retirePage(pageIndex);
+   }
+   else
+   {
+      SimObject* walk = slot.object;
+      while(walk && walk->nextIdObject != obj)
+         walk = walk->nextIdObject;
+      if(walk)
+         walk->nextIdObject = obj->nextIdObject;
+   }
 
    Mutex::unlockMutex(mutex);
 }
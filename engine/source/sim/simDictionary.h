@@ -87,24 +87,81 @@ public:
 //----------------------------------------------------------------------------
 /// Map of ID's to SimObjects.
 ///
-/// Provides fast lookup for ID->object and
-/// for fast removal of an object given object*
+/// Ids are handed out mostly sequentially so they index directly into a
+/// table of lazily allocated pages.  find() reads the table without taking
+/// the mutex; only insert() and remove() lock.  A page that empties is
+/// unpublished straight away but only freed by a later reclaimPages(), so a
+/// lookup that was already reading it stays safe.  The few ids beyond the
+/// direct range (such as the root group) fall back to a locked hash.
+///
+/// Each slot carries a generation that changes whenever the object found
+/// under its id changes.  Ids can be reused, by registerObject(id) and by
+/// datablocks, so code holding an id across frames can keep the generation
+/// from getGeneration() and look the id up with it to catch a stale id.
+///
+/// Objects sharing an id are chained through SimObject::nextIdObject with
+/// the most recently inserted object found first.
 class SimIdDictionary
 {
    enum
    {
-      DefaultTableSize = 4096,
-      TableBitMask = 4095
+      PageShift = 12,
+      PageSize = 1 << PageShift,
+      PageMask = PageSize - 1,
+      DirectoryShift = 12,
+      DirectorySize = 1 << DirectoryShift,
+      DirectIdLimit = PageSize * DirectorySize,
+
+      OverflowTableSize = 4096,
+      OverflowBitMask = OverflowTableSize - 1
+   };
+
+   struct Slot
+   {
+      SimObject* volatile object;
+      volatile U32 generation;
+   };
+
+   struct Page
+   {
+      Slot slots[PageSize];
+      U32 liveCount;          ///< Slots holding an object
+      Page *nextRetired;
    };
-   SimObject *table[DefaultTableSize];
+
+   Page* volatile directory[DirectorySize];
+   SimObject *overflowTable[OverflowTableSize];
+   Page *retiredPages;        ///< Emptied since the last reclaimPages()
+   Page *reclaimablePages;    ///< Freed by the next reclaimPages()
+   U32 pageCount;
+   U32 lastGeneration;
+   U32 highestPage;           ///< Page of the highest direct id inserted, which is kept
 
    void *mutex;
 
+   Page* allocatePage(U32 pageIndex);
+   void retirePage(U32 pageIndex);
+   U32 nextGeneration() { if(++lastGeneration == 0) ++lastGeneration; return lastGeneration; }
+   static void freePages(Page *page);
+
 public:
    void insert(SimObject* obj);
    void remove(SimObject* obj);
    SimObject* find(S32 id);
 
+   /// Find the object with an id only if the id's generation still matches,
+   /// i.e. the object found under it hasn't changed since getGeneration().
+   /// Ids beyond the direct range have no generation and always match.
+   SimObject* find(S32 id, U32 generation);
+   U32 getGeneration(S32 id);
+
+   /// Free pages that emptied before the previous call.  Called by the Sim
+   /// once per time advance.
+   void reclaimPages();
+
+   /// Number of pages in use by the direct table.
+   U32 getPageCount() const { return pageCount; }
+
    SimIdDictionary();
    ~SimIdDictionary();
 };
@@ -47,6 +47,8 @@ void *gEventQueueMutex;
 SimEvent *gEventQueue;
 U32 gEventSequence;
 
+extern SimIdDictionary *gIdDictionary;
+
 //---------------------------------------------------------------------------
 // event queue init/shutdown
 
@@ -259,6 +261,10 @@ void advanceToTime(SimTime targetTime)
 {
    AssertFatal(targetTime >= getCurrentTime(), "EventQueue::process: cannot advance to time in the past.");
 
+   // Free id pages that emptied during the previous advance.
+   if(gIdDictionary)
+      gIdDictionary->reclaimPages();
+
    Mutex::lockMutex(gEventQueueMutex);
    gTargetTime = targetTime;
    while(gEventQueue && gEventQueue->time <= targetTime)
@@ -0,0 +1,335 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_H_
+#include "testing/benchmark.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _FINDMATCH_H_
+#include "string/findMatch.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#if defined(TORQUE_OS_WIN32)
+#include <windows.h>
+#elif defined(TORQUE_OS_MAC) || defined(TORQUE_OS_IOS)
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
+
+#include <math.h>
+
+// Script bindings.
+#include "benchmark_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+BenchmarkCase* BenchmarkCase::smpFirst = NULL;
+
+//-----------------------------------------------------------------------------
+
+BenchmarkCase::BenchmarkCase( const char* pSuiteName, const char* pCaseName ) :
+    mpSuiteName( pSuiteName ),
+    mpCaseName( pCaseName ),
+    mpFailure( NULL )
+{
+    // Link into the registered cases.
+    mpNext = smpFirst;
+    smpFirst = this;
+}
+
+//-----------------------------------------------------------------------------
+
+BenchmarkRunner::BenchmarkRunner() :
+    mpFilter( NULL ),
+    mWarmup( 3 ),
+    mRepetitions( 20 ),
+    mThreads( 1 ),
+    mMinSampleTime( 5.0 ),
+    mFailures( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+F64 BenchmarkRunner::getTime( void )
+{
+#if defined(TORQUE_OS_WIN32)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency( &frequency );
+    QueryPerformanceCounter( &counter );
+    return (F64)counter.QuadPart * 1000000.0 / (F64)frequency.QuadPart;
+#elif defined(TORQUE_OS_MAC) || defined(TORQUE_OS_IOS)
+    static mach_timebase_info_data_t timebase = { 0, 0 };
+    if ( timebase.denom == 0 )
+        mach_timebase_info( &timebase );
+    return (F64)mach_absolute_time() * (F64)timebase.numer / (F64)timebase.denom / 1000.0;
+#else
+    struct timespec now;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    return (F64)now.tv_sec * 1000000.0 + (F64)now.tv_nsec / 1000.0;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+U32 BenchmarkRunner::calibrate( BenchmarkCase* pCase ) const
+{
+    const F64 targetTime = mMinSampleTime * 1000.0;
+    const U32 maxIterations = 1 << 24;
+
+    // Grow the iteration count until a single sample takes long enough to time.
+    U32 iterations = 1;
+    while ( iterations < maxIterations )
+    {
+        const F64 startTime = getTime();
+        pCase->run( iterations );
+        const F64 elapsed = getTime() - startTime;
+
+        if ( elapsed >= targetTime || pCase->hasFailed() )
+            break;
+
+        // Scale towards the target, at most by ten at a time.
+        const F64 scale = elapsed > 0.0 ? getMin( (targetTime / elapsed) * 1.2, 10.0 ) : 10.0;
+        iterations = getMin( (U32)(iterations * getMax( scale, 2.0 )), maxIterations );
+    }
+
+    return iterations;
+}
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+    struct BenchmarkWorker
+    {
+        BenchmarkCase*  mpCase;
+        U32             mIterations;
+        F64             mElapsed;
+    };
+
+    void runBenchmarkWorker( void* pData )
+    {
+        BenchmarkWorker* pWorker = (BenchmarkWorker*)pData;
+
+        const F64 startTime = BenchmarkRunner::getTime();
+        pWorker->mpCase->run( pWorker->mIterations );
+        pWorker->mElapsed = BenchmarkRunner::getTime() - startTime;
+    }
+
+    S32 QSORT_CALLBACK compareSamples( const void* a, const void* b )
+    {
+        const F64 sampleA = *(const F64*)a;
+        const F64 sampleB = *(const F64*)b;
+        return sampleA < sampleB ? -1 : sampleA > sampleB ? 1 : 0;
+    }
+
+    F64 getPercentile( const Vector<F64>& sortedSamples, const F64 percentile )
+    {
+        // Nearest-rank.
+        const S32 rank = (S32)mCeil( (F32)(percentile * 0.01 * sortedSamples.size()) );
+        return sortedSamples[mClamp( rank - 1, 0, sortedSamples.size() - 1 )];
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void BenchmarkRunner::sample( BenchmarkCase* pCase, const U32 iterations, const U32 threads, Vector<F64>& samples ) const
+{
+    // Single-threaded?
+    if ( threads <= 1 )
+    {
+        const F64 startTime = getTime();
+        pCase->run( iterations );
+        samples.push_back( getTime() - startTime );
+        return;
+    }
+
+    // Run the case on all threads at once.
+    Vector<BenchmarkWorker> workers;
+    workers.setSize( threads );
+    VectorPtr<Thread*> workerThreads;
+    for ( U32 n = 0; n < threads; ++n )
+    {
+        workers[n].mpCase = pCase;
+        workers[n].mIterations = iterations;
+        workers[n].mElapsed = 0.0;
+        workerThreads.push_back( new Thread( runBenchmarkWorker, &workers[n], false ) );
+    }
+
+    for ( U32 n = 0; n < threads; ++n )
+        workerThreads[n]->start();
+
+    for ( U32 n = 0; n < threads; ++n )
+    {
+        workerThreads[n]->join();
+        delete workerThreads[n];
+        samples.push_back( workers[n].mElapsed );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 BenchmarkRunner::run( void )
+{
+    mResults.clear();
+    mFailures = 0;
+
+    // Cases register in reverse so gather them first.
+    VectorPtr<BenchmarkCase*> cases;
+    char caseName[256];
+    for ( BenchmarkCase* pCase = BenchmarkCase::getFirst(); pCase != NULL; pCase = pCase->getNext() )
+    {
+        dSprintf( caseName, sizeof(caseName), "%s.%s", pCase->getSuiteName(), pCase->getCaseName() );
+        if ( mpFilter != NULL && *mpFilter != 0 && !FindMatch::isMatch( mpFilter, caseName, false ) )
+            continue;
+
+        cases.push_front( pCase );
+    }
+
+    Con::printSeparator();
+    Con::printf( "Benchmarks Starting (%d case(s), %d warmup, %d repetitions, %d thread(s))...", cases.size(), mWarmup, mRepetitions, mThreads );
+    Con::printf( "%-40s %10s %12s %12s %12s %12s %12s", "Case", "Iterations", "Min ns", "Median ns", "P90 ns", "P99 ns", "StdDev ns" );
+
+    Vector<F64> samples;
+    for ( S32 caseIndex = 0; caseIndex < cases.size(); ++caseIndex )
+    {
+        BenchmarkCase* pCase = cases[caseIndex];
+        const U32 threads = pCase->isThreadSafe() ? mThreads : 1;
+
+        pCase->mpFailure = NULL;
+        pCase->setUp();
+
+        // Calibrate then warm up.
+        const U32 iterations = pCase->hasFailed() ? 0 : calibrate( pCase );
+        for ( U32 n = 0; n < mWarmup && !pCase->hasFailed(); ++n )
+            pCase->run( iterations );
+
+        // Sample.
+        samples.clear();
+        for ( U32 n = 0; n < mRepetitions && !pCase->hasFailed(); ++n )
+            sample( pCase, iterations, threads, samples );
+
+        pCase->tearDown();
+
+        // Failed cases have no timings to report.
+        if ( pCase->hasFailed() )
+        {
+            ++mFailures;
+            dSprintf( caseName, sizeof(caseName), "%s.%s", pCase->getSuiteName(), pCase->getCaseName() );
+            Con::warnf( "%-40s FAILED: %s", caseName, pCase->getFailure() );
+            continue;
+        }
+
+        // Convert to nanoseconds per iteration.
+        const F64 nanosecondsPerIteration = 1000.0 / (F64)iterations;
+        F64 total = 0.0;
+        for ( S32 n = 0; n < samples.size(); ++n )
+        {
+            samples[n] *= nanosecondsPerIteration;
+            total += samples[n];
+        }
+        dQsort( samples.address(), samples.size(), sizeof(F64), compareSamples );
+
+        BenchmarkResult result;
+        result.mpSuiteName = pCase->getSuiteName();
+        result.mpCaseName = pCase->getCaseName();
+        result.mIterations = iterations;
+        result.mSamples = samples.size();
+        result.mThreads = threads;
+        result.mMin = samples.first();
+        result.mMax = samples.last();
+        result.mMean = total / samples.size();
+        result.mMedian = getPercentile( samples, 50.0 );
+        result.mPercentile90 = getPercentile( samples, 90.0 );
+        result.mPercentile99 = getPercentile( samples, 99.0 );
+
+        F64 variance = 0.0;
+        for ( S32 n = 0; n < samples.size(); ++n )
+            variance += (samples[n] - result.mMean) * (samples[n] - result.mMean);
+        result.mStdDev = sqrt( variance / samples.size() );
+
+        mResults.push_back( result );
+
+        dSprintf( caseName, sizeof(caseName), "%s.%s", result.mpSuiteName, result.mpCaseName );
+        Con::printf( "%-40s %10d %12.1f %12.1f %12.1f %12.1f %12.1f",
+            caseName, iterations, result.mMin, result.mMedian, result.mPercentile90, result.mPercentile99, result.mStdDev );
+    }
+
+    if ( mFailures > 0 )
+        Con::warnf( "... Benchmarks Ended (%d failed).", mFailures );
+    else
+        Con::printf( "... Benchmarks Ended." );
+    Con::printSeparator();
+
+    return mResults.size();
+}
+
+//-----------------------------------------------------------------------------
+
+bool BenchmarkRunner::writeJson( const char* pFilename ) const
+{
+    FileStream stream;
+    if ( !stream.open( pFilename, FileStream::Write ) )
+    {
+        Con::warnf( "BenchmarkRunner::writeJson() - Could not open '%s' for writing.", pFilename );
+        return false;
+    }
+
+    char buffer[1024];
+    dSprintf( buffer, sizeof(buffer), "{\n  \"warmup\": %d,\n  \"repetitions\": %d,\n  \"threads\": %d,\n  \"failures\": %d,\n  \"results\": [\n", mWarmup, mRepetitions, mThreads, mFailures );
+    stream.writeStringBuffer( buffer );
+
+    for ( S32 n = 0; n < mResults.size(); ++n )
+    {
+        const BenchmarkResult& result = mResults[n];
+        dSprintf( buffer, sizeof(buffer),
+            "    { \"suite\": \"%s\", \"case\": \"%s\", \"iterations\": %d, \"samples\": %d, \"threads\": %d, "
+            "\"min_ns\": %.3f, \"mean_ns\": %.3f, \"median_ns\": %.3f, \"p90_ns\": %.3f, \"p99_ns\": %.3f, \"max_ns\": %.3f, \"stddev_ns\": %.3f }%s\n",
+            result.mpSuiteName, result.mpCaseName, result.mIterations, result.mSamples, result.mThreads,
+            result.mMin, result.mMean, result.mMedian, result.mPercentile90, result.mPercentile99, result.mMax, result.mStdDev,
+            n + 1 < mResults.size() ? "," : "" );
+        stream.writeStringBuffer( buffer );
+    }
+
+    stream.writeStringBuffer( "  ]\n}\n" );
+    stream.close();
+
+    return true;
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,181 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+#ifndef TORQUE_SHIPPING
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A single registered benchmark.
+///
+/// Derive a fixture from this to share set-up and tear-down between cases, then
+/// declare cases with BENCHMARK_CASE() or BENCHMARK_CASE_F().  "run()" must do
+/// the measured work "iterations" times; the runner picks the iteration count so
+/// that each sample is long enough to time reliably.  If the work cannot be done,
+/// call "fail()" and return; the case is then reported as failed and not timed.
+class BenchmarkCase
+{
+    friend class BenchmarkRunner;
+
+public:
+    BenchmarkCase( const char* pSuiteName, const char* pCaseName );
+    virtual ~BenchmarkCase() {}
+
+    /// Called once before the case is warmed up and sampled.
+    virtual void setUp( void ) {}
+
+    /// Called once after the case has been sampled.
+    virtual void tearDown( void ) {}
+
+    /// Do the measured work.
+    virtual void run( const U32 iterations ) = 0;
+
+    /// Whether "run()" may be called concurrently from several threads.
+    virtual bool isThreadSafe( void ) const { return false; }
+
+    /// Mark the case as failed.  The reason must outlive the run.
+    inline void fail( const char* pReason ) { mpFailure = pReason; }
+    inline bool hasFailed( void ) const { return mpFailure != NULL; }
+    inline const char* getFailure( void ) const { return mpFailure; }
+
+    inline const char* getSuiteName( void ) const { return mpSuiteName; }
+    inline const char* getCaseName( void ) const { return mpCaseName; }
+
+    static inline BenchmarkCase* getFirst( void ) { return smpFirst; }
+    inline BenchmarkCase* getNext( void ) const { return mpNext; }
+
+private:
+    const char*             mpSuiteName;
+    const char*             mpCaseName;
+    const char* volatile    mpFailure;
+    BenchmarkCase*          mpNext;
+
+    static BenchmarkCase*   smpFirst;
+};
+
+//-----------------------------------------------------------------------------
+
+/// The timings of a single benchmark case, in nanoseconds per iteration.
+struct BenchmarkResult
+{
+    const char* mpSuiteName;
+    const char* mpCaseName;
+    U32         mIterations;
+    U32         mSamples;
+    U32         mThreads;
+    F64         mMin;
+    F64         mMean;
+    F64         mMedian;
+    F64         mPercentile90;
+    F64         mPercentile99;
+    F64         mMax;
+    F64         mStdDev;
+};
+
+//-----------------------------------------------------------------------------
+
+class BenchmarkRunner
+{
+public:
+    BenchmarkRunner();
+
+    /// Only run cases whose "Suite.Case" name matches this wildcard pattern.
+    inline void setFilter( const char* pFilter )                { mpFilter = pFilter; }
+    inline void setWarmup( const U32 warmup )                   { mWarmup = warmup; }
+    inline void setRepetitions( const U32 repetitions )         { mRepetitions = getMax( repetitions, (U32)1 ); }
+    inline void setThreads( const U32 threads )                 { mThreads = getMax( threads, (U32)1 ); }
+    inline void setMinSampleTime( const F64 milliseconds )      { mMinSampleTime = milliseconds; }
+
+    /// Run all matching cases and return how many were timed.
+    U32 run( void );
+
+    /// Fetch how many cases failed in the last run.
+    inline U32 getFailureCount( void ) const { return mFailures; }
+
+    /// Write the results of the last run as JSON.
+    bool writeJson( const char* pFilename ) const;
+
+    inline const Vector<BenchmarkResult>& getResults( void ) const { return mResults; }
+
+    /// Fetch a high-resolution time in microseconds.
+    static F64 getTime( void );
+
+private:
+    U32 calibrate( BenchmarkCase* pCase ) const;
+    void sample( BenchmarkCase* pCase, const U32 iterations, const U32 threads, Vector<F64>& samples ) const;
+
+    const char*             mpFilter;
+    U32                     mWarmup;
+    U32                     mRepetitions;
+    U32                     mThreads;
+    F64                     mMinSampleTime;
+    Vector<BenchmarkResult> mResults;
+    U32                     mFailures;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Keep a value alive so the compiler cannot remove the work that produced it.
+/// The sink is on the caller's stack so threads running a case never share it.
+inline void benchmarkKeep( const U32 value ) { volatile U32 sink = value; (void)sink; }
+#define BENCHMARK_KEEP( value ) benchmarkKeep( (U32)(value) )
+
+/// Declare a benchmark case with no fixture.
+#define BENCHMARK_CASE( suite, name ) \
+    class suite##_##name##_Benchmark : public BenchmarkCase \
+    { \
+    public: \
+        suite##_##name##_Benchmark() : BenchmarkCase( #suite, #name ) {} \
+        virtual void run( const U32 iterations ); \
+    }; \
+    static suite##_##name##_Benchmark g##suite##_##name##_Benchmark; \
+    void suite##_##name##_Benchmark::run( const U32 iterations )
+
+/// Declare a benchmark case using a fixture derived from BenchmarkCase.
+/// The fixture must have a constructor taking the suite and case names.
+#define BENCHMARK_CASE_F( suite, fixture, name ) \
+    class suite##_##name##_Benchmark : public fixture \
+    { \
+    public: \
+        suite##_##name##_Benchmark() : fixture( #suite, #name ) {} \
+        virtual void run( const U32 iterations ); \
+    }; \
+    static suite##_##name##_Benchmark g##suite##_##name##_Benchmark; \
+    void suite##_##name##_Benchmark::run( const U32 iterations )
+
+#endif // TORQUE_SHIPPING
+
+#endif // _BENCHMARK_H_
@@ -0,0 +1,60 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @defgroup Benchmarking Benchmarking
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Runs the registered benchmarks and prints a summary to the console.
+    @param filter A "Suite.Case" wildcard pattern to select which benchmarks to run (default all).
+    @param jsonFile An optional file to write the results to as JSON.
+    @param repetitions The number of timed samples per benchmark (default 20).
+    @param warmup The number of untimed runs per benchmark (default 3).
+    @param threads The number of threads to run thread-safe benchmarks on (default 1).
+    @return Returns the number of benchmarks timed; failed benchmarks are not counted.
+*/
+ConsoleFunctionWithDocs( runBenchmarks, ConsoleInt, 1, 6, ([filter], [jsonFile], [repetitions], [warmup], [threads]) )
+{
+    BenchmarkRunner runner;
+    runner.setFilter( argc > 1 ? argv[1] : NULL );
+    if ( argc > 3 )
+        runner.setRepetitions( dAtoi(argv[3]) );
+    if ( argc > 4 )
+        runner.setWarmup( dAtoi(argv[4]) );
+    if ( argc > 5 )
+        runner.setThreads( dAtoi(argv[5]) );
+
+    const U32 count = runner.run();
+
+    // Write the results.
+    if ( argc > 2 && *argv[2] != 0 )
+    {
+        char pathBuffer[1024];
+        Con::expandPath( pathBuffer, sizeof(pathBuffer), argv[2] );
+        runner.writeJson( pathBuffer );
+    }
+
+    return count;
+}
+
+/*! @} */ // end group Benchmarking
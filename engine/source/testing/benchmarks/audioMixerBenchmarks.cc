@@ -0,0 +1,98 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_H_
+#include "testing/benchmark.h"
+#endif
+
+#ifndef _AUDIOMIXER_H_
+#include "audio/audioMixer.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define AUDIOMIXER_BENCHMARK_VOICES 256
+
+//-----------------------------------------------------------------------------
+
+// Lets the benchmark mix a block at a time.
+class AudioMixerBenchmarkMixer : public AudioMixer
+{
+public:
+    AudioMixerBenchmarkMixer() {}
+
+    void mix( void ) { mixBlock(); }
+};
+
+//-----------------------------------------------------------------------------
+
+class AudioMixerBenchmark : public BenchmarkCase
+{
+public:
+    AudioMixerBenchmark( const char* pSuiteName, const char* pCaseName ) : BenchmarkCase( pSuiteName, pCaseName ), mpMixer( NULL ) {}
+
+    virtual void setUp( void )
+    {
+        mpMixer = new AudioMixerBenchmarkMixer();
+        mpMixer->openDevice( "null", NULL, AudioMixer::DefaultSampleRate, false );
+
+        // A second of tone at the mixer's rate and at half of it, so both the
+        // straight and resampling paths are mixed.
+        Vector<S16> tone;
+        tone.setSize( AudioMixer::DefaultSampleRate );
+        for( S32 n = 0; n < tone.size(); ++n )
+            tone[n] = (S16)(mSin( (F32)n * 0.05f ) * 8192.0f);
+
+        mpMixer->addSample( "AudioMixerBenchmarkFull", tone.address(), tone.size(), 1, AudioMixer::DefaultSampleRate );
+        mpMixer->addSample( "AudioMixerBenchmarkHalf", tone.address(), tone.size(), 1, AudioMixer::DefaultSampleRate / 2 );
+
+        // Spread the voices around the listener so that they rank differently.
+        for( U32 n = 0; n < AUDIOMIXER_BENCHMARK_VOICES; ++n )
+        {
+            const U32 handle = mpMixer->play( (n & 1) ? "AudioMixerBenchmarkHalf" : "AudioMixerBenchmarkFull", 1.0f, true );
+            mpMixer->setVoicePosition( handle, Point3F( (F32)(n % 16) * 4.0f - 32.0f, (F32)(n / 16) * 4.0f - 32.0f, 0.0f ) );
+        }
+    }
+
+    virtual void tearDown( void )
+    {
+        delete mpMixer;
+        mpMixer = NULL;
+    }
+
+protected:
+    AudioMixerBenchmarkMixer* mpMixer;
+};
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( AudioMixer, AudioMixerBenchmark, MixBlock )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+        mpMixer->mix();
+}
+
+#endif // TORQUE_SHIPPING
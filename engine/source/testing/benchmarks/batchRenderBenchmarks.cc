@@ -0,0 +1,156 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_H_
+#include "testing/benchmark.h"
+#endif
+
+#ifndef _BATCH_RENDER_H_
+#include "2d/core/BatchRender.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BATCHRENDER_BENCHMARK_QUADS     1024
+
+//-----------------------------------------------------------------------------
+
+/// Submission only; pending batches are discarded rather than drawn so no render context is needed.
+class BatchRenderBenchmark : public BenchmarkCase
+{
+public:
+    BatchRenderBenchmark( const char* pSuiteName, const char* pCaseName ) : BenchmarkCase( pSuiteName, pCaseName ), mpBatchRenderer( NULL ) {}
+
+    virtual void setUp( void )
+    {
+        // The batch buffers are large so only allocate them while running.
+        mpBatchRenderer = new BatchRender();
+        mpBatchRenderer->setDebugStats( &mDebugStats );
+
+        // Build a row of quads.
+        mVertices.setSize( BATCHRENDER_BENCHMARK_QUADS * 4 );
+        mTexCoords.setSize( BATCHRENDER_BENCHMARK_QUADS * 4 );
+        for( U32 n = 0; n < BATCHRENDER_BENCHMARK_QUADS; ++n )
+        {
+            const F32 x = (F32)n;
+            mVertices[n*4+0].Set( x, 0.0f );
+            mVertices[n*4+1].Set( x + 1.0f, 0.0f );
+            mVertices[n*4+2].Set( x + 1.0f, 1.0f );
+            mVertices[n*4+3].Set( x, 1.0f );
+            mTexCoords[n*4+0].Set( 0.0f, 1.0f );
+            mTexCoords[n*4+1].Set( 1.0f, 1.0f );
+            mTexCoords[n*4+2].Set( 1.0f, 0.0f );
+            mTexCoords[n*4+3].Set( 0.0f, 0.0f );
+        }
+    }
+
+    virtual void tearDown( void )
+    {
+        delete mpBatchRenderer;
+        mpBatchRenderer = NULL;
+
+        mVertices.clear();
+        mTexCoords.clear();
+    }
+
+protected:
+    DebugStats          mDebugStats;
+    BatchRender*        mpBatchRenderer;
+    Vector<Vector2>     mVertices;
+    Vector<Vector2>     mTexCoords;
+};
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( BatchRender, BatchRenderBenchmark, SubmitQuadSorted )
+{
+    mpBatchRenderer->setStrictOrderMode( false );
+
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        for( U32 n = 0; n < BATCHRENDER_BENCHMARK_QUADS; ++n )
+        {
+            const Vector2* pVertex = mVertices.address() + n * 4;
+            const Vector2* pTexCoord = mTexCoords.address() + n * 4;
+            mpBatchRenderer->SubmitQuad(
+                pVertex[0], pVertex[1], pVertex[2], pVertex[3],
+                pTexCoord[0], pTexCoord[1], pTexCoord[2], pTexCoord[3],
+                BadTextureHandle );
+        }
+
+        mpBatchRenderer->discard();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( BatchRender, BatchRenderBenchmark, SubmitQuadStrict )
+{
+    mpBatchRenderer->setStrictOrderMode( true );
+
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        for( U32 n = 0; n < BATCHRENDER_BENCHMARK_QUADS; ++n )
+        {
+            const Vector2* pVertex = mVertices.address() + n * 4;
+            const Vector2* pTexCoord = mTexCoords.address() + n * 4;
+            mpBatchRenderer->SubmitQuad(
+                pVertex[0], pVertex[1], pVertex[2], pVertex[3],
+                pTexCoord[0], pTexCoord[1], pTexCoord[2], pTexCoord[3],
+                BadTextureHandle );
+        }
+
+        mpBatchRenderer->discard();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( BatchRender, BatchRenderBenchmark, SubmitQuads )
+{
+    mpBatchRenderer->setStrictOrderMode( true );
+
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        mpBatchRenderer->SubmitQuads( BATCHRENDER_BENCHMARK_QUADS, mVertices.address(), mTexCoords.address(), BadTextureHandle );
+        mpBatchRenderer->discard();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( BatchRender, BatchRenderBenchmark, SubmitQuadColored )
+{
+    mpBatchRenderer->setStrictOrderMode( true );
+    const ColorF color( 1.0f, 0.5f, 0.25f, 1.0f );
+
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        mpBatchRenderer->SubmitQuads( BATCHRENDER_BENCHMARK_QUADS, mVertices.address(), mTexCoords.address(), BadTextureHandle, color );
+        mpBatchRenderer->discard();
+    }
+}
+
+#endif // TORQUE_SHIPPING
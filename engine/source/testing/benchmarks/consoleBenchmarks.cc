@@ -0,0 +1,78 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_H_
+#include "testing/benchmark.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE( Console, Evaluate )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        BENCHMARK_KEEP( dAtoi( Con::evaluate( "return 1 + 2 * 3;" ) ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+class ConsoleFunctionBenchmark : public BenchmarkCase
+{
+public:
+    ConsoleFunctionBenchmark( const char* pSuiteName, const char* pCaseName ) : BenchmarkCase( pSuiteName, pCaseName ) {}
+
+    virtual void setUp( void )
+    {
+        Con::evaluate( "function benchmarkConsoleAdd( %a, %b ) { return %a + %b; }" );
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( Console, ConsoleFunctionBenchmark, CallScriptFunction )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        BENCHMARK_KEEP( dAtoi( Con::executef( 3, "benchmarkConsoleAdd", "1", "2" ) ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE( Console, GlobalVariable )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        Con::setIntVariable( "$Benchmark::Counter", iteration );
+        BENCHMARK_KEEP( Con::getIntVariable( "$Benchmark::Counter" ) );
+    }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,141 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_H_
+#include "testing/benchmark.h"
+#endif
+
+#ifndef _BITMAP_FONT_OBJECT_H_
+#include "2d/sceneobject/ImageFont.h"
+#endif
+
+#ifndef _SCENE_RENDER_STATE_H_
+#include "2d/scene/SceneRenderState.h"
+#endif
+
+#ifndef _BATCH_RENDER_H_
+#include "2d/core/BatchRender.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define IMAGEFONT_BENCHMARK_LABELS      2000
+
+//-----------------------------------------------------------------------------
+
+/// One iteration renders every label once.  Pending batches are discarded rather than drawn.
+/// The font image is "$Benchmark::ImageFontAsset", or "ToyAssets:Font" if that is not set.
+class ImageFontBenchmark : public BenchmarkCase
+{
+public:
+    ImageFontBenchmark( const char* pSuiteName, const char* pCaseName ) :
+        BenchmarkCase( pSuiteName, pCaseName ),
+        mpBatchRenderer( NULL ),
+        mRenderState( RectF( -50.0f, -50.0f, 100.0f, 100.0f ), Vector2::getZero(), 0.0f, MASK_ALL, MASK_ALL, Vector2( 0.1f, 0.1f ), &mDebugStats, NULL )
+    {
+    }
+
+    virtual void setUp( void )
+    {
+        mpBatchRenderer = new BatchRender();
+        mpBatchRenderer->setDebugStats( &mDebugStats );
+        mpBatchRenderer->setStrictOrderMode( true );
+
+        const char* pImageAssetId = Con::getVariable( "$Benchmark::ImageFontAsset" );
+        if( *pImageAssetId == 0 )
+            pImageAssetId = "ToyAssets:Font";
+
+        // Create score-style labels.
+        char labelBuffer[32];
+        for( U32 n = 0; n < IMAGEFONT_BENCHMARK_LABELS; ++n )
+        {
+            ImageFont* pLabel = new ImageFont();
+            if( !pLabel->setImage( pImageAssetId ) )
+            {
+                delete pLabel;
+                fail( "Font image asset not found; load its module or set $Benchmark::ImageFontAsset." );
+                return;
+            }
+
+            dSprintf( labelBuffer, sizeof(labelBuffer), "Score: %d", n * 10 );
+            pLabel->setText( labelBuffer );
+            pLabel->setTextAlignment( (ImageFont::TextAlignment)(ImageFont::ALIGN_LEFT + (n % 3)) );
+            mLabels.push_back( pLabel );
+        }
+    }
+
+    virtual void tearDown( void )
+    {
+        for( S32 n = 0; n < mLabels.size(); ++n )
+            delete mLabels[n];
+        mLabels.clear();
+
+        delete mpBatchRenderer;
+        mpBatchRenderer = NULL;
+    }
+
+protected:
+    void render( const U32 iterations, const bool rebuild )
+    {
+        for( U32 iteration = 0; iteration < iterations; ++iteration )
+        {
+            for( S32 n = 0; n < mLabels.size(); ++n )
+            {
+                if( rebuild )
+                    mLabels[n]->invalidateGlyphLayout();
+
+                mLabels[n]->sceneRender( &mRenderState, NULL, mpBatchRenderer );
+            }
+
+            mpBatchRenderer->discard();
+        }
+    }
+
+    DebugStats                  mDebugStats;
+    BatchRender*                mpBatchRenderer;
+    SceneRenderState            mRenderState;
+    VectorPtr<ImageFont*>       mLabels;
+};
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( ImageFont, ImageFontBenchmark, RenderCached )
+{
+    render( iterations, false );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( ImageFont, ImageFontBenchmark, RenderRebuilt )
+{
+    render( iterations, true );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,133 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_H_
+#include "testing/benchmark.h"
+#endif
+
+#ifndef _SHAPE_VECTOR_H_
+#include "2d/sceneobject/ShapeVector.h"
+#endif
+
+#ifndef _SCENE_RENDER_STATE_H_
+#include "2d/scene/SceneRenderState.h"
+#endif
+
+#ifndef _BATCH_RENDER_H_
+#include "2d/core/BatchRender.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SHAPEVECTOR_BENCHMARK_SHAPES    5000
+
+//-----------------------------------------------------------------------------
+
+/// One iteration renders every shape once.  Pending batches are discarded rather than drawn so no render context is needed.
+class ShapeVectorBenchmark : public BenchmarkCase
+{
+public:
+    ShapeVectorBenchmark( const char* pSuiteName, const char* pCaseName ) :
+        BenchmarkCase( pSuiteName, pCaseName ),
+        mpBatchRenderer( NULL ),
+        mRenderState( RectF( -50.0f, -50.0f, 100.0f, 100.0f ), Vector2::getZero(), 0.0f, MASK_ALL, MASK_ALL, Vector2( 0.1f, 0.1f ), &mDebugStats, NULL )
+    {
+    }
+
+    virtual void setUp( void )
+    {
+        mpBatchRenderer = new BatchRender();
+        mpBatchRenderer->setDebugStats( &mDebugStats );
+        mpBatchRenderer->setStrictOrderMode( true );
+
+        // Create a mix of filled and outlined polygons and circles.
+        for( U32 n = 0; n < SHAPEVECTOR_BENCHMARK_SHAPES; ++n )
+        {
+            ShapeVector* pShape = new ShapeVector();
+            pShape->setSize( Vector2( 1.0f, 1.0f ) );
+            pShape->setFillMode( (n & 1) == 0 );
+            if( (n & 2) == 0 )
+            {
+                pShape->setPolyPrimitive( 3 + (n % 6) );
+            }
+            else
+            {
+                pShape->setIsCircle( true );
+                pShape->setCircleRadius( 0.5f );
+            }
+            pShape->updateRenderGeometry();
+            mShapes.push_back( pShape );
+        }
+    }
+
+    virtual void tearDown( void )
+    {
+        for( S32 n = 0; n < mShapes.size(); ++n )
+            delete mShapes[n];
+        mShapes.clear();
+
+        delete mpBatchRenderer;
+        mpBatchRenderer = NULL;
+    }
+
+protected:
+    void render( const U32 iterations, const bool rebuild )
+    {
+        for( U32 iteration = 0; iteration < iterations; ++iteration )
+        {
+            for( S32 n = 0; n < mShapes.size(); ++n )
+            {
+                if( rebuild )
+                    mShapes[n]->invalidateRenderGeometry();
+
+                mShapes[n]->sceneRender( &mRenderState, NULL, mpBatchRenderer );
+            }
+
+            mpBatchRenderer->discard();
+        }
+    }
+
+    DebugStats                  mDebugStats;
+    BatchRender*                mpBatchRenderer;
+    SceneRenderState            mRenderState;
+    VectorPtr<ShapeVector*>     mShapes;
+};
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( ShapeVector, ShapeVectorBenchmark, RenderCached )
+{
+    render( iterations, false );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( ShapeVector, ShapeVectorBenchmark, RenderRebuilt )
+{
+    render( iterations, true );
+}
+
+#endif // TORQUE_SHIPPING
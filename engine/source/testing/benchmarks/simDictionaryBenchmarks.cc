@@ -0,0 +1,184 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_H_
+#include "testing/benchmark.h"
+#endif
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _SIMDICTIONARY_H_
+#include "sim/simDictionary.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SIMDICTIONARY_BENCHMARK_OBJECTS 4096
+
+//-----------------------------------------------------------------------------
+
+class SimDictionaryBenchmark : public BenchmarkCase
+{
+public:
+    SimDictionaryBenchmark( const char* pSuiteName, const char* pCaseName ) : BenchmarkCase( pSuiteName, pCaseName ) {}
+
+    virtual void setUp( void )
+    {
+        char nameBuffer[64];
+        for( U32 n = 0; n < SIMDICTIONARY_BENCHMARK_OBJECTS; ++n )
+        {
+            SimObject* pObject = new SimObject();
+            dSprintf( nameBuffer, sizeof(nameBuffer), "BenchmarkObject%d", n );
+            pObject->registerObject( nameBuffer );
+            mObjectIds.push_back( pObject->getId() );
+            mObjectNames.push_back( pObject->getName() );
+        }
+    }
+
+    virtual void tearDown( void )
+    {
+        for( S32 n = 0; n < mObjectIds.size(); ++n )
+        {
+            SimObject* pObject = Sim::findObject( mObjectIds[n] );
+            if ( pObject != NULL )
+                pObject->deleteObject();
+        }
+
+        mObjectIds.clear();
+        mObjectNames.clear();
+    }
+
+protected:
+    Vector<SimObjectId>         mObjectIds;
+    Vector<StringTableEntry>    mObjectNames;
+};
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( SimIdDictionary, SimDictionaryBenchmark, FindById )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        BENCHMARK_KEEP( (size_t)Sim::findObject( mObjectIds[iteration % SIMDICTIONARY_BENCHMARK_OBJECTS] ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( SimIdDictionary, SimDictionaryBenchmark, FindByName )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        BENCHMARK_KEEP( (size_t)Sim::findObject( mObjectNames[iteration % SIMDICTIONARY_BENCHMARK_OBJECTS] ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE( SimIdDictionary, RegisterUnregister )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        SimObject* pObject = new SimObject();
+        pObject->registerObject();
+        BENCHMARK_KEEP( pObject->getId() );
+        pObject->deleteObject();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+// Looks ids up in a private dictionary holding "objectCount" objects, in a
+// scattered order so the pages aren't walked sequentially.
+template<U32 objectCount> class SimIdDictionaryLookupBenchmark : public BenchmarkCase
+{
+    // Lets the objects be given ids without registering them.
+    class LookupObject : public SimObject
+    {
+    public:
+        void setLookupId( const SimObjectId id ) { mId = id; }
+    };
+
+public:
+    SimIdDictionaryLookupBenchmark( const char* pSuiteName, const char* pCaseName ) : BenchmarkCase( pSuiteName, pCaseName ), mpObjects( NULL ) {}
+
+    virtual void setUp( void )
+    {
+        mpObjects = new LookupObject[objectCount];
+        for( U32 n = 0; n < objectCount; ++n )
+        {
+            mpObjects[n].setLookupId( DynamicObjectIdFirst + n );
+            mDictionary.insert( &mpObjects[n] );
+        }
+    }
+
+    virtual void tearDown( void )
+    {
+        for( U32 n = 0; n < objectCount; ++n )
+            mDictionary.remove( &mpObjects[n] );
+
+        delete [] mpObjects;
+        mpObjects = NULL;
+    }
+
+protected:
+    void lookup( const U32 iterations )
+    {
+        U32 seed = 1;
+        for( U32 iteration = 0; iteration < iterations; ++iteration )
+        {
+            seed = seed * 1664525 + 1013904223;
+            BENCHMARK_KEEP( (size_t)mDictionary.find( DynamicObjectIdFirst + (seed % objectCount) ) );
+        }
+    }
+
+    SimIdDictionary mDictionary;
+    LookupObject*   mpObjects;
+};
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( SimIdDictionary, SimIdDictionaryLookupBenchmark<10000>, Lookup10k )
+{
+    lookup( iterations );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( SimIdDictionary, SimIdDictionaryLookupBenchmark<100000>, Lookup100k )
+{
+    lookup( iterations );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( SimIdDictionary, SimIdDictionaryLookupBenchmark<1000000>, Lookup1M )
+{
+    lookup( iterations );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,99 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_H_
+#include "testing/benchmark.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define STRINGTABLE_BENCHMARK_STRINGS   1024
+
+//-----------------------------------------------------------------------------
+
+class StringTableBenchmark : public BenchmarkCase
+{
+public:
+    StringTableBenchmark( const char* pSuiteName, const char* pCaseName ) : BenchmarkCase( pSuiteName, pCaseName ) {}
+
+    virtual void setUp( void )
+    {
+        // Build the strings and make sure they're already in the table.
+        for( U32 n = 0; n < STRINGTABLE_BENCHMARK_STRINGS; ++n )
+        {
+            dSprintf( mStrings[n], sizeof(mStrings[n]), "BenchmarkString_%d", n );
+            StringTable->insert( mStrings[n] );
+        }
+    }
+
+protected:
+    char mStrings[STRINGTABLE_BENCHMARK_STRINGS][32];
+};
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( StringTable, StringTableBenchmark, Insert )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        BENCHMARK_KEEP( (size_t)StringTable->insert( mStrings[iteration % STRINGTABLE_BENCHMARK_STRINGS] ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( StringTable, StringTableBenchmark, InsertCaseSensitive )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        BENCHMARK_KEEP( (size_t)StringTable->insert( mStrings[iteration % STRINGTABLE_BENCHMARK_STRINGS], true ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( StringTable, StringTableBenchmark, Lookup )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        BENCHMARK_KEEP( (size_t)StringTable->lookup( mStrings[iteration % STRINGTABLE_BENCHMARK_STRINGS] ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE( StringTable, LookupMissing )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        BENCHMARK_KEEP( (size_t)StringTable->lookup( "BenchmarkMissingString" ) );
+    }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,172 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_H_
+#include "testing/benchmark.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _SCRIPT_OBJECT_H_
+#include "sim/scriptObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define TAML_BENCHMARK_OBJECTS  64
+
+//-----------------------------------------------------------------------------
+
+class TamlBenchmark : public BenchmarkCase
+{
+public:
+    TamlBenchmark( const char* pSuiteName, const char* pCaseName, const Taml::TamlFormatMode formatMode ) :
+        BenchmarkCase( pSuiteName, pCaseName ),
+        mFormatMode( formatMode ),
+        mpTaml( NULL ),
+        mpObjectSet( NULL )
+    {
+    }
+
+    virtual void setUp( void )
+    {
+        // Build a set of objects with a few dynamic fields each.
+        mpObjectSet = new SimSet();
+        mpObjectSet->registerObject();
+
+        char valueBuffer[64];
+        for( U32 n = 0; n < TAML_BENCHMARK_OBJECTS; ++n )
+        {
+            ScriptObject* pObject = new ScriptObject();
+            pObject->registerObject();
+
+            dSprintf( valueBuffer, sizeof(valueBuffer), "%d", n );
+            pObject->setDataField( StringTable->insert( "Index" ), NULL, valueBuffer );
+            dSprintf( valueBuffer, sizeof(valueBuffer), "%g %g", (F32)n * 0.5f, (F32)n * 0.25f );
+            pObject->setDataField( StringTable->insert( "Position" ), NULL, valueBuffer );
+            pObject->setDataField( StringTable->insert( "Description" ), NULL, "A benchmark object used to time TAML." );
+
+            mpObjectSet->addObject( pObject );
+        }
+
+        // Write a file to read back.
+        Platform::makeFullPathName( mFormatMode == Taml::BinaryFormat ? "tamlBenchmark.baml" : "tamlBenchmark.taml", mFilename, sizeof(mFilename) );
+        mpTaml = new Taml();
+        mpTaml->setAutoFormat( false );
+        mpTaml->setFormatMode( mFormatMode );
+        if( !mpTaml->write( mpObjectSet, mFilename ) )
+            fail( "Could not write the file to read back." );
+    }
+
+    virtual void tearDown( void )
+    {
+        mpObjectSet->deleteObjects();
+        mpObjectSet->deleteObject();
+        mpObjectSet = NULL;
+
+        delete mpTaml;
+        mpTaml = NULL;
+
+        Platform::fileDelete( mFilename );
+    }
+
+protected:
+    Taml::TamlFormatMode    mFormatMode;
+    Taml*                   mpTaml;
+    SimSet*                 mpObjectSet;
+    char                    mFilename[1024];
+};
+
+//-----------------------------------------------------------------------------
+
+class TamlXmlBenchmark : public TamlBenchmark
+{
+public:
+    TamlXmlBenchmark( const char* pSuiteName, const char* pCaseName ) : TamlBenchmark( pSuiteName, pCaseName, Taml::XmlFormat ) {}
+};
+
+class TamlBinaryBenchmark : public TamlBenchmark
+{
+public:
+    TamlBinaryBenchmark( const char* pSuiteName, const char* pCaseName ) : TamlBenchmark( pSuiteName, pCaseName, Taml::BinaryFormat ) {}
+};
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( Taml, TamlXmlBenchmark, WriteXml )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+        BENCHMARK_KEEP( mpTaml->write( mpObjectSet, mFilename ) );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( Taml, TamlXmlBenchmark, ReadXml )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        SimSet* pObjectSet = mpTaml->read<SimSet>( mFilename );
+        if ( pObjectSet == NULL )
+        {
+            fail( "Could not read the file back." );
+            return;
+        }
+
+        BENCHMARK_KEEP( pObjectSet->size() );
+        pObjectSet->deleteObjects();
+        pObjectSet->deleteObject();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( Taml, TamlBinaryBenchmark, WriteBinary )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+        BENCHMARK_KEEP( mpTaml->write( mpObjectSet, mFilename ) );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( Taml, TamlBinaryBenchmark, ReadBinary )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        SimSet* pObjectSet = mpTaml->read<SimSet>( mFilename );
+        if ( pObjectSet == NULL )
+        {
+            fail( "Could not read the file back." );
+            return;
+        }
+
+        BENCHMARK_KEEP( pObjectSet->size() );
+        pObjectSet->deleteObjects();
+        pObjectSet->deleteObject();
+    }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,160 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_H_
+#include "testing/benchmark.h"
+#endif
+
+#ifndef _INLINE_VECTOR_H_
+#include "collection/inlineVector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define VECTOR_BENCHMARK_ELEMENTS   1024
+
+//-----------------------------------------------------------------------------
+
+/// Vector cases only touch local storage so can run on several threads.
+class VectorBenchmark : public BenchmarkCase
+{
+public:
+    VectorBenchmark( const char* pSuiteName, const char* pCaseName ) : BenchmarkCase( pSuiteName, pCaseName ) {}
+
+    virtual bool isThreadSafe( void ) const { return true; }
+};
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( Vector, VectorBenchmark, PushBack )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        Vector<U32> vector;
+        for( U32 n = 0; n < VECTOR_BENCHMARK_ELEMENTS; ++n )
+            vector.push_back( n );
+
+        BENCHMARK_KEEP( vector.size() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( Vector, VectorBenchmark, PushBackLinear )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        Vector<U32> vector;
+        vector.setGrowthPolicy( VectorGrowLinear );
+        for( U32 n = 0; n < VECTOR_BENCHMARK_ELEMENTS; ++n )
+            vector.push_back( n );
+
+        BENCHMARK_KEEP( vector.size() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( Vector, VectorBenchmark, PushBackReserved )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        Vector<U32> vector;
+        vector.reserve( VECTOR_BENCHMARK_ELEMENTS );
+        for( U32 n = 0; n < VECTOR_BENCHMARK_ELEMENTS; ++n )
+            vector.push_back( n );
+
+        BENCHMARK_KEEP( vector.size() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( Vector, VectorBenchmark, PushBackInline )
+{
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        InlineVector<U32, 64> vector;
+        for( U32 n = 0; n < 64; ++n )
+            vector.push_back( n );
+
+        BENCHMARK_KEEP( vector.size() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( Vector, VectorBenchmark, Erase )
+{
+    Vector<U32> vector;
+    vector.reserve( VECTOR_BENCHMARK_ELEMENTS );
+
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        vector.setSize( VECTOR_BENCHMARK_ELEMENTS );
+        while ( vector.size() > 0 )
+            vector.erase( U32(0) );
+
+        BENCHMARK_KEEP( vector.capacity() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( Vector, VectorBenchmark, EraseFast )
+{
+    Vector<U32> vector;
+    vector.reserve( VECTOR_BENCHMARK_ELEMENTS );
+
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        vector.setSize( VECTOR_BENCHMARK_ELEMENTS );
+        while ( vector.size() > 0 )
+            vector.erase_fast( U32(0) );
+
+        BENCHMARK_KEEP( vector.capacity() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( Vector, VectorBenchmark, Iterate )
+{
+    Vector<U32> vector;
+    vector.setSize( VECTOR_BENCHMARK_ELEMENTS );
+    for( U32 n = 0; n < VECTOR_BENCHMARK_ELEMENTS; ++n )
+        vector[n] = n;
+
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        U32 sum = 0;
+        for( Vector<U32>::const_iterator itr = vector.begin(); itr != vector.end(); ++itr )
+            sum += *itr;
+
+        BENCHMARK_KEEP( sum );
+    }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,141 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_H_
+#include "testing/benchmark.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define WORLDQUERY_BENCHMARK_GRID   64
+
+//-----------------------------------------------------------------------------
+
+class WorldQueryBenchmark : public BenchmarkCase
+{
+public:
+    WorldQueryBenchmark( const char* pSuiteName, const char* pCaseName ) : BenchmarkCase( pSuiteName, pCaseName ), mpScene( NULL ) {}
+
+    virtual void setUp( void )
+    {
+        mpScene = new Scene();
+        mpScene->registerObject();
+
+        // Lay out a grid of unit-sized objects.
+        for( U32 y = 0; y < WORLDQUERY_BENCHMARK_GRID; ++y )
+        {
+            for( U32 x = 0; x < WORLDQUERY_BENCHMARK_GRID; ++x )
+            {
+                SceneObject* pSceneObject = new SceneObject();
+                pSceneObject->registerObject();
+                pSceneObject->setBodyType( b2_staticBody );
+                pSceneObject->setSize( Vector2( 1.0f, 1.0f ) );
+                pSceneObject->setPosition( Vector2( (F32)x * 2.0f, (F32)y * 2.0f ) );
+                mpScene->addToScene( pSceneObject );
+            }
+        }
+    }
+
+    virtual void tearDown( void )
+    {
+        // Deleting the scene deletes its objects.
+        mpScene->deleteObject();
+        mpScene = NULL;
+    }
+
+protected:
+    /// Fetch a query area that walks across the grid.
+    inline b2AABB getQueryArea( const U32 iteration, const F32 extent ) const
+    {
+        const F32 span = (F32)(WORLDQUERY_BENCHMARK_GRID * 2);
+        const F32 x = mFmod( (F32)iteration * 1.7f, span );
+        const F32 y = mFmod( (F32)iteration * 3.1f, span );
+
+        b2AABB aabb;
+        aabb.lowerBound.Set( x, y );
+        aabb.upperBound.Set( x + extent, y + extent );
+        return aabb;
+    }
+
+    Scene* mpScene;
+};
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( WorldQuery, WorldQueryBenchmark, AabbQuerySmall )
+{
+    WorldQuery* pWorldQuery = mpScene->getWorldQuery();
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        pWorldQuery->clearQuery();
+        BENCHMARK_KEEP( pWorldQuery->aabbQueryAABB( getQueryArea( iteration, 4.0f ) ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( WorldQuery, WorldQueryBenchmark, AabbQueryLarge )
+{
+    WorldQuery* pWorldQuery = mpScene->getWorldQuery();
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        pWorldQuery->clearQuery();
+        BENCHMARK_KEEP( pWorldQuery->aabbQueryAABB( getQueryArea( iteration, 32.0f ) ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( WorldQuery, WorldQueryBenchmark, AnyQueryAABB )
+{
+    WorldQuery* pWorldQuery = mpScene->getWorldQuery();
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        pWorldQuery->clearQuery();
+        BENCHMARK_KEEP( pWorldQuery->anyQueryAABB( getQueryArea( iteration, 8.0f ) ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( WorldQuery, WorldQueryBenchmark, AabbQueryPoint )
+{
+    WorldQuery* pWorldQuery = mpScene->getWorldQuery();
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        pWorldQuery->clearQuery();
+        BENCHMARK_KEEP( pWorldQuery->aabbQueryPoint( getQueryArea( iteration, 0.0f ).lowerBound ) );
+    }
+}
+
+#endif // TORQUE_SHIPPING
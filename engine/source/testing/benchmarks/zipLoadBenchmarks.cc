@@ -0,0 +1,239 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want benchmarks in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _BENCHMARK_H_
+#include "testing/benchmark.h"
+#endif
+
+#ifndef _ZIPARCHIVE_H_
+#include "io/zip/zipArchive.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// One iteration loads every file of a module once.  The module is
+/// "$Benchmark::ZipLoadPath"; it is packed into a zip to load back from.
+class ZipLoadBenchmark : public BenchmarkCase
+{
+public:
+    ZipLoadBenchmark( const char* pSuiteName, const char* pCaseName, const bool mapped ) :
+        BenchmarkCase( pSuiteName, pCaseName ),
+        mMapped( mapped ),
+        mOldDisableMapping( false ),
+        mLargest( 0 ),
+        mpBuffer( NULL )
+    {
+        mFilename[0] = 0;
+    }
+
+    virtual void setUp( void )
+    {
+        const char* pModulePath = Con::getVariable( "$Benchmark::ZipLoadPath" );
+        if ( *pModulePath == 0 )
+        {
+            fail( "Set $Benchmark::ZipLoadPath to the module to pack." );
+            return;
+        }
+
+        char modulePath[1024];
+        Con::expandPath( modulePath, sizeof(modulePath), pModulePath );
+        if ( !Platform::dumpPath( modulePath, mFiles ) || mFiles.empty() )
+        {
+            fail( "No files found at $Benchmark::ZipLoadPath." );
+            return;
+        }
+
+        // Pack the module.
+        Platform::makeFullPathName( "zipLoadBenchmark.zip", mFilename, sizeof(mFilename) );
+        if ( !packModule( modulePath ) )
+        {
+            fail( "Could not pack the module." );
+            return;
+        }
+
+        mpBuffer = new U8[mLargest + 1];
+
+        // Choose how the zip is read.
+        mOldDisableMapping = Con::getBoolVariable( "$Pref::Zip::DisableMemoryMapping" );
+        Con::setBoolVariable( "$Pref::Zip::DisableMemoryMapping", !mMapped );
+
+        if ( mMapped )
+        {
+            Zip::ZipArchive zip;
+            if ( !zip.openArchive( mFilename, Zip::ZipArchive::Read ) || !zip.isMapped() )
+                fail( "Memory mapping is not supported here." );
+        }
+    }
+
+    virtual void tearDown( void )
+    {
+        if ( mpBuffer != NULL )
+        {
+            Con::setBoolVariable( "$Pref::Zip::DisableMemoryMapping", mOldDisableMapping );
+
+            delete [] mpBuffer;
+            mpBuffer = NULL;
+        }
+
+        if ( mFilename[0] != 0 )
+            Platform::fileDelete( mFilename );
+
+        mFiles.clear();
+        mLargest = 0;
+    }
+
+protected:
+    void readZip( const U32 iterations )
+    {
+        for( U32 iteration = 0; iteration < iterations; ++iteration )
+        {
+            Zip::ZipArchive zip;
+            if ( !zip.openArchive( mFilename, Zip::ZipArchive::Read ) )
+            {
+                fail( "Could not open the zip." );
+                return;
+            }
+
+            for( U32 index = 0; index < zip.numEntries(); ++index )
+            {
+                const Zip::CentralDir& cd = zip[index];
+                if ( cd.mUncompressedSize > mLargest )
+                    continue;
+
+                if ( mMapped )
+                {
+                    BENCHMARK_KEEP( zip.readFile( &cd, mpBuffer, mLargest ) );
+                    continue;
+                }
+
+                Stream* pStream = zip.openFileForRead( &cd );
+                if ( pStream != NULL )
+                {
+                    BENCHMARK_KEEP( pStream->read( cd.mUncompressedSize, mpBuffer ) );
+                    zip.closeFile( pStream );
+                }
+            }
+        }
+    }
+
+    bool packModule( const char* pModulePath )
+    {
+        Zip::ZipArchive zip;
+        if ( !zip.openArchive( mFilename, Zip::ZipArchive::Write ) )
+            return false;
+
+        const U32 basePathLength = dStrlen( pModulePath );
+        char path[1024];
+        for( S32 index = 0; index < mFiles.size(); ++index )
+        {
+            dSprintf( path, sizeof(path), "%s/%s", mFiles[index].pFullPath, mFiles[index].pFileName );
+
+            FileStream source;
+            if ( !source.open( path, FileStream::Read ) )
+                continue;
+
+            // The path in the zip is relative to the module.
+            const char* pRelativePath = path + basePathLength;
+            while( *pRelativePath == '/' )
+                ++pRelativePath;
+
+            Stream* pDestination = zip.openFile( pRelativePath, Zip::ZipArchive::Write );
+            if ( pDestination != NULL )
+            {
+                pDestination->copyFrom( &source );
+                zip.closeFile( pDestination );
+            }
+
+            mLargest = getMax( mLargest, mFiles[index].fileSize );
+        }
+
+        zip.closeArchive();
+        return true;
+    }
+
+    bool                        mMapped;
+    bool                        mOldDisableMapping;
+    Vector<Platform::FileInfo>  mFiles;
+    U32                         mLargest;
+    U8*                         mpBuffer;
+    char                        mFilename[1024];
+};
+
+//-----------------------------------------------------------------------------
+
+class ZipStreamBenchmark : public ZipLoadBenchmark
+{
+public:
+    ZipStreamBenchmark( const char* pSuiteName, const char* pCaseName ) : ZipLoadBenchmark( pSuiteName, pCaseName, false ) {}
+};
+
+class ZipMappedBenchmark : public ZipLoadBenchmark
+{
+public:
+    ZipMappedBenchmark( const char* pSuiteName, const char* pCaseName ) : ZipLoadBenchmark( pSuiteName, pCaseName, true ) {}
+};
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( ZipLoad, ZipStreamBenchmark, LooseFiles )
+{
+    char path[1024];
+    for( U32 iteration = 0; iteration < iterations; ++iteration )
+    {
+        for( S32 index = 0; index < mFiles.size(); ++index )
+        {
+            dSprintf( path, sizeof(path), "%s/%s", mFiles[index].pFullPath, mFiles[index].pFileName );
+
+            FileStream source;
+            if ( source.open( path, FileStream::Read ) )
+                BENCHMARK_KEEP( source.read( mFiles[index].fileSize, mpBuffer ) );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( ZipLoad, ZipStreamBenchmark, ZipStream )
+{
+    readZip( iterations );
+}
+
+//-----------------------------------------------------------------------------
+
+BENCHMARK_CASE_F( ZipLoad, ZipMappedBenchmark, ZipMapped )
+{
+    readZip( iterations );
+}
+
+#endif // TORQUE_SHIPPING
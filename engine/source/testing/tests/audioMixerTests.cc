@@ -0,0 +1,183 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _AUDIOMIXER_H_
+#include "audio/audioMixer.h"
+#endif
+
+#ifndef _AUDIOMIXERKERNELS_H_
+#include "audio/audioMixerKernels.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Gives each test its own mixer and lets it mix a block at a time.
+class AudioMixerTestMixer : public AudioMixer
+{
+public:
+    AudioMixerTestMixer() {}
+
+    void mixBlocks( const U32 count )   { for( U32 n = 0; n < count; ++n ) mixBlock(); }
+    const F32* getMixBuffer( void ) const { return mMixBuffer; }
+};
+
+// Cache a mono sample held at a constant level.
+static void addConstantSample( AudioMixer* pMixer, const char* pName, const U32 frames, const U32 sampleRate, const S16 level )
+{
+    Vector<S16> data;
+    data.setSize( frames );
+    for( U32 n = 0; n < frames; ++n )
+        data[n] = level;
+
+    pMixer->addSample( pName, data.address(), frames, 1, sampleRate );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AudioMixerTests, KernelMixMonoTest )
+{
+    // Enough frames for the SIMD loop and its scalar tail.
+    const S16 input[7] = { 0, 1000, -1000, 16384, -16384, 32767, -32768 };
+    F32 output[14];
+    dMemset( output, 0, sizeof(output) );
+
+    AudioMixerKernels::mixMono( output, input, 7, 1.0f, 0.5f );
+
+    for( U32 n = 0; n < 7; ++n )
+    {
+        ASSERT_FLOAT_EQ( (F32)input[n] / 32768.0f, output[n * 2] ) << "Left channel is incorrect.";
+        ASSERT_FLOAT_EQ( (F32)input[n] / 32768.0f * 0.5f, output[n * 2 + 1] ) << "Right channel is incorrect.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AudioMixerTests, KernelConvertTest )
+{
+    const F32 input[9] = { 2.0f, -2.0f, 1.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 5.0f };
+    const S16 expected[9] = { 32767, -32767, 32767, -32767, 0, 0, 0, 0, 32767 };
+    S16 output[9];
+
+    AudioMixerKernels::convertToS16( output, input, 9 );
+
+    for( U32 n = 0; n < 9; ++n )
+    {
+        ASSERT_EQ( expected[n], output[n] ) << "Sample was not saturated.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AudioMixerTests, MixOutputTest )
+{
+    AudioMixerTestMixer* pMixer = new AudioMixerTestMixer();
+    ASSERT_TRUE( pMixer->openDevice( "null", NULL, AudioMixer::DefaultSampleRate, false ) ) << "Null device did not open.";
+    addConstantSample( pMixer, "AudioMixerTestsLevel", AudioMixer::DefaultSampleRate, AudioMixer::DefaultSampleRate, 16384 );
+
+    pMixer->play( "AudioMixerTestsLevel", 0.5f, true );
+    pMixer->mixBlocks( 1 );
+
+    // Half level at half volume, centered.
+    const F32* pMix = pMixer->getMixBuffer();
+    for( U32 n = 0; n < AudioMixer::BlockFrames * AudioMixer::OutputChannels; ++n )
+    {
+        ASSERT_FLOAT_EQ( 0.25f, pMix[n] ) << "Mixed output is incorrect.";
+    }
+
+    delete pMixer;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AudioMixerTests, VirtualVoicesTest )
+{
+    AudioMixerTestMixer* pMixer = new AudioMixerTestMixer();
+    ASSERT_TRUE( pMixer->openDevice( "null", NULL, AudioMixer::DefaultSampleRate, false ) ) << "Null device did not open.";
+    addConstantSample( pMixer, "AudioMixerTestsLevel", AudioMixer::DefaultSampleRate, AudioMixer::DefaultSampleRate, 16384 );
+
+    pMixer->setMixedVoiceLimit( 2 );
+    for( U32 n = 0; n < 5; ++n )
+        pMixer->play( "AudioMixerTestsLevel", 1.0f, true, (F32)(n + 1) );
+
+    pMixer->mixBlocks( 1 );
+
+    AudioMixer::Stats stats;
+    pMixer->getStats( stats );
+    ASSERT_EQ( 5U, stats.mActiveVoices ) << "Active voice count is incorrect.";
+    ASSERT_EQ( 2U, stats.mMixedVoices ) << "Mixed voice count is incorrect.";
+    ASSERT_EQ( 3U, stats.mVirtualVoices ) << "Virtual voice count is incorrect.";
+
+    delete pMixer;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AudioMixerTests, VoiceEndTest )
+{
+    AudioMixerTestMixer* pMixer = new AudioMixerTestMixer();
+    ASSERT_TRUE( pMixer->openDevice( "null", NULL, AudioMixer::DefaultSampleRate, false ) ) << "Null device did not open.";
+
+    // Half the mixer's rate, so 1000 frames last 2000 output frames.
+    addConstantSample( pMixer, "AudioMixerTestsShort", 1000, AudioMixer::DefaultSampleRate / 2, 16384 );
+
+    const U32 handle = pMixer->play( "AudioMixerTestsShort" );
+    const U32 loopingHandle = pMixer->play( "AudioMixerTestsShort", 1.0f, true );
+
+    pMixer->mixBlocks( 3 );
+    ASSERT_TRUE( pMixer->isPlaying( handle ) ) << "Voice ended early.";
+
+    pMixer->mixBlocks( 1 );
+    ASSERT_FALSE( pMixer->isPlaying( handle ) ) << "Voice did not end.";
+    ASSERT_TRUE( pMixer->isPlaying( loopingHandle ) ) << "Looping voice ended.";
+
+    delete pMixer;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AudioMixerTests, StaleHandleTest )
+{
+    AudioMixerTestMixer* pMixer = new AudioMixerTestMixer();
+    addConstantSample( pMixer, "AudioMixerTestsLevel", AudioMixer::DefaultSampleRate, AudioMixer::DefaultSampleRate, 16384 );
+
+    const U32 handle = pMixer->play( "AudioMixerTestsLevel" );
+    pMixer->stop( handle );
+    ASSERT_FALSE( pMixer->isPlaying( handle ) ) << "Stopped voice still playing.";
+
+    // The voice is reused under a new handle.
+    const U32 newHandle = pMixer->play( "AudioMixerTestsLevel" );
+    ASSERT_NE( handle, newHandle ) << "Handle was reissued.";
+    ASSERT_FALSE( pMixer->isPlaying( handle ) ) << "Stale handle found a voice.";
+    ASSERT_TRUE( pMixer->isPlaying( newHandle ) ) << "New voice not playing.";
+
+    delete pMixer;
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,120 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef B2_DYNAMIC_TREE_H
+#include "Box2D/Collision/b2DynamicTree.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define DYNAMICTREE_UNITTEST_COLUMNS    64
+#define DYNAMICTREE_UNITTEST_ROWS       64
+
+//-----------------------------------------------------------------------------
+
+class DynamicTreeQueryCount
+{
+public:
+    DynamicTreeQueryCount() : mCount(0) {}
+
+    bool QueryCallback( S32 proxyId ) { mCount++; return true; }
+
+    U32 mCount;
+};
+
+//-----------------------------------------------------------------------------
+
+// Lays out unit tiles on a regular grid.
+static void createTileAABBs( Vector<b2AABB>& aabbs, Vector<void*>& userData )
+{
+    for ( U32 row = 0; row < DYNAMICTREE_UNITTEST_ROWS; ++row )
+    {
+        for ( U32 column = 0; column < DYNAMICTREE_UNITTEST_COLUMNS; ++column )
+        {
+            b2AABB aabb;
+            aabb.lowerBound.Set( (F32)column - 0.5f, (F32)row - 0.5f );
+            aabb.upperBound.Set( (F32)column + 0.5f, (F32)row + 0.5f );
+            aabbs.push_back( aabb );
+            userData.push_back( (void*)(intptr_t)(aabbs.size()) );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( DynamicTreeTests, CreateProxiesTest )
+{
+    Vector<b2AABB> aabbs;
+    Vector<void*> userData;
+    createTileAABBs( aabbs, userData );
+
+    // Build one tree a proxy at a time and one in bulk.
+    b2DynamicTree insertTree;
+    for ( U32 index = 0; index < (U32)aabbs.size(); ++index )
+        insertTree.CreateProxy( aabbs[index], userData[index] );
+
+    Vector<S32> proxyIds;
+    proxyIds.setSize( aabbs.size() );
+    b2DynamicTree bulkTree;
+    bulkTree.CreateProxies( aabbs.address(), userData.address(), aabbs.size(), proxyIds.address() );
+    bulkTree.Validate();
+
+    // The proxy ids should refer to the user data they were created with.
+    for ( U32 index = 0; index < (U32)aabbs.size(); ++index )
+        ASSERT_EQ( userData[index], bulkTree.GetUserData( proxyIds[index] ) );
+
+    // A bulk tree over 2^n leaves should be perfectly balanced.
+    ASSERT_EQ( 0, bulkTree.GetMaxBalance() );
+    ASSERT_EQ( 12, bulkTree.GetHeight() );
+
+    // Both trees should find the same proxies.
+    for ( U32 index = 0; index < 32; ++index )
+    {
+        b2AABB queryAABB;
+        queryAABB.lowerBound.Set( (F32)(index * 2) - 4.0f, (F32)index );
+        queryAABB.upperBound = queryAABB.lowerBound + b2Vec2( 7.0f, 3.0f );
+
+        DynamicTreeQueryCount insertCount;
+        DynamicTreeQueryCount bulkCount;
+        insertTree.Query( &insertCount, queryAABB );
+        bulkTree.Query( &bulkCount, queryAABB );
+        ASSERT_EQ( insertCount.mCount, bulkCount.mCount );
+    }
+
+    // Proxies can still be removed individually after a bulk build.
+    for ( U32 index = 0; index < (U32)proxyIds.size(); index += 2 )
+        bulkTree.DestroyProxy( proxyIds[index] );
+    bulkTree.Validate();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,138 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+#ifndef _AUDIOBUFFER_H_
+#include "audio/audioBuffer.h"
+#endif
+
+#ifndef _IMAADPCM_H_
+#include "audio/imaAdpcm.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Writes a WAV header up to and including the data chunk header.
+static void writeWAVHeader( Stream& stream, const U16 format, const U16 channels, const U32 sampleRate, const U16 blockAlign, const U32 dataSize )
+{
+    const bool isPCM = format == 0x0001;
+    const U32 fmtSize = isPCM ? 16 : 20;
+
+    stream.write( 4, "RIFF" );
+    stream.write( (U32)(4 + 8 + fmtSize + 8 + dataSize) );
+    stream.write( 4, "WAVE" );
+
+    stream.write( 4, "fmt " );
+    stream.write( fmtSize );
+    stream.write( format );
+    stream.write( channels );
+    stream.write( sampleRate );
+    stream.write( (U32)(sampleRate * blockAlign) );
+    stream.write( blockAlign );
+    stream.write( (U16)(isPCM ? 16 : 4) );
+
+    if ( !isPCM )
+    {
+        stream.write( (U16)2 );
+        stream.write( (U16)ImaAdpcm::getBlockFrames( blockAlign, channels ) );
+    }
+
+    stream.write( 4, "data" );
+    stream.write( dataSize );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( HeadlessAssetTests, PNGSizeTest )
+{
+    static U8 buffer[64 * 1024];
+    MemStream stream( sizeof(buffer), buffer );
+
+    GBitmap bitmap( 37, 19, false, GBitmap::RGBA );
+    dMemset( bitmap.getWritableBits(), 0x7f, bitmap.byteSize );
+    ASSERT_TRUE( bitmap.writePNG( stream ) );
+    const U32 pngEnd = stream.getPosition();
+
+    // The size comes from the header alone.
+    U32 width = 0, height = 0;
+    stream.setPosition( 0 );
+    ASSERT_TRUE( GBitmap::readPNGSize( stream, width, height ) );
+    ASSERT_EQ( 37u, width );
+    ASSERT_EQ( 19u, height );
+
+    // Skipping leaves the stream just past the image.
+    stream.setPosition( 0 );
+    ASSERT_TRUE( GBitmap::skipPNG( stream ) );
+    ASSERT_EQ( pngEnd, stream.getPosition() );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( HeadlessAssetTests, PCMInfoTest )
+{
+    static U8 buffer[256];
+    MemStream stream( sizeof(buffer), buffer );
+
+    // Stereo 16-bit; the sample data itself is never read.
+    writeWAVHeader( stream, 0x0001, 2, 22050, 4, 4 * 44100 );
+
+    U32 channels = 0, sampleRate = 0, frames = 0;
+    stream.setPosition( 0 );
+    ASSERT_TRUE( AudioBuffer::readWAVInfo( stream, channels, sampleRate, frames ) );
+    ASSERT_EQ( 2u, channels );
+    ASSERT_EQ( 22050u, sampleRate );
+    ASSERT_EQ( 44100u, frames );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( HeadlessAssetTests, AdpcmInfoTest )
+{
+    static U8 buffer[256];
+    MemStream stream( sizeof(buffer), buffer );
+
+    // Three full blocks and a partial one.
+    const U16 blockAlign = 256;
+    writeWAVHeader( stream, ImaAdpcm::WAVFormatTag, 1, 22050, blockAlign, 3 * blockAlign + 40 );
+
+    U32 channels = 0, sampleRate = 0, frames = 0;
+    stream.setPosition( 0 );
+    ASSERT_TRUE( AudioBuffer::readWAVInfo( stream, channels, sampleRate, frames ) );
+    ASSERT_EQ( 1u, channels );
+    ASSERT_EQ( 3 * ImaAdpcm::getBlockFrames( blockAlign, 1 ) + ImaAdpcm::getBlockFrames( 40, 1 ), frames );
+}
+
+#endif // TORQUE_SHIPPING
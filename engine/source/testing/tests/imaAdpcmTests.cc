@@ -0,0 +1,186 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _IMAADPCM_H_
+#include "audio/imaAdpcm.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+static const S32 sTestStepTable[89] =
+{
+   7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+   19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+   50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+   130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+   337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+   876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+   2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+   5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+   15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const S32 sTestIndexTable[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+// Reference encoder, mirroring the decoder's predictor so the round trip can be checked.
+static U8 encodeNibble( S32& predictor, S32& stepIndex, const S32 sample )
+{
+    const S32 step = sTestStepTable[stepIndex];
+    S32 diff = sample - predictor;
+    U8 nibble = 0;
+    if ( diff < 0 )
+    {
+        nibble = 8;
+        diff = -diff;
+    }
+
+    S32 delta = step >> 3;
+    if ( diff >= step ) { nibble |= 4; diff -= step; delta += step; }
+    if ( diff >= step >> 1 ) { nibble |= 2; diff -= step >> 1; delta += step >> 1; }
+    if ( diff >= step >> 2 ) { nibble |= 1; delta += step >> 2; }
+
+    predictor = mClamp( predictor + ((nibble & 8) ? -delta : delta), -32768, 32767 );
+    stepIndex = mClamp( stepIndex + sTestIndexTable[nibble], 0, 88 );
+    return nibble;
+}
+
+// Encodes frames (1 + 8n) of interleaved samples into one block.
+static void encodeBlock( const S16* pSamples, const U32 frames, const U32 channels, U8* pBlock )
+{
+    S32 predictor[2];
+    S32 stepIndex[2];
+
+    for ( U32 c = 0; c < channels; ++c )
+    {
+        predictor[c] = pSamples[c];
+        stepIndex[c] = 0;
+        pBlock[c * 4 + 0] = (U8)(pSamples[c] & 0xff);
+        pBlock[c * 4 + 1] = (U8)((pSamples[c] >> 8) & 0xff);
+        pBlock[c * 4 + 2] = 0;
+        pBlock[c * 4 + 3] = 0;
+    }
+
+    U8* pData = pBlock + channels * 4;
+    for ( U32 group = 0; group < (frames - 1) / 8; ++group )
+    {
+        for ( U32 c = 0; c < channels; ++c )
+        {
+            for ( U32 i = 0; i < 8; i += 2 )
+            {
+                const U32 frame = 1 + group * 8 + i;
+                const U8 low = encodeNibble( predictor[c], stepIndex[c], pSamples[frame * channels + c] );
+                const U8 high = encodeNibble( predictor[c], stepIndex[c], pSamples[(frame + 1) * channels + c] );
+                *pData++ = (U8)(low | (high << 4));
+            }
+        }
+    }
+}
+
+static void makeTone( S16* pSamples, const U32 frames, const U32 channels )
+{
+    for ( U32 frame = 0; frame < frames; ++frame )
+    {
+        for ( U32 c = 0; c < channels; ++c )
+            pSamples[frame * channels + c] = (S16)(12000.0f * mSin( (F32)frame * (0.05f + 0.03f * c) ));
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ImaAdpcmTests, BlockFramesTest )
+{
+    // Common block sizes written by encoders.
+    ASSERT_EQ( 505u, ImaAdpcm::getBlockFrames( 256, 1 ) );
+    ASSERT_EQ( 1017u, ImaAdpcm::getBlockFrames( 1024, 2 ) );
+
+    // Too short to hold the header.
+    ASSERT_EQ( 0u, ImaAdpcm::getBlockFrames( 3, 1 ) );
+    ASSERT_EQ( 0u, ImaAdpcm::getBlockFrames( 256, 0 ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ImaAdpcmTests, RoundTripTest )
+{
+    for ( U32 channels = 1; channels <= 2; ++channels )
+    {
+        const U32 blockAlign = 512 * channels;
+        const U32 frames = ImaAdpcm::getBlockFrames( blockAlign, channels );
+
+        S16 source[1017 * 2];
+        S16 decoded[1017 * 2];
+        U8 block[1024];
+
+        makeTone( source, frames, channels );
+        encodeBlock( source, frames, channels, block );
+
+        ASSERT_EQ( frames, ImaAdpcm::decodeBlock( block, blockAlign, channels, decoded ) );
+
+        // The first sample is stored exactly; the rest track the tone closely once the step has adapted.
+        for ( U32 c = 0; c < channels; ++c )
+            ASSERT_EQ( source[c], decoded[c] );
+
+        S32 maxError = 0;
+        for ( U32 i = 64 * channels; i < frames * channels; ++i )
+            maxError = getMax( maxError, mAbs( (S32)source[i] - (S32)decoded[i] ) );
+
+        ASSERT_LT( maxError, 1024 );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ImaAdpcmTests, PartialBlockTest )
+{
+    const U32 channels = 2;
+    const U32 blockAlign = 1024;
+    const U32 frames = ImaAdpcm::getBlockFrames( blockAlign, channels );
+
+    S16 source[1017 * 2];
+    S16 full[1017 * 2];
+    S16 partial[1017 * 2];
+    U8 block[1024];
+
+    makeTone( source, frames, channels );
+    encodeBlock( source, frames, channels, block );
+    ImaAdpcm::decodeBlock( block, blockAlign, channels, full );
+
+    // The last block of a file can be cut short; it decodes to a prefix of the full block.
+    const U32 partialFrames = ImaAdpcm::decodeBlock( block, 8 + 8 * 10, channels, partial );
+    ASSERT_EQ( 81u, partialFrames );
+
+    for ( U32 i = 0; i < partialFrames * channels; ++i )
+        ASSERT_EQ( full[i], partial[i] );
+}
+
+#endif // TORQUE_SHIPPING
@@ -31,6 +31,10 @@
 #include "platform/platform.h"
 #endif
 
+#ifndef _POOL_ALLOCATOR_H_
+#include "memory/poolAllocator.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define PLATFORM_UNITTEST_MEMORY_BUFFERSIZE     16384
@@ -165,4 +169,90 @@ TEST( PlatformMemoryTests, dMemcmpTest )
     ASSERT_GT( 0, result3 ) << "Memory compare is incorrect.";
 }
 
+//-----------------------------------------------------------------------------
+
+class PlatformMemoryTestsPooled
+{
+    DECLARE_POOLED_ALLOCATION( PlatformMemoryTestsPooled );
+
+    U8 mPayload[100];
+};
+
+TEST( PlatformMemoryTests, PoolAllocatorReuseTest )
+{
+    AllocationTracker::Tag* pTag = PlatformMemoryTestsPooled::getAllocationTag();
+    const U32 totalAllocs = pTag->mTotalAllocs;
+
+    // Allocate.
+    PlatformMemoryTestsPooled* pObject1 = new PlatformMemoryTestsPooled();
+    PlatformMemoryTestsPooled* pObject2 = new PlatformMemoryTestsPooled();
+
+    // Check.
+    ASSERT_NE( pObject1, pObject2 ) << "Pooled objects overlap.";
+    ASSERT_EQ( 0, (dsize_t)pObject1 % PoolAllocator::Granularity ) << "Pooled object is not aligned.";
+    ASSERT_EQ( 0, (dsize_t)pObject2 % PoolAllocator::Granularity ) << "Pooled object is not aligned.";
+    ASSERT_EQ( 2, pTag->mLiveCount ) << "Live count is incorrect.";
+    ASSERT_EQ( 2 * sizeof(PlatformMemoryTestsPooled), pTag->mLiveBytes ) << "Live bytes are incorrect.";
+
+    // Free and reallocate.
+    delete pObject2;
+    PlatformMemoryTestsPooled* pObject3 = new PlatformMemoryTestsPooled();
+
+    // Check.
+    ASSERT_EQ( pObject2, pObject3 ) << "Freed block was not reused.";
+    ASSERT_EQ( 2 * sizeof(PlatformMemoryTestsPooled), pTag->mPeakBytes ) << "Peak bytes are incorrect.";
+
+    // Free everything.
+    delete pObject1;
+    delete pObject3;
+
+    // Check.
+    ASSERT_EQ( 0, pTag->mLiveCount ) << "Live count is incorrect.";
+    ASSERT_EQ( 0, pTag->mLiveBytes ) << "Live bytes are incorrect.";
+    ASSERT_EQ( totalAllocs + 3, pTag->mTotalAllocs ) << "Allocation count is incorrect.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, PoolAllocatorResidentSlabTest )
+{
+    // Empty the size class.
+    PlatformMemoryTestsPooled* pObject1 = new PlatformMemoryTestsPooled();
+    delete pObject1;
+    const U32 reservedBytes = PoolAllocator::getReservedBytes();
+
+    // Refill it.
+    PlatformMemoryTestsPooled* pObject2 = new PlatformMemoryTestsPooled();
+
+    // Check.
+    ASSERT_EQ( reservedBytes, PoolAllocator::getReservedBytes() ) << "Emptied size class did not keep a slab.";
+    ASSERT_EQ( pObject1, pObject2 ) << "Resident slab was not reused.";
+
+    delete pObject2;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( PlatformMemoryTests, PoolAllocatorLargeTest )
+{
+    AllocationTracker::Tag* pTag = AllocationTracker::findTag( "PlatformMemoryTestsLarge" );
+
+    // Allocate more than is pooled.
+    const dsize_t size = PoolAllocator::MaxPooledSize * 2;
+    U8* pResult = (U8*)PoolAllocator::alloc( size, pTag );
+
+    // Check.
+    ASSERT_NE( (U8*)0, pResult ) << "Memory not allocated.";
+    ASSERT_EQ( size, pTag->mLiveBytes ) << "Live bytes are incorrect.";
+
+    // Set memory (ensure no exceptions).
+    dMemset( pResult, 0xFF, size );
+
+    // Free memory.
+    PoolAllocator::free( pResult, size, pTag );
+
+    // Check.
+    ASSERT_EQ( 0, pTag->mLiveBytes ) << "Live bytes are incorrect.";
+}
+
 #endif // TORQUE_SHIPPING
@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SHARED_ANIMATION_CLOCK_H_
+#include "2d/core/SharedAnimationClock.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// A one second cycle of four frames.
+#define CLOCK_UNITTEST_CYCLE_TIME       1.0f
+#define CLOCK_UNITTEST_FRAMES           4
+
+//-----------------------------------------------------------------------------
+
+TEST( SharedAnimationClockTests, NewClockAdvancesTest )
+{
+    const U32 tick = 10 * Tickable::smTickMs;
+
+    // A clock created between ticks still advances on the next one.
+    SharedAnimationClock clock( CLOCK_UNITTEST_CYCLE_TIME, CLOCK_UNITTEST_FRAMES, 1.0f );
+    clock.advance( Tickable::smTickSec, tick );
+    ASSERT_FLOAT_EQ( Tickable::smTickSec, clock.getCurrentTime() );
+
+    // Only once per tick.
+    clock.advance( Tickable::smTickSec, tick );
+    ASSERT_FLOAT_EQ( Tickable::smTickSec, clock.getCurrentTime() );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SharedAnimationClockTests, JoinMidTickTest )
+{
+    SharedAnimationClock clock( CLOCK_UNITTEST_CYCLE_TIME, CLOCK_UNITTEST_FRAMES, 1.0f );
+
+    // Ticks are processed with the tick time before it moves on, so a
+    // subscriber joining between frames sees the time of the next tick.
+    U32 tick = 0;
+    clock.advance( Tickable::smTickSec, tick );
+    tick += Tickable::smTickMs;
+
+    // Joining refreshes with no elapsed time.
+    clock.advance( 0.0f, tick );
+    ASSERT_FLOAT_EQ( Tickable::smTickSec, clock.getCurrentTime() );
+
+    // The next tick still advances, once, for every subscriber.
+    clock.advance( Tickable::smTickSec, tick );
+    clock.advance( Tickable::smTickSec, tick );
+    ASSERT_FLOAT_EQ( 2.0f * Tickable::smTickSec, clock.getCurrentTime() );
+
+    // Keep ticking, joining every tick, until the frame moves on.
+    while( clock.getFrameIndex() == 0 )
+    {
+        tick += Tickable::smTickMs;
+        clock.advance( 0.0f, tick );
+        clock.advance( Tickable::smTickSec, tick );
+
+        ASSERT_LT( tick, 1000u );
+    }
+
+    ASSERT_EQ( 1, clock.getFrameIndex() );
+    ASSERT_GE( clock.getCurrentTime(), CLOCK_UNITTEST_CYCLE_TIME / CLOCK_UNITTEST_FRAMES );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,173 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _SIMDICTIONARY_H_
+#include "sim/simDictionary.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Lets the tests assign ids without registering the objects or interning id strings.
+class SimIdDictionaryTestObject : public SimObject
+{
+public:
+    void setTestId( const SimObjectId id ) { mId = id; }
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( SimIdDictionaryTests, InsertFindRemoveTest )
+{
+    SimIdDictionary dictionary;
+    SimIdDictionaryTestObject objects[3];
+
+    // Use ids from each end of a page as well as the next page.
+    objects[0].setTestId( DynamicObjectIdFirst );
+    objects[1].setTestId( 4095 );
+    objects[2].setTestId( 4096 );
+
+    for( U32 index = 0; index < 3; ++index )
+        dictionary.insert( &objects[index] );
+
+    for( U32 index = 0; index < 3; ++index )
+    {
+        ASSERT_EQ( (SimObject*)&objects[index], dictionary.find( objects[index].getId() ) ) << "Inserted object not found.";
+    }
+
+    ASSERT_EQ( (SimObject*)NULL, dictionary.find( DynamicObjectIdFirst + 1 ) ) << "Unused id found an object.";
+
+    for( U32 index = 0; index < 3; ++index )
+    {
+        dictionary.remove( &objects[index] );
+        ASSERT_EQ( (SimObject*)NULL, dictionary.find( objects[index].getId() ) ) << "Removed object still found.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimIdDictionaryTests, SharedIdTest )
+{
+    SimIdDictionary dictionary;
+    SimIdDictionaryTestObject first;
+    SimIdDictionaryTestObject second;
+    first.setTestId( DynamicObjectIdFirst );
+    second.setTestId( DynamicObjectIdFirst );
+
+    dictionary.insert( &first );
+    dictionary.insert( &second );
+
+    // The most recently inserted object wins.
+    ASSERT_EQ( (SimObject*)&second, dictionary.find( DynamicObjectIdFirst ) ) << "Most recent object not found first.";
+
+    dictionary.remove( &second );
+    ASSERT_EQ( (SimObject*)&first, dictionary.find( DynamicObjectIdFirst ) ) << "Earlier object lost after removal.";
+
+    dictionary.remove( &first );
+    ASSERT_EQ( (SimObject*)NULL, dictionary.find( DynamicObjectIdFirst ) ) << "Removed object still found.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimIdDictionaryTests, OverflowIdTest )
+{
+    SimIdDictionary dictionary;
+    SimIdDictionaryTestObject object;
+    object.setTestId( RootGroupId - 1 );
+
+    dictionary.insert( &object );
+    ASSERT_EQ( (SimObject*)&object, dictionary.find( RootGroupId - 1 ) ) << "Out of range id not found.";
+    ASSERT_EQ( 0U, dictionary.getPageCount() ) << "Out of range id allocated a page.";
+
+    dictionary.remove( &object );
+    ASSERT_EQ( (SimObject*)NULL, dictionary.find( RootGroupId - 1 ) ) << "Removed object still found.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimIdDictionaryTests, GenerationTest )
+{
+    SimIdDictionary dictionary;
+    SimIdDictionaryTestObject first;
+    SimIdDictionaryTestObject second;
+    first.setTestId( DynamicObjectIdFirst );
+    second.setTestId( DynamicObjectIdFirst );
+
+    dictionary.insert( &first );
+    const U32 generation = dictionary.getGeneration( DynamicObjectIdFirst );
+    ASSERT_EQ( (SimObject*)&first, dictionary.find( DynamicObjectIdFirst, generation ) ) << "Current generation not found.";
+
+    // Reuse the id.
+    dictionary.remove( &first );
+    dictionary.insert( &second );
+
+    ASSERT_EQ( (SimObject*)&second, dictionary.find( DynamicObjectIdFirst ) ) << "Reused id not found.";
+    ASSERT_EQ( (SimObject*)NULL, dictionary.find( DynamicObjectIdFirst, generation ) ) << "Stale generation found an object.";
+    ASSERT_NE( generation, dictionary.getGeneration( DynamicObjectIdFirst ) ) << "Generation did not change.";
+
+    dictionary.remove( &second );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimIdDictionaryTests, PageReclaimTest )
+{
+    SimIdDictionary dictionary;
+    SimIdDictionaryTestObject objects[2];
+
+    // Use two pages.
+    objects[0].setTestId( 4096 );
+    objects[1].setTestId( 8192 );
+    dictionary.insert( &objects[0] );
+    dictionary.insert( &objects[1] );
+    ASSERT_EQ( 2U, dictionary.getPageCount() ) << "Pages not allocated.";
+
+    // Emptying the first page releases it.
+    dictionary.remove( &objects[0] );
+    ASSERT_EQ( 1U, dictionary.getPageCount() ) << "Empty page not released.";
+    ASSERT_EQ( (SimObject*)NULL, dictionary.find( 4096 ) ) << "Removed object still found.";
+    dictionary.reclaimPages();
+    dictionary.reclaimPages();
+
+    // Emptying the newest page keeps it.
+    dictionary.remove( &objects[1] );
+    ASSERT_EQ( 1U, dictionary.getPageCount() ) << "Newest page released.";
+
+    // Reusing a released page's ids allocates it again.
+    dictionary.insert( &objects[0] );
+    ASSERT_EQ( (SimObject*)&objects[0], dictionary.find( 4096 ) ) << "Object not found on a reallocated page.";
+    ASSERT_EQ( 2U, dictionary.getPageCount() ) << "Page not reallocated.";
+
+    dictionary.remove( &objects[0] );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,147 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _INLINE_VECTOR_H_
+#include "collection/inlineVector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define VECTOR_UNITTEST_ELEMENTS        65536
+
+//-----------------------------------------------------------------------------
+
+TEST( VectorTests, GeometricGrowthTest )
+{
+    Vector<U32> linear;
+    Vector<U32> geometric;
+    linear.setGrowthPolicy( VectorGrowLinear );
+
+    U32 linearGrowths = 0;
+    U32 geometricGrowths = 0;
+
+    for( U32 index = 0; index < VECTOR_UNITTEST_ELEMENTS; ++index )
+    {
+        const U32 linearCapacity = linear.capacity();
+        const U32 geometricCapacity = geometric.capacity();
+
+        linear.push_back( index );
+        geometric.push_back( index );
+
+        if ( linear.capacity() != linearCapacity )
+            linearGrowths++;
+        if ( geometric.capacity() != geometricCapacity )
+            geometricGrowths++;
+    }
+
+    // Check.
+    ASSERT_EQ( VECTOR_UNITTEST_ELEMENTS, linear.size() ) << "Linear vector size is incorrect.";
+    ASSERT_EQ( VECTOR_UNITTEST_ELEMENTS, geometric.size() ) << "Geometric vector size is incorrect.";
+    ASSERT_EQ( VECTOR_UNITTEST_ELEMENTS / VectorBlockSize, linearGrowths ) << "Linear vector should grow a block at a time.";
+    ASSERT_GT( 32U, geometricGrowths ) << "Geometric vector grew too many times.";
+
+    for( U32 index = 0; index < VECTOR_UNITTEST_ELEMENTS; ++index )
+    {
+        ASSERT_EQ( index, geometric[index] ) << "Geometric vector element is incorrect.";
+    }
+
+    // Compacting should trim the geometric slack.
+    geometric.compact();
+    ASSERT_EQ( VECTOR_UNITTEST_ELEMENTS, geometric.capacity() ) << "Compacted vector capacity is incorrect.";
+
+    // Copies should keep the growth policy.
+    Vector<U32> copy( linear );
+    ASSERT_EQ( VectorGrowLinear, copy.getGrowthPolicy() ) << "Copied vector growth policy is incorrect.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( VectorTests, ReserveTest )
+{
+    Vector<U32> vector;
+    vector.reserve( 100 );
+
+    const U32 capacity = vector.capacity();
+
+    // Check.
+    ASSERT_EQ( 0, vector.size() ) << "Reserved vector should be empty.";
+    ASSERT_LE( 100U, capacity ) << "Reserved vector capacity is incorrect.";
+
+    for( U32 index = 0; index < 100; ++index )
+        vector.push_back( index );
+
+    // Check.
+    ASSERT_EQ( capacity, vector.capacity() ) << "Reserved vector should not grow.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( VectorTests, InlineVectorTest )
+{
+    InlineVector<U32, 8> vector;
+
+    // Check.
+    ASSERT_TRUE( vector.isInline() ) << "Vector should start inline.";
+
+    for( U32 index = 0; index < 8; ++index )
+        vector.push_back( index );
+
+    // Check.
+    ASSERT_TRUE( vector.isInline() ) << "Vector should stay inline up to its inline capacity.";
+
+    for( U32 index = 8; index < 1024; ++index )
+        vector.push_back( index );
+
+    // Check.
+    ASSERT_FALSE( vector.isInline() ) << "Vector should have moved to the heap.";
+    ASSERT_EQ( 1024, vector.size() ) << "Vector size is incorrect.";
+
+    for( U32 index = 0; index < 1024; ++index )
+    {
+        ASSERT_EQ( index, vector[index] ) << "Vector element is incorrect.";
+    }
+
+    // Erase, insert and copy.
+    vector.erase( U32(0) );
+    ASSERT_EQ( 1, vector.first() ) << "Erase did not preserve order.";
+    vector.insert( 0 );
+    vector[0] = 0;
+    ASSERT_EQ( 1023, vector.last() ) << "Insert did not preserve order.";
+
+    Vector<U32> copy;
+    vector.copyTo( copy );
+    ASSERT_EQ( vector.size(), copy.size() ) << "Copied vector size is incorrect.";
+
+    // Reset.
+    vector.reset();
+    ASSERT_TRUE( vector.isInline() ) << "Reset vector should be inline.";
+    ASSERT_EQ( 0, vector.size() ) << "Reset vector should be empty.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -83,6 +83,12 @@
 /// 'TORQUE_GATHER_METRICS'
 /// When defined, Torque will gather additional performance metrics.
 ///
+/// 'TORQUE_TRACK_ALLOCATIONS'
+/// When defined, dMalloc/dRealloc/dFree track live bytes, peak bytes and allocation
+/// counts per source file and line, reported with dumpAllocationStats().  This adds a
+/// header and a lock to every allocation, and memory from dMalloc must then only be
+/// released with dFree (and vice versa).
+///
 /// 'TORQUE_MULTITHREAD'
 /// When defined, Torque will attempt to make select systems thread-safe.  This does not
 /// make the entire engine thread-safe nor is it a magic bullet that will make the engine
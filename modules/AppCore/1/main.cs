@@ -28,15 +28,19 @@ function AppCore::create( %this )
     exec("./scripts/canvas.cs");
     exec("./scripts/openal.cs");
     
-    // Initialize the canvas
-    initializeCanvas("Torque 2D");
-    
-    // Set the canvas color
-    Canvas.BackgroundColor = "CornflowerBlue";
-    Canvas.UseBackgroundColor = true;
-    
-    // Initialize audio
-    initializeOpenAL();
+    // Headless games have no window or audio device.
+    if ( !isHeadless() )
+    {
+        // Initialize the canvas
+        initializeCanvas("Torque 2D");
+        
+        // Set the canvas color
+        Canvas.BackgroundColor = "CornflowerBlue";
+        Canvas.UseBackgroundColor = true;
+        
+        // Initialize audio
+        initializeOpenAL();
+    }
     
     ModuleDatabase.loadGroup("gameBase");
 }